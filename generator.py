@@ -2648,7 +2648,7 @@ class ThreadOutputGenerator(OutputGenerator):
         self.newline()
         # record intercepted procedures
         write('// intercepts', file=self.outFile)
-        write('struct { const char* name; PFN_vkVoidFunction pFunc;} procmap[] = {', file=self.outFile)
+        write('static const layer_proc_table procmap = {', file=self.outFile)
         write('\n'.join(self.intercepts), file=self.outFile)
         write('};\n', file=self.outFile)
         self.newline()
@@ -2820,8 +2820,6 @@ class ThreadOutputGenerator(OutputGenerator):
         self.appendSection('command', '    ' + assignresult + API + '(' + paramstext + ');')
         self.appendSection('command', '    if (threadChecks) {')
         self.appendSection('command', "    "+"\n    ".join(str(finishthreadsafety).rstrip().split("\n")))
-        self.appendSection('command', '    } else {')
-        self.appendSection('command', '        finishMultiThread();')
         self.appendSection('command', '    }')
         # Return result variable, if any.
         if (resulttype != None):
@@ -33,6 +33,9 @@
 #include <SPIRV/spirv.hpp>
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
@@ -43,7 +46,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <tuple>
+#if !defined(_WIN32)
+#include <signal.h>
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
 
 #include "vk_loader_platform.h"
 #include "vk_dispatch_table_helper.h"
@@ -60,6 +71,8 @@
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
+#include "vk_layer_rwlock.h"
+#include "vk_layer_proc_table.h"
 #include "spirv-tools/libspirv.h"
 
 #if defined __ANDROID__
@@ -76,14 +89,15 @@
 using namespace std;
 
 // TODO : CB really needs it's own class and files so this is just temp code until that happens
-GLOBAL_CB_NODE::~GLOBAL_CB_NODE() {
-    for (uint32_t i=0; i<VK_PIPELINE_BIND_POINT_RANGE_SIZE; ++i) {
-        // Make sure that no sets hold onto deleted CB binding
-        for (auto set : lastBound[i].uniqueBoundSets) {
-            set->RemoveBoundCommandBuffer(this);
-        }
-    }
-}
+GLOBAL_CB_NODE::GLOBAL_CB_NODE(layer_arena *arena)
+    : framebuffers(arena_allocator<VkFramebuffer>(arena)), object_bindings(arena_allocator<char>(arena)),
+      bindingsCheckedGeneration(0), waitedEvents(arena_allocator<VkEvent>(arena)),
+      waitedEventsBeforeQueryReset(arena_allocator<char>(arena)),
+      queryToStateMap(arena_allocator<char>(arena)), activeQueries(arena_allocator<QueryObject>(arena)),
+      startedQueries(arena_allocator<QueryObject>(arena)), imageLayoutMap(arena_allocator<char>(arena)),
+      eventToStageMap(arena_allocator<char>(arena)),
+      updateImages(arena_allocator<VkImageView>(arena)), updateBuffers(arena_allocator<VkBuffer>(arena)),
+      secondaryCommandBuffers(arena_allocator<VkCommandBuffer>(arena)), memObjs(arena_allocator<VkDeviceMemory>(arena)) {}
 
 namespace core_validation {
 
@@ -102,6 +116,90 @@ struct devExts {
 
 // fwd decls
 struct shader_module;
+typedef std::pair<uint64_t, uint64_t> spirv_hash_t;
+
+// An analysed module in the shader cache. last_use orders entries for eviction: entries read from the cache file
+//  are numbered in file order below every use made in this run.
+struct shader_cache_entry {
+    shared_ptr<shader_module> module;
+    uint64_t last_use;
+};
+
+// Worker threads for validate_pipeline_shader_state_parallel. They are started by the first batch that wants them and
+//  then sleep between batches until the device is destroyed, so vkCreateGraphicsPipelines doesn't pay for thread creation.
+class shader_validation_pool {
+  public:
+    shader_validation_pool() : task_(nullptr), unclaimed_(0), running_(0), stop_(false) {}
+    ~shader_validation_pool() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    // Start workers until there are count of them, and return how many there are. That is fewer than count if the
+    //  system refuses to create more threads.
+    uint32_t reserve(uint32_t count) {
+        while (threads_.size() < count) {
+            try {
+                threads_.emplace_back(&shader_validation_pool::work, this);
+            } catch (const std::system_error &) {
+                break;
+            }
+        }
+        return static_cast<uint32_t>(threads_.size());
+    }
+
+    // Run task on the calling thread and on up to helpers workers, returning once every call has finished. Workers
+    //  that haven't picked the task up by the time the calling thread's call returns are not given it, so task must
+    //  split its work dynamically and be done once any one call returns.
+    void run(std::function<void()> const &task, uint32_t helpers) {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            task_ = &task;
+            unclaimed_ = helpers;
+        }
+        wake_.notify_all();
+        task();
+        std::unique_lock<std::mutex> lock(lock_);
+        unclaimed_ = 0;
+        done_.wait(lock, [this]() { return running_ == 0; });
+        task_ = nullptr;
+    }
+
+  private:
+    void work() {
+        std::unique_lock<std::mutex> lock(lock_);
+        while (true) {
+            wake_.wait(lock, [this]() { return stop_ || unclaimed_ > 0; });
+            if (stop_) {
+                return;
+            }
+            unclaimed_--;
+            running_++;
+            auto task = task_;
+            lock.unlock();
+            (*task)();
+            lock.lock();
+            if (--running_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::function<void()> const *task_;
+    uint32_t unclaimed_; // workers the current task may still be handed to
+    uint32_t running_;   // workers inside the current task
+    bool stop_;
+};
 
 // TODO : Split this into separate structs for instance and device level data?
 struct layer_data {
@@ -141,10 +239,29 @@ struct layer_data {
     unordered_map<VkSemaphore, SEMAPHORE_NODE> semaphoreMap;
     unordered_map<VkCommandBuffer, GLOBAL_CB_NODE *> commandBufferMap;
     unordered_map<VkFramebuffer, unique_ptr<FRAMEBUFFER_NODE>> frameBufferMap;
-    unordered_map<VkImage, vector<ImageSubresourcePair>> imageSubresourceMap;
-    unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> imageLayoutMap;
+    unordered_map<VkImage, IMAGE_LAYOUT_MAP<VkImageLayout>> imageLayoutMap;
+    // Last IMAGE_LAYOUT_MAP::version handed out for imageLayoutMap; versions are unique across images
+    uint64_t imageLayoutVersion;
+    // Bumped whenever a buffer, memory object or descriptor set is destroyed, as that can change the outcome of
+    //  DescriptorSet::ValidateDrawState or leave command buffers with freed sets bound
+    uint64_t descriptorResourceEpoch;
     unordered_map<VkRenderPass, RENDER_PASS_NODE *> renderPassMap;
-    unordered_map<VkShaderModule, unique_ptr<shader_module>> shaderModuleMap;
+    unordered_map<VkShaderModule, shared_ptr<shader_module>> shaderModuleMap;
+    // Analysed modules by content hash, shared by every VkShaderModule created from the same SPIR-V
+    std::map<spirv_hash_t, shader_cache_entry> shaderModuleCache;
+    // Analyses read from the shader cache file that no module has matched yet
+    std::map<spirv_hash_t, shader_cache_entry> shaderCacheRecords;
+    // Most entries the two maps above hold together; the least recently used are evicted beyond it
+    size_t shaderCacheMaxEntries;
+    uint64_t shaderCacheUseCount;
+    std::string shaderCacheFile;
+    std::string stateDumpFile;
+    // This device asked for state dumps on SIGUSR1 (see init_state_dump)
+    bool stateDumpOnSignal;
+    // Shadow non-coherent mappings with guard pages (see guarded_mapping) instead of a guard-banded copy
+    bool noncoherentGuardPages;
+    // Created by the first pipeline batch large enough to validate in parallel
+    unique_ptr<shader_validation_pool> shaderValidationPool;
     VkDevice device;
 
     // Device specific data
@@ -155,12 +272,13 @@ struct layer_data {
 
     layer_data()
         : instance_state(nullptr), report_data(nullptr), device_dispatch_table(nullptr), instance_dispatch_table(nullptr),
-          device_extensions(), device(VK_NULL_HANDLE), phys_dev_properties{}, phys_dev_mem_props{}, physical_device_features{},
+          device_extensions(), imageLayoutVersion(0), descriptorResourceEpoch(0), shaderCacheMaxEntries(0), shaderCacheUseCount(0),
+          noncoherentGuardPages(false),
+          stateDumpOnSignal(false), device(VK_NULL_HANDLE), phys_dev_properties{}, phys_dev_mem_props{}, physical_device_features{},
           physical_device_state(nullptr){};
 };
 
-// TODO : Do we need to guard access to layer_data_map w/ lock?
-static unordered_map<void *, layer_data *> layer_data_map;
+static layer_data_table<layer_data> layer_data_map;
 
 static const VkLayerProperties global_layer = {
     "VK_LAYER_LUNARG_core_validation", VK_LAYER_API_VERSION, 1, "LunarG Validation Layer",
@@ -228,6 +346,32 @@ struct spirv_inst_iter {
     spirv_inst_iter const &operator*() const { return *this; }
 };
 
+typedef std::pair<unsigned, unsigned> location_t;
+typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+
+struct interface_var {
+    uint32_t id;
+    uint32_t type_id;
+    uint32_t offset;
+    bool is_patch;
+    bool is_block_member;
+    /* TODO: collect the name, too? Isn't required to be present. */
+};
+
+/* Interface analysis of one entrypoint. Each part is computed the first time a pipeline needs it, and then
+ * reused by every later pipeline using the same entrypoint of the same SPIR-V.
+ */
+struct entrypoint_analysis {
+    bool have_descriptor_uses;
+    std::unordered_set<uint32_t> accessible_ids;
+    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+    /* collect_interface_by_location results, indexed by [is output][is array of verts] */
+    bool have_interface[2][2];
+    std::map<location_t, interface_var> interface[2][2];
+
+    entrypoint_analysis() : have_descriptor_uses(false), have_interface() {}
+};
+
 struct shader_module {
     /* the spirv image itself */
     vector<uint32_t> words;
@@ -235,6 +379,10 @@ struct shader_module {
      * trees, constant expressions, etc requires jumping all over the instruction stream.
      */
     unordered_map<unsigned, unsigned> def_index;
+    /* analysis of each entrypoint, keyed by the offset of its OpEntryPoint */
+    mutable unordered_map<unsigned, entrypoint_analysis> entrypoints;
+    /* guards entrypoints, as pipelines in a batch are validated concurrently */
+    mutable std::mutex analysis_lock;
 
     shader_module(VkShaderModuleCreateInfo const *pCreateInfo)
         : words((uint32_t *)pCreateInfo->pCode, (uint32_t *)pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t)),
@@ -243,6 +391,9 @@ struct shader_module {
         build_def_index(this);
     }
 
+    /* analysis loaded from the shader cache file; words are filled in once a module with matching code is created */
+    shader_module() {}
+
     /* expose begin() / end() to enable range-based for */
     spirv_inst_iter begin() const { return spirv_inst_iter(words.begin(), words.begin() + 5); } /* first insn */
     spirv_inst_iter end() const { return spirv_inst_iter(words.begin(), words.end()); }         /* just past last insn */
@@ -259,8 +410,56 @@ struct shader_module {
     }
 };
 
-// TODO : This can be much smarter, using separate locks for separate global data
-static std::mutex global_lock;
+// global_lock guards the layer_data maps and the object nodes they own. Calls that create, destroy, submit, or
+//  otherwise change more than a single command buffer take it exclusively. vkCmd* calls only touch the node of the
+//  command buffer being recorded, so they take it shared plus that node's recording_lock (see cb_recording_lock).
+//  A shared acquire is still an atomic read-modify-write of the lock's one state word, so recorders on different
+//  threads keep bouncing that cache line between them; they no longer queue on a mutex, but they are not independent.
+static rw_lock global_lock;
+// Leaf lock for the object-side set vkEndCommandBuffer adds to while global_lock is only held shared:
+//  DEVICE_MEM_INFO::commandBufferBindings. Removal from it only happens with global_lock held exclusively.
+static std::mutex binding_lock;
+// Set (e.g. from a signal handler) to have the next vkQueueSubmit or vkQueuePresentKHR write a state dump
+static std::atomic<bool> state_dump_requested(false);
+
+// Lock taken by vkCmd* entry points: global_lock shared, then the recording_lock of the given command buffer.
+//  Exposes lock()/unlock() so entry points can drop it around the call down the chain like a unique_lock.
+class cb_recording_lock {
+  public:
+    cb_recording_lock(layer_data *dev_data, VkCommandBuffer cb) : dev_data_(dev_data), cb_(cb), cb_node_(nullptr), global_(global_lock) {
+        lock_cb();
+    }
+    ~cb_recording_lock() {
+        if (global_.owns_lock())
+            unlock_cb();
+    }
+    void lock() {
+        global_.lock();
+        lock_cb();
+    }
+    void unlock() {
+        unlock_cb();
+        global_.unlock();
+    }
+
+  private:
+    void lock_cb() {
+        auto cb_it = dev_data_->commandBufferMap.find(cb_);
+        cb_node_ = (cb_it == dev_data_->commandBufferMap.end()) ? nullptr : cb_it->second;
+        if (cb_node_)
+            cb_node_->recording_lock.lock();
+    }
+    void unlock_cb() {
+        if (cb_node_)
+            cb_node_->recording_lock.unlock();
+        cb_node_ = nullptr;
+    }
+
+    layer_data *dev_data_;
+    VkCommandBuffer cb_;
+    GLOBAL_CB_NODE *cb_node_;
+    shared_lock global_;
+};
 
 // Return ImageViewCreateInfo ptr for specified imageView or else NULL
 VkImageViewCreateInfo *getImageViewData(const layer_data *dev_data, VkImageView image_view) {
@@ -485,6 +684,70 @@ static void set_memory_valid(layer_data *dev_data, VkDeviceMemory mem, bool vali
     }
 }
 
+// Defer a check that mem (or swapchain image) holds valid data until the command buffer is submitted
+static void AddMemoryCheck(GLOBAL_CB_NODE *pCB, VkDeviceMemory mem, const char *functionName, VkImage image = VK_NULL_HANDLE) {
+    CB_DEFERRED_CHECK check = {};
+    check.op = CB_DEFERRED_VALIDATE_MEMORY;
+    check.memory.mem = mem;
+    check.memory.image = image;
+    check.memory.func_name = functionName;
+    pCB->memoryChecks.push_back(check);
+}
+
+// Defer marking mem (or swapchain image) contents valid or undefined until the command buffer is submitted
+static void AddSetMemoryValid(GLOBAL_CB_NODE *pCB, VkDeviceMemory mem, bool valid, VkImage image = VK_NULL_HANDLE) {
+    CB_DEFERRED_CHECK check = {};
+    check.op = valid ? CB_DEFERRED_SET_MEMORY_VALID : CB_DEFERRED_SET_MEMORY_INVALID;
+    check.memory.mem = mem;
+    check.memory.image = image;
+    pCB->memoryChecks.push_back(check);
+}
+
+// Record that the CB being recorded uses mem. The CB's own lists are guarded by its recording_lock; the first reference
+//  also files the CB under the mem obj's unmergedCommandBuffers, which only takes that mem obj's unmergedLock. The
+//  reverse link in DEVICE_MEM_INFO::commandBufferBindings is added by mergeCmdBufMemReferences.
+static void addCmdBufMemReference(GLOBAL_CB_NODE *cb_node, DEVICE_MEM_INFO *pMemInfo) {
+    if (cb_node->memObjs.insert(pMemInfo->mem).second) {
+        cb_node->unmergedMemObjs.push_back(pMemInfo->mem);
+        std::lock_guard<std::mutex> unmerged_guard(pMemInfo->unmergedLock);
+        pMemInfo->unmergedCommandBuffers.insert(cb_node);
+    }
+}
+
+// Add the CB to the commandBufferBindings of every mem obj it started using since the last merge. Called once when
+//  recording ends, so parallel recording only meets on binding_lock there instead of on every vkCmd* call. Every CB
+//  that can be in flight has been ended, so FreeMemory's in-flight checks see all of its references.
+static void mergeCmdBufMemReferences(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
+    if (cb_node->unmergedMemObjs.empty())
+        return;
+    std::lock_guard<std::mutex> binding_guard(binding_lock);
+    for (auto mem : cb_node->unmergedMemObjs) {
+        DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, mem);
+        if (pMemInfo) {
+            pMemInfo->commandBufferBindings.insert(cb_node->commandBuffer);
+            std::lock_guard<std::mutex> unmerged_guard(pMemInfo->unmergedLock);
+            pMemInfo->unmergedCommandBuffers.erase(cb_node);
+        }
+    }
+    cb_node->unmergedMemObjs.clear();
+}
+
+// Forget a freed mem obj in CBs still recording. Their references to it have not been merged into commandBufferBindings,
+//  so without this a handle reused by a later vkAllocateMemory would be bound to these CBs at vkEndCommandBuffer.
+//  Only the CBs filed under the mem obj's unmergedCommandBuffers are visited. Caller holds global_lock exclusively, which
+//  keeps every vkCmd* (and so every recording_lock and unmergedLock holder) out.
+static void dropUnmergedMemReferences(DEVICE_MEM_INFO *pMemInfo) {
+    for (auto cb_node : pMemInfo->unmergedCommandBuffers) {
+        auto &unmerged = cb_node->unmergedMemObjs;
+        auto it = std::find(unmerged.begin(), unmerged.end(), pMemInfo->mem);
+        if (it != unmerged.end()) {
+            unmerged.erase(it);
+        }
+        cb_node->memObjs.erase(pMemInfo->mem);
+    }
+    pMemInfo->unmergedCommandBuffers.clear();
+}
+
 // Find CB Info and add mem reference to list container
 // Find Mem Obj Info and add CB reference to list container
 static bool update_cmd_buf_and_mem_references(layer_data *dev_data, const VkCommandBuffer cb, const VkDeviceMemory mem,
@@ -497,34 +760,36 @@ static bool update_cmd_buf_and_mem_references(layer_data *dev_data, const VkComm
         // First update CB binding in MemObj mini CB list
         DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, mem);
         if (pMemInfo) {
-            pMemInfo->commandBufferBindings.insert(cb);
-            // Now update CBInfo's Mem reference list
+            // Now update CBInfo's Mem reference list; the MemObj side is updated by mergeCmdBufMemReferences
             GLOBAL_CB_NODE *pCBNode = getCBNode(dev_data, cb);
             // TODO: keep track of all destroyed CBs so we know if this is a stale or simply invalid object
             if (pCBNode) {
-                pCBNode->memObjs.insert(mem);
+                addCmdBufMemReference(pCBNode, pMemInfo);
             }
         }
     }
     return skip_call;
 }
 
+// Tie the VK_OBJECT to the cmd buffer, remembering the generation of node (the object's state) it was bound in
+static void addCommandBufferBinding(BASE_NODE *node, VK_OBJECT obj, GLOBAL_CB_NODE *cb_node) {
+    cb_node->object_bindings.insert(std::make_pair(obj, node->generation));
+}
+
 // Create binding link between given iamge node and command buffer node
 static bool addCommandBufferBindingImage(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, IMAGE_NODE *img_node, const char *apiName) {
     bool skip_call = false;
     // Skip validation if this image was created through WSI
     if (img_node->mem != MEMTRACKER_SWAP_CHAIN_IMAGE_KEY) {
-        // First update CB binding in MemObj mini CB list
+        // Update CBInfo's Mem reference list; the MemObj side is updated by mergeCmdBufMemReferences
         DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, img_node->mem);
         if (pMemInfo) {
-            pMemInfo->commandBufferBindings.insert(cb_node->commandBuffer);
-            // Now update CBInfo's Mem reference list
-            cb_node->memObjs.insert(img_node->mem);
+            addCmdBufMemReference(cb_node, pMemInfo);
         }
-        cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(img_node->image), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT});
     }
     // Now update cb binding for image
-    img_node->cb_bindings.insert(cb_node);
+    addCommandBufferBinding(img_node, {reinterpret_cast<uint64_t &>(img_node->image), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT},
+                            cb_node);
     return skip_call;
 }
 
@@ -533,16 +798,14 @@ static bool addCommandBufferBindingBuffer(layer_data *dev_data, GLOBAL_CB_NODE *
                                           const char *apiName) {
     bool skip_call = false;
 
-    // First update CB binding in MemObj mini CB list
+    // Update CBInfo's Mem reference list; the MemObj side is updated by mergeCmdBufMemReferences
     DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, buff_node->mem);
     if (pMemInfo) {
-        pMemInfo->commandBufferBindings.insert(cb_node->commandBuffer);
-        // Now update CBInfo's Mem reference list
-        cb_node->memObjs.insert(buff_node->mem);
-        cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(buff_node->buffer), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT});
+        addCmdBufMemReference(cb_node, pMemInfo);
     }
     // Now update cb binding for buffer
-    buff_node->cb_bindings.insert(cb_node);
+    addCommandBufferBinding(buff_node, {reinterpret_cast<uint64_t &>(buff_node->buffer), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT},
+                            cb_node);
 
     return skip_call;
 }
@@ -559,7 +822,15 @@ static void clear_cmd_buf_and_mem_references(layer_data *dev_data, GLOBAL_CB_NOD
             }
             pCBNode->memObjs.clear();
         }
-        pCBNode->validate_functions.clear();
+        // Runs with global_lock held exclusively, so no recording thread holds an unmergedLock
+        for (auto mem : pCBNode->unmergedMemObjs) {
+            DEVICE_MEM_INFO *pInfo = getMemObjInfo(dev_data, mem);
+            if (pInfo) {
+                pInfo->unmergedCommandBuffers.erase(pCBNode);
+            }
+        }
+        pCBNode->unmergedMemObjs.clear();
+        pCBNode->memoryChecks.clear();
     }
 }
 // Overloaded call to above function when GLOBAL_CB_NODE has not already been looked-up
@@ -623,12 +894,15 @@ static bool freeMemObjInfo(layer_data *dev_data, void *object, VkDeviceMemory me
             }
         }
 
+        dropUnmergedMemReferences(pInfo);
+
         // Now verify that no references to this mem obj remain and remove bindings
         if (pInfo->commandBufferBindings.size() || pInfo->objBindings.size()) {
             skip_call |= reportMemReferencesAndCleanUp(dev_data, pInfo);
         }
         // Delete mem obj info
         dev_data->memObjMap.erase(dev_data->memObjMap.find(mem));
+        dev_data->descriptorResourceEpoch++;
     } else if (VK_NULL_HANDLE != mem) {
         // The request is to free an invalid, non-zero handle
         skip_call = log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
@@ -904,6 +1178,138 @@ static void printCBList(layer_data *my_data) {
     }
 }
 
+static const char *cbStateToString(CB_STATE state) {
+    switch (state) {
+    case CB_NEW:
+        return "NEW";
+    case CB_RECORDING:
+        return "RECORDING";
+    case CB_RECORDED:
+        return "RECORDED";
+    case CB_INVALID:
+        return "INVALID";
+    }
+    return "UNKNOWN";
+}
+
+#if !defined(_WIN32)
+// The SIGUSR1 handler is process wide: installed by the first device that asks for it and put back by the last one
+static std::mutex state_dump_signal_lock;
+static uint32_t state_dump_signal_users = 0;
+static struct sigaction previous_sigusr1_action;
+
+static void requestStateDump(int sig, siginfo_t *info, void *context) {
+    state_dump_requested.store(true, std::memory_order_relaxed);
+    // Pass the signal on to whatever the application had installed, but not to the default action, which would kill it
+    if (previous_sigusr1_action.sa_flags & SA_SIGINFO) {
+        previous_sigusr1_action.sa_sigaction(sig, info, context);
+    } else if (previous_sigusr1_action.sa_handler != SIG_DFL && previous_sigusr1_action.sa_handler != SIG_IGN) {
+        previous_sigusr1_action.sa_handler(sig);
+    }
+}
+#endif
+
+// Arm the state dump triggers if lunarg_core_validation.state_dump_file is set. A final dump is always written at
+//  vkDestroyDevice. With lunarg_core_validation.state_dump_on_signal also set, on POSIX systems SIGUSR1 asks for a dump
+//  at the next queue submission or present.
+static void init_state_dump(layer_data *dev_data) {
+    dev_data->stateDumpFile = getLayerOption("lunarg_core_validation.state_dump_file");
+#if !defined(_WIN32)
+    if (dev_data->stateDumpFile.empty() || strcmp(getLayerOption("lunarg_core_validation.state_dump_on_signal"), "true")) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(state_dump_signal_lock);
+    if (!state_dump_signal_users) {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = requestStateDump;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGUSR1, &action, &previous_sigusr1_action) != 0) {
+            return;
+        }
+    }
+    state_dump_signal_users++;
+    dev_data->stateDumpOnSignal = true;
+#endif
+}
+
+// Undo init_state_dump's signal handling for a device being destroyed
+static void finish_state_dump(layer_data *dev_data) {
+#if !defined(_WIN32)
+    if (!dev_data->stateDumpOnSignal) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(state_dump_signal_lock);
+    if (!--state_dump_signal_users) {
+        // Leave alone a handler the application installed over ours in the meantime
+        struct sigaction current;
+        if (sigaction(SIGUSR1, nullptr, &current) == 0 && (current.sa_flags & SA_SIGINFO) &&
+            current.sa_sigaction == requestStateDump) {
+            sigaction(SIGUSR1, &previous_sigusr1_action, nullptr);
+        }
+    }
+    dev_data->stateDumpOnSignal = false;
+#endif
+}
+
+// Append a snapshot of the tracked memory objects, resources and command buffers to the state dump file.
+//  Expects global_lock to be held exclusively.
+static void dump_layer_state(layer_data *dev_data, const char *reason) {
+    FILE *file = fopen(dev_data->stateDumpFile.c_str(), "a");
+    if (!file) {
+        log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
+                (uint64_t)dev_data->device, __LINE__, MEMTRACK_NONE, "MEM", "Cannot open state dump file %s for writing",
+                dev_data->stateDumpFile.c_str());
+        return;
+    }
+    fprintf(file, "==== core_validation state of device 0x%p at %s ====\n", (void *)dev_data->device, reason);
+
+    fprintf(file, "Memory objects: " PRINTF_SIZE_T_SPECIFIER "\n", dev_data->memObjMap.size());
+    for (auto &mem_entry : dev_data->memObjMap) {
+        auto mem_info = mem_entry.second.get();
+        fprintf(file, "  mem 0x%" PRIx64 ": size %" PRIu64 ", type %u, %s, %s\n", (uint64_t)mem_info->mem,
+                (uint64_t)mem_info->allocInfo.allocationSize, mem_info->allocInfo.memoryTypeIndex,
+                mem_info->valid ? "valid" : "not valid", (mem_info->pData || mem_info->shadow) ? "mapped" : "not mapped");
+        for (auto obj : mem_info->objBindings) {
+            fprintf(file, "    bound %s 0x%" PRIx64 "\n", object_type_to_string(obj.type), obj.handle);
+        }
+        for (auto cb : mem_info->commandBufferBindings) {
+            fprintf(file, "    used by CB 0x%p\n", (void *)cb);
+        }
+    }
+
+    fprintf(file, "Images: " PRINTF_SIZE_T_SPECIFIER "\n", dev_data->imageMap.size());
+    for (auto &image_entry : dev_data->imageMap) {
+        auto image_node = image_entry.second.get();
+        fprintf(file, "  image 0x%" PRIx64 ": %s %ux%ux%u, %u mips, %u layers, mem 0x%" PRIx64 " offset %" PRIu64 "\n",
+                (uint64_t)image_node->image, string_VkFormat(image_node->createInfo.format), image_node->createInfo.extent.width,
+                image_node->createInfo.extent.height, image_node->createInfo.extent.depth, image_node->createInfo.mipLevels,
+                image_node->createInfo.arrayLayers, (uint64_t)image_node->mem, (uint64_t)image_node->memOffset);
+    }
+
+    fprintf(file, "Buffers: " PRINTF_SIZE_T_SPECIFIER "\n", dev_data->bufferMap.size());
+    for (auto &buffer_entry : dev_data->bufferMap) {
+        auto buff_node = buffer_entry.second.get();
+        fprintf(file, "  buffer 0x%" PRIx64 ": size %" PRIu64 ", mem 0x%" PRIx64 " offset %" PRIu64 "\n",
+                (uint64_t)buff_node->buffer, (uint64_t)buff_node->createInfo.size, (uint64_t)buff_node->mem,
+                (uint64_t)buff_node->memOffset);
+    }
+
+    fprintf(file, "Command buffers: " PRINTF_SIZE_T_SPECIFIER "\n", dev_data->commandBufferMap.size());
+    for (auto &cb_entry : dev_data->commandBufferMap) {
+        auto pCB = cb_entry.second;
+        fprintf(file, "  CB 0x%p: %s %s, " PRINTF_SIZE_T_SPECIFIER " cmds, submitted %" PRIu64 " times, %s\n",
+                (void *)pCB->commandBuffer, pCB->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ? "primary" : "secondary",
+                cbStateToString(pCB->state), pCB->cmds.size(), pCB->submitCount, pCB->in_use.load() ? "in flight" : "idle");
+        for (auto mem : pCB->memObjs) {
+            fprintf(file, "    uses mem 0x%" PRIx64 "\n", (uint64_t)mem);
+        }
+    }
+    fprintf(file, "\n");
+    fclose(file);
+}
+
 // Return a string representation of CMD_TYPE enum
 static string cmdTypeToString(CMD_TYPE cmd) {
     switch (cmd) {
@@ -1345,18 +1751,6 @@ static unsigned get_locations_consumed_by_format(VkFormat format) {
     }
 }
 
-typedef std::pair<unsigned, unsigned> location_t;
-typedef std::pair<unsigned, unsigned> descriptor_slot_t;
-
-struct interface_var {
-    uint32_t id;
-    uint32_t type_id;
-    uint32_t offset;
-    bool is_patch;
-    bool is_block_member;
-    /* TODO: collect the name, too? Isn't required to be present. */
-};
-
 struct shader_stage_attributes {
     char const *const name;
     bool arrayed_input;
@@ -1574,17 +1968,28 @@ static void collect_interface_by_descriptor_slot(debug_report_data *report_data,
     }
 }
 
+static std::map<location_t, interface_var> const &get_interface_by_location(shader_module const *src, spirv_inst_iter entrypoint,
+                                                                          spv::StorageClass sinterface, bool is_array_of_verts) {
+    std::lock_guard<std::mutex> lock(src->analysis_lock);
+    auto &analysis = src->entrypoints[entrypoint.offset()];
+    unsigned is_output = sinterface == spv::StorageClassOutput;
+    if (!analysis.have_interface[is_output][is_array_of_verts]) {
+        collect_interface_by_location(src, entrypoint, sinterface, analysis.interface[is_output][is_array_of_verts],
+                                      is_array_of_verts);
+        analysis.have_interface[is_output][is_array_of_verts] = true;
+    }
+    return analysis.interface[is_output][is_array_of_verts];
+}
+
 static bool validate_interface_between_stages(debug_report_data *report_data, shader_module const *producer,
                                               spirv_inst_iter producer_entrypoint, shader_stage_attributes const *producer_stage,
                                               shader_module const *consumer, spirv_inst_iter consumer_entrypoint,
                                               shader_stage_attributes const *consumer_stage) {
-    std::map<location_t, interface_var> outputs;
-    std::map<location_t, interface_var> inputs;
-
     bool pass = true;
 
-    collect_interface_by_location(producer, producer_entrypoint, spv::StorageClassOutput, outputs, producer_stage->arrayed_output);
-    collect_interface_by_location(consumer, consumer_entrypoint, spv::StorageClassInput, inputs, consumer_stage->arrayed_input);
+    auto const &outputs =
+        get_interface_by_location(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
+    auto const &inputs = get_interface_by_location(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -1762,10 +2167,9 @@ static bool validate_vi_consistency(debug_report_data *report_data, VkPipelineVe
 
 static bool validate_vi_against_vs_inputs(debug_report_data *report_data, VkPipelineVertexInputStateCreateInfo const *vi,
                                           shader_module const *vs, spirv_inst_iter entrypoint) {
-    std::map<location_t, interface_var> inputs;
     bool pass = true;
 
-    collect_interface_by_location(vs, entrypoint, spv::StorageClassInput, inputs, false);
+    auto const &inputs = get_interface_by_location(vs, entrypoint, spv::StorageClassInput, false);
 
     /* Build index by location */
     std::map<uint32_t, VkVertexInputAttributeDescription const *> attribs;
@@ -1829,7 +2233,6 @@ static bool validate_vi_against_vs_inputs(debug_report_data *report_data, VkPipe
 static bool validate_fs_outputs_against_render_pass(debug_report_data *report_data, shader_module const *fs,
                                                     spirv_inst_iter entrypoint, VkRenderPassCreateInfo const *rpci,
                                                     uint32_t subpass_index) {
-    std::map<location_t, interface_var> outputs;
     std::map<uint32_t, VkFormat> color_attachments;
     auto subpass = rpci->pSubpasses[subpass_index];
     for (auto i = 0u; i < subpass.colorAttachmentCount; ++i) {
@@ -1845,7 +2248,7 @@ static bool validate_fs_outputs_against_render_pass(debug_report_data *report_da
 
     /* TODO: dual source blend index (spv::DecIndex, zero if not provided) */
 
-    collect_interface_by_location(fs, entrypoint, spv::StorageClassOutput, outputs, false);
+    auto const &outputs = get_interface_by_location(fs, entrypoint, spv::StorageClassOutput, false);
 
     auto it_a = outputs.begin();
     auto it_b = color_attachments.begin();
@@ -2096,7 +2499,7 @@ static VkDescriptorSetLayoutBinding const * get_descriptor_binding(PIPELINE_LAYO
 
 // Block of code at start here for managing/tracking Pipeline state that this layer cares about
 
-static uint64_t g_drawCount[NUM_DRAW_TYPES] = {0, 0, 0, 0};
+static std::atomic<uint64_t> g_drawCount[NUM_DRAW_TYPES] = {{0}, {0}, {0}, {0}};
 
 // TODO : Should be tracking lastBound per commandBuffer and when draws occur, report based on that cmd buffer lastBound
 //   Then need to synchronize the accesses based on cmd buffer so that if I'm reading state on one cmd buffer, updates
@@ -2610,7 +3013,7 @@ static bool validate_pipeline_shader_stage(debug_report_data *report_data,
                                            spirv_inst_iter *out_entrypoint,
                                            VkPhysicalDeviceFeatures const *enabledFeatures,
                                            std::unordered_map<VkShaderModule,
-                                           std::unique_ptr<shader_module>> const &shaderModuleMap) {
+                                           std::shared_ptr<shader_module>> const &shaderModuleMap) {
     bool pass = true;
     auto module_it = shaderModuleMap.find(pStage->module);
     auto module = *out_module = module_it->second.get();
@@ -2630,13 +3033,24 @@ static bool validate_pipeline_shader_stage(debug_report_data *report_data,
     /* validate shader capabilities against enabled device features */
     pass &= validate_shader_capabilities(report_data, module, enabledFeatures);
 
-    /* mark accessible ids */
-    std::unordered_set<uint32_t> accessible_ids;
-    mark_accessible_ids(module, entrypoint, accessible_ids);
+    /* nothing below can be checked without an entrypoint to walk from */
+    if (entrypoint == module->end()) {
+        return pass;
+    }
+
+    /* mark accessible ids, and collect the descriptor slots they use */
+    std::unique_lock<std::mutex> analysis_lock(module->analysis_lock);
+    auto &analysis = module->entrypoints[entrypoint.offset()];
+    if (!analysis.have_descriptor_uses) {
+        mark_accessible_ids(module, entrypoint, analysis.accessible_ids);
+        collect_interface_by_descriptor_slot(report_data, module, analysis.accessible_ids, analysis.descriptor_uses);
+        analysis.have_descriptor_uses = true;
+    }
+    analysis_lock.unlock();
+    auto const &accessible_ids = analysis.accessible_ids;
 
     /* validate descriptor set layout against what the entrypoint actually uses */
-    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
-    collect_interface_by_descriptor_slot(report_data, module, accessible_ids, descriptor_uses);
+    auto const &descriptor_uses = analysis.descriptor_uses;
 
     auto pipelineLayout = pipeline->pipeline_layout;
 
@@ -2698,7 +3112,7 @@ static bool validate_pipeline_shader_stage(debug_report_data *report_data,
 //  that are actually used by the pipeline into pPipeline->active_slots
 static bool validate_and_capture_pipeline_shader_state(debug_report_data *report_data, PIPELINE_NODE *pPipeline,
                                                        VkPhysicalDeviceFeatures const *enabledFeatures,
-                                                       std::unordered_map<VkShaderModule, unique_ptr<shader_module>> const & shaderModuleMap) {
+                                                       std::unordered_map<VkShaderModule, shared_ptr<shader_module>> const & shaderModuleMap) {
     auto pCreateInfo = pPipeline->graphicsPipelineCI.ptr();
     int vertex_stage = get_shader_stage_id(VK_SHADER_STAGE_VERTEX_BIT);
     int fragment_stage = get_shader_stage_id(VK_SHADER_STAGE_FRAGMENT_BIT);
@@ -2756,7 +3170,7 @@ static bool validate_and_capture_pipeline_shader_state(debug_report_data *report
 }
 
 static bool validate_compute_pipeline(debug_report_data *report_data, PIPELINE_NODE *pPipeline, VkPhysicalDeviceFeatures const *enabledFeatures,
-                                      std::unordered_map<VkShaderModule, unique_ptr<shader_module>> const & shaderModuleMap) {
+                                      std::unordered_map<VkShaderModule, shared_ptr<shader_module>> const & shaderModuleMap) {
     auto pCreateInfo = pPipeline->computePipelineCI.ptr();
 
     shader_module *module;
@@ -2780,24 +3194,27 @@ cvdescriptorset::DescriptorSet *getSetNode(const layer_data *my_data, VkDescript
 //     descriptor update must not overflow the size of its buffer being updated
 //  2. Grow updateImages for given pCB to include any bound STORAGE_IMAGE descriptor images
 //  3. Grow updateBuffers for pCB to include buffers from STORAGE*_BUFFER descriptor buffers
+//  Clears *all_valid if any set fails its draw-time checks
 static bool validate_and_update_drawtime_descriptor_state(
     layer_data *dev_data, GLOBAL_CB_NODE *pCB,
-    const vector<std::tuple<cvdescriptorset::DescriptorSet *, unordered_set<uint32_t>,
-                            std::vector<uint32_t> const *>> &activeSetBindingsPairs) {
+    const vector<std::tuple<cvdescriptorset::DescriptorSet *, unordered_set<uint32_t> const *,
+                            std::vector<uint32_t> const *>> &activeSetBindingsPairs,
+    bool *all_valid) {
     bool result = false;
     for (auto set_bindings_pair : activeSetBindingsPairs) {
         cvdescriptorset::DescriptorSet *set_node = std::get<0>(set_bindings_pair);
         std::string err_str;
-        if (!set_node->ValidateDrawState(std::get<1>(set_bindings_pair), *std::get<2>(set_bindings_pair),
+        if (!set_node->ValidateDrawState(*std::get<1>(set_bindings_pair), *std::get<2>(set_bindings_pair),
                                          &err_str)) {
             // Report error here
+            *all_valid = false;
             auto set = set_node->GetSet();
             result |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                               reinterpret_cast<const uint64_t &>(set), __LINE__, DRAWSTATE_DESCRIPTOR_SET_NOT_UPDATED, "DS",
                               "DS 0x%" PRIxLEAST64 " encountered the following validation error at draw time: %s",
                               reinterpret_cast<const uint64_t &>(set), err_str.c_str());
         }
-        set_node->GetStorageUpdates(std::get<1>(set_bindings_pair), &pCB->updateBuffers, &pCB->updateImages);
+        set_node->GetStorageUpdates(*std::get<1>(set_bindings_pair), &pCB->updateBuffers, &pCB->updateImages);
     }
     return result;
 }
@@ -2940,11 +3357,55 @@ static bool validatePipelineDrawtimeState(layer_data const *my_data,
     return skip_call;
 }
 
+// Unbind sets freed since they were bound. A pool reset releases its sets' memory in one go, and a new set may already
+//  occupy it under the same handle, so neither the pointer nor the handle identifies the bound set. The set found by
+//  handle in setMap must also have the allocation id recorded at bind time. Nothing is looked up unless some set, buffer
+//  or memory object has been destroyed since the last check.
+static void dropFreedBoundDescriptorSets(const layer_data *my_data, LAST_BOUND_STATE &state) {
+    if (state.boundSetsCheckedEpoch == my_data->descriptorResourceEpoch)
+        return;
+    for (size_t i = 0; i < state.boundDescriptorSets.size(); ++i) {
+        if (!state.boundDescriptorSets[i])
+            continue;
+        auto set = getSetNode(my_data, state.boundDescriptorSetHandles[i]);
+        if (!set || set->GetAllocationId() != state.boundDescriptorSetIds[i]) {
+            state.boundDescriptorSets[i] = nullptr;
+            state.descriptorsDirty = true;
+        }
+    }
+    state.boundSetsCheckedEpoch = my_data->descriptorResourceEpoch;
+}
+
+// True if the descriptor checks of validate_and_update_draw_state passed for an earlier draw and nothing they depend on has
+//  changed since: the pipeline, the bound sets and dynamic offsets, the contents of those sets, or the buffers and memory
+//  their descriptors refer to. Repeating them would then log nothing and record no new storage updates.
+static bool descriptorChecksUnchanged(const layer_data *my_data, const LAST_BOUND_STATE &state) {
+    if (state.descriptorsDirty || state.validatedResourceEpoch != my_data->descriptorResourceEpoch ||
+        state.validatedSetGenerations.size() != state.boundDescriptorSets.size())
+        return false;
+    for (size_t i = 0; i < state.boundDescriptorSets.size(); ++i) {
+        auto set = state.boundDescriptorSets[i];
+        if ((set ? set->generation : 0) != state.validatedSetGenerations[i])
+            return false;
+    }
+    return true;
+}
+
+static void recordDescriptorChecksClean(const layer_data *my_data, LAST_BOUND_STATE &state) {
+    state.validatedSetGenerations.resize(state.boundDescriptorSets.size());
+    for (size_t i = 0; i < state.boundDescriptorSets.size(); ++i) {
+        auto set = state.boundDescriptorSets[i];
+        state.validatedSetGenerations[i] = set ? set->generation : 0;
+    }
+    state.validatedResourceEpoch = my_data->descriptorResourceEpoch;
+    state.descriptorsDirty = false;
+}
+
 // Validate overall state at the time of a draw call
 static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *pCB, const bool indexedDraw,
                                            const VkPipelineBindPoint bindPoint) {
     bool result = false;
-    auto const &state = pCB->lastBound[bindPoint];
+    auto &state = pCB->lastBound[bindPoint];
     PIPELINE_NODE *pPipe = getPipeline(my_data, state.pipeline);
     if (nullptr == pPipe) {
         result |= log_msg(
@@ -2960,16 +3421,20 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
         result = validate_draw_state_flags(my_data, pCB, pPipe, indexedDraw);
 
     // Now complete other state checks
-    if (VK_NULL_HANDLE != state.pipeline_layout.layout) {
+    dropFreedBoundDescriptorSets(my_data, state);
+    if (VK_NULL_HANDLE != state.pipeline_layout.layout && !descriptorChecksUnchanged(my_data, state)) {
+        bool descriptors_valid = true;
         string errorString;
         auto pipeline_layout = pPipe->pipeline_layout;
 
         // Need a vector (vs. std::set) of active Sets for dynamicOffset validation in case same set bound w/ different offsets
-        vector<std::tuple<cvdescriptorset::DescriptorSet *, unordered_set<uint32_t>, std::vector<uint32_t> const *>> activeSetBindingsPairs;
+        vector<std::tuple<cvdescriptorset::DescriptorSet *, unordered_set<uint32_t> const *, std::vector<uint32_t> const *>>
+            activeSetBindingsPairs;
         for (auto & setBindingPair : pPipe->active_slots) {
             uint32_t setIndex = setBindingPair.first;
             // If valid set is not bound throw an error
             if ((state.boundDescriptorSets.size() <= setIndex) || (!state.boundDescriptorSets[setIndex])) {
+                descriptors_valid = false;
                 result |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                   DRAWSTATE_DESCRIPTOR_SET_NOT_BOUND, "DS",
                                   "VkPipeline 0x%" PRIxLEAST64 " uses set #%u but that set is not bound.", (uint64_t)pPipe->pipeline,
@@ -2978,6 +3443,7 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
                                                         errorString)) {
                 // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
                 VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
+                descriptors_valid = false;
                 result |=
                     log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                             (uint64_t)setHandle, __LINE__, DRAWSTATE_PIPELINE_LAYOUTS_INCOMPATIBLE, "DS",
@@ -2989,13 +3455,14 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
                 // Pull the set node
                 cvdescriptorset::DescriptorSet *pSet = state.boundDescriptorSets[setIndex];
                 // Save vector of all active sets to verify dynamicOffsets below
-                activeSetBindingsPairs.push_back(std::make_tuple(pSet, setBindingPair.second,
+                activeSetBindingsPairs.push_back(std::make_tuple(pSet, &setBindingPair.second,
                                                                  &state.dynamicOffsets[setIndex]));
                 // Make sure set has been updated if it has no immutable samplers
                 //  If it has immutable samplers, we'll flag error later as needed depending on binding
                 if (!pSet->IsUpdated()) {
                     for (auto binding : setBindingPair.second) {
                         if (!pSet->GetImmutableSamplerPtrFromBinding(binding)) {
+                            descriptors_valid = false;
                             result |= log_msg(
                                 my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                                 (uint64_t)pSet->GetSet(), __LINE__, DRAWSTATE_DESCRIPTOR_SET_NOT_UPDATED, "DS",
@@ -3008,7 +3475,10 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
             }
         }
         // For given active slots, verify any dynamic descriptors and record updated images & buffers
-        result |= validate_and_update_drawtime_descriptor_state(my_data, pCB, activeSetBindingsPairs);
+        result |= validate_and_update_drawtime_descriptor_state(my_data, pCB, activeSetBindingsPairs, &descriptors_valid);
+        // Only a clean pass is memoized, so that every draw with a problem still reports it
+        if (descriptors_valid)
+            recordDescriptorChecksClean(my_data, state);
     }
 
     // Check general pipeline state that needs to be validated at drawtime
@@ -3044,8 +3514,76 @@ static bool verifyLineWidth(layer_data *my_data, DRAW_STATE_ERROR dsError, const
 }
 
 // Verify that create state for a pipeline is valid
-static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device, std::vector<PIPELINE_NODE *> pPipelines,
-                                      int pipelineIndex) {
+// A message logged while validating a pipeline on a worker thread, kept to be reported from the calling thread
+struct deferred_log_msg {
+    VkFlags msgFlags;
+    VkDebugReportObjectTypeEXT objectType;
+    uint64_t srcObject;
+    size_t location;
+    int32_t msgCode;
+    std::string layerPrefix;
+    std::string msg;
+};
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL defer_log_msg(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType, uint64_t srcObject,
+                                                    size_t location, int32_t msgCode, const char *pLayerPrefix, const char *pMsg,
+                                                    void *pUserData) {
+    auto messages = static_cast<std::vector<deferred_log_msg> *>(pUserData);
+    messages->push_back({msgFlags, objType, srcObject, location, msgCode, pLayerPrefix, pMsg});
+    return VK_FALSE;
+}
+
+// Smallest vkCreateGraphicsPipelines batch whose shader validation is spread across threads
+static const uint32_t PARALLEL_PIPELINE_VALIDATION_MIN_COUNT = 16;
+
+// Runs validate_and_capture_pipeline_shader_state for every pipeline in the batch on a set of worker threads.
+//  It only reads shared state (the shader modules, layouts and device features), and each worker logs into its
+//  own capturing report data, so that messages[i] holds what pipeline i reported, for replay in order.
+static void validate_pipeline_shader_state_parallel(layer_data *dev_data, std::vector<PIPELINE_NODE *> const &pipelines,
+                                                    std::vector<std::vector<deferred_log_msg>> &messages) {
+    uint32_t count = static_cast<uint32_t>(pipelines.size());
+    messages.resize(count);
+    std::atomic<uint32_t> next_pipeline(0);
+    VkFlags active_flags = dev_data->report_data->active_flags;
+
+    std::function<void()> worker = [&]() {
+        VkLayerDbgFunctionNode capture;
+        memset(&capture, 0, sizeof(capture));
+        capture.pfnMsgCallback = defer_log_msg;
+        capture.msgFlags = active_flags;
+        debug_report_data report_data;
+        memset(&report_data, 0, sizeof(report_data));
+        report_data.debug_callback_list = &capture;
+        report_data.active_flags = capture.msgFlags;
+
+        for (uint32_t i = next_pipeline++; i < count; i = next_pipeline++) {
+            capture.pUserData = &messages[i];
+            validate_and_capture_pipeline_shader_state(&report_data, pipelines[i], &dev_data->phys_dev_properties.features,
+                                                       dev_data->shaderModuleMap);
+        }
+    };
+
+    // A few pipelines per thread at least, or handing them out costs more than it saves. If no worker can be started,
+    //  the calling thread validates the whole batch by itself.
+    uint32_t thread_count = std::min(std::max(std::thread::hardware_concurrency(), 1u), count / 4);
+    uint32_t helpers = 0;
+    if (thread_count > 1) {
+        if (!dev_data->shaderValidationPool) {
+            dev_data->shaderValidationPool.reset(new shader_validation_pool);
+        }
+        helpers = std::min(dev_data->shaderValidationPool->reserve(thread_count - 1), thread_count - 1);
+    }
+    if (helpers) {
+        dev_data->shaderValidationPool->run(worker, helpers);
+    } else {
+        worker();
+    }
+}
+
+// If deferred_shader_msgs is non-null, shader state was already validated by validate_pipeline_shader_state_parallel
+//  and these are the messages it produced for this pipeline
+static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device, std::vector<PIPELINE_NODE *> const &pPipelines,
+                                      int pipelineIndex, std::vector<deferred_log_msg> const *deferred_shader_msgs) {
     bool skip_call = false;
 
     PIPELINE_NODE *pPipeline = pPipelines[pipelineIndex];
@@ -3128,8 +3666,13 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
                              pPipeline->graphicsPipelineCI.subpass, renderPass->pCreateInfo->subpassCount - 1);
     }
 
-    if (!validate_and_capture_pipeline_shader_state(my_data->report_data, pPipeline, &my_data->phys_dev_properties.features,
-                                                    my_data->shaderModuleMap)) {
+    if (deferred_shader_msgs) {
+        for (auto const &msg : *deferred_shader_msgs) {
+            skip_call |= log_msg(my_data->report_data, msg.msgFlags, msg.objectType, msg.srcObject, msg.location, msg.msgCode,
+                                 msg.layerPrefix.c_str(), "%s", msg.msg.c_str());
+        }
+    } else if (!validate_and_capture_pipeline_shader_state(my_data->report_data, pPipeline,
+                                                           &my_data->phys_dev_properties.features, my_data->shaderModuleMap)) {
         skip_call = true;
     }
     // Each shader's stage must be unique
@@ -3346,193 +3889,65 @@ static bool validateUpdateConsistency(layer_data *my_data, const VkDevice device
     }
     return skip_call;
 }
-//TODO: Consolidate functions
-bool FindLayout(const GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, IMAGE_CMD_BUF_LAYOUT_NODE &node, const VkImageAspectFlags aspectMask) {
-    layer_data *my_data = get_my_data_ptr(get_dispatch_key(pCB->commandBuffer), layer_data_map);
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = pCB->imageLayoutMap.find(imgpair);
-    if (imgsubIt == pCB->imageLayoutMap.end()) {
-        return false;
-    }
-    if (node.layout != VK_IMAGE_LAYOUT_MAX_ENUM && node.layout != imgsubIt->second.layout) {
-        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t&>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple layout types: %s and %s",
-                reinterpret_cast<uint64_t&>(imgpair.image), oldAspectMask, string_VkImageLayout(node.layout), string_VkImageLayout(imgsubIt->second.layout));
-    }
-    if (node.initialLayout != VK_IMAGE_LAYOUT_MAX_ENUM && node.initialLayout != imgsubIt->second.initialLayout) {
-        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t&>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple initial layout types: %s and %s",
-                reinterpret_cast<uint64_t&>(imgpair.image), oldAspectMask, string_VkImageLayout(node.initialLayout), string_VkImageLayout(imgsubIt->second.initialLayout));
-    }
-    node = imgsubIt->second;
-    return true;
-}
-
-bool FindLayout(const layer_data *my_data, ImageSubresourcePair imgpair, VkImageLayout &layout, const VkImageAspectFlags aspectMask) {
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = my_data->imageLayoutMap.find(imgpair);
-    if (imgsubIt == my_data->imageLayoutMap.end()) {
-        return false;
-    }
-    if (layout != VK_IMAGE_LAYOUT_MAX_ENUM && layout != imgsubIt->second.layout) {
-        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t&>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple layout types: %s and %s",
-                reinterpret_cast<uint64_t&>(imgpair.image), oldAspectMask, string_VkImageLayout(layout), string_VkImageLayout(imgsubIt->second.layout));
-    }
-    layout = imgsubIt->second.layout;
-    return true;
-}
-
-// find layout(s) on the cmd buf level
-bool FindLayout(const GLOBAL_CB_NODE *pCB, VkImage image, VkImageSubresource range, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    node = IMAGE_CMD_BUF_LAYOUT_NODE(VK_IMAGE_LAYOUT_MAX_ENUM, VK_IMAGE_LAYOUT_MAX_ENUM);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (node.layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {image, false, VkImageSubresource()};
-        auto imgsubIt = pCB->imageLayoutMap.find(imgpair);
-        if (imgsubIt == pCB->imageLayoutMap.end())
-            return false;
-        node = imgsubIt->second;
-    }
-    return true;
+// Aspects an image's layouts are tracked for at the global level, from its format
+static VkImageAspectFlags GetImageAspects(VkFormat format) {
+    if (vk_format_is_depth_and_stencil(format))
+        return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+    if (vk_format_is_depth_only(format))
+        return VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (vk_format_is_stencil_only(format))
+        return VK_IMAGE_ASPECT_STENCIL_BIT;
+    return VK_IMAGE_ASPECT_COLOR_BIT;
 }
 
-// find layout(s) on the global level
-bool FindLayout(const layer_data *my_data, ImageSubresourcePair imgpair, VkImageLayout &layout) {
-    layout = VK_IMAGE_LAYOUT_MAX_ENUM;
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {imgpair.image, false, VkImageSubresource()};
-        auto imgsubIt = my_data->imageLayoutMap.find(imgpair);
-        if (imgsubIt == my_data->imageLayoutMap.end())
-            return false;
-        layout = imgsubIt->second.layout;
-    }
-    return true;
-}
-
-bool FindLayout(const layer_data *my_data, VkImage image, VkImageSubresource range, VkImageLayout &layout) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    return FindLayout(my_data, imgpair, layout);
+// Start global layout tracking for a new image, with every subresource in layout
+static void InitImageLayouts(layer_data *my_data, VkImage image, const VkImageCreateInfo *pCreateInfo, VkImageLayout layout) {
+    IMAGE_LAYOUT_MAP<VkImageLayout> layout_map(pCreateInfo->mipLevels, pCreateInfo->arrayLayers);
+    VkImageSubresourceRange range = {GetImageAspects(pCreateInfo->format), 0, VK_REMAINING_MIP_LEVELS, 0,
+                                     VK_REMAINING_ARRAY_LAYERS};
+    layout_map.set(range, layout);
+    layout_map.version = ++my_data->imageLayoutVersion;
+    my_data->imageLayoutMap[image] = std::move(layout_map);
 }
 
+// Collect the distinct layouts the subresources of image are in at the global level
 bool FindLayouts(const layer_data *my_data, VkImage image, std::vector<VkImageLayout> &layouts) {
-    auto sub_data = my_data->imageSubresourceMap.find(image);
-    if (sub_data == my_data->imageSubresourceMap.end())
-        return false;
-    auto img_node = getImageNode(my_data, image);
-    if (!img_node)
+    auto layout_map = my_data->imageLayoutMap.find(image);
+    if (layout_map == my_data->imageLayoutMap.end())
         return false;
-    bool ignoreGlobal = false;
-    // TODO: Make this robust for >1 aspect mask. Now it will just say ignore
-    // potential errors in this case.
-    if (sub_data->second.size() >= (img_node->createInfo.arrayLayers * img_node->createInfo.mipLevels + 1)) {
-        ignoreGlobal = true;
-    }
-    for (auto imgsubpair : sub_data->second) {
-        if (ignoreGlobal && !imgsubpair.hasSubresource)
-            continue;
-        auto img_data = my_data->imageLayoutMap.find(imgsubpair);
-        if (img_data != my_data->imageLayoutMap.end()) {
-            layouts.push_back(img_data->second.layout);
+    layout_map->second.runs.for_each([&](uint64_t, uint64_t, VkImageLayout layout) {
+        if (std::find(layouts.begin(), layouts.end(), layout) == layouts.end()) {
+            layouts.push_back(layout);
         }
-    }
+    });
     return true;
 }
 
-// Set the layout on the global level
-void SetLayout(layer_data *my_data, ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    VkImage &image = imgpair.image;
-    // TODO (mlentine): Maybe set format if new? Not used atm.
-    my_data->imageLayoutMap[imgpair].layout = layout;
-    // TODO (mlentine): Maybe make vector a set?
-    auto subresource = std::find(my_data->imageSubresourceMap[image].begin(), my_data->imageSubresourceMap[image].end(), imgpair);
-    if (subresource == my_data->imageSubresourceMap[image].end()) {
-        my_data->imageSubresourceMap[image].push_back(imgpair);
-    }
-}
-
-// Set the layout on the cmdbuf level
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
-    pCB->imageLayoutMap[imgpair] = node;
-    // TODO (mlentine): Maybe make vector a set?
-    auto subresource =
-        std::find(pCB->imageSubresourceMap[imgpair.image].begin(), pCB->imageSubresourceMap[imgpair.image].end(), imgpair);
-    if (subresource == pCB->imageSubresourceMap[imgpair.image].end()) {
-        pCB->imageSubresourceMap[imgpair.image].push_back(imgpair);
-    }
-}
-
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    // TODO (mlentine): Maybe make vector a set?
-    if (std::find(pCB->imageSubresourceMap[imgpair.image].begin(), pCB->imageSubresourceMap[imgpair.image].end(), imgpair) !=
-        pCB->imageSubresourceMap[imgpair.image].end()) {
-        pCB->imageLayoutMap[imgpair].layout = layout;
-    } else {
-        // TODO (mlentine): Could be expensive and might need to be removed.
-        assert(imgpair.hasSubresource);
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindLayout(pCB, imgpair.image, imgpair.subresource, node)) {
-            node.initialLayout = layout;
-        }
-        SetLayout(pCB, imgpair, {node.initialLayout, layout});
-    }
-}
-
-template <class OBJECT, class LAYOUT>
-void SetLayout(OBJECT *pObject, ImageSubresourcePair imgpair, const LAYOUT &layout, VkImageAspectFlags aspectMask) {
-    if (imgpair.subresource.aspectMask & aspectMask) {
-        imgpair.subresource.aspectMask = aspectMask;
-        SetLayout(pObject, imgpair, layout);
-    }
-}
-
-template <class OBJECT, class LAYOUT>
-void SetLayout(OBJECT *pObject, VkImage image, VkImageSubresource range, const LAYOUT &layout) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-}
-
-template <class OBJECT, class LAYOUT> void SetLayout(OBJECT *pObject, VkImage image, const LAYOUT &layout) {
-    ImageSubresourcePair imgpair = {image, false, VkImageSubresource()};
-    SetLayout(pObject, image, imgpair, layout);
+// Return the cmd buffer level layout map for image, creating an empty one on first use.
+// Returns nullptr if the image is unknown.
+static IMAGE_LAYOUT_MAP<IMAGE_CMD_BUF_LAYOUT_NODE> *GetCBLayoutMap(const layer_data *dev_data, GLOBAL_CB_NODE *pCB,
+                                                                   VkImage image) {
+    auto layout_map = pCB->imageLayoutMap.find(image);
+    if (layout_map != pCB->imageLayoutMap.end())
+        return &layout_map->second;
+    auto image_node = getImageNode(dev_data, image);
+    if (!image_node)
+        return nullptr;
+    IMAGE_LAYOUT_MAP<IMAGE_CMD_BUF_LAYOUT_NODE> new_map(image_node->createInfo.mipLevels, image_node->createInfo.arrayLayers);
+    return &pCB->imageLayoutMap.insert(std::make_pair(image, std::move(new_map))).first->second;
 }
 
+// Set the layout on the cmdbuf level for every subresource of imageView. Subresources used for the
+// first time in this cmd buffer also take layout as their initial layout.
 void SetLayout(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, VkImageView imageView, const VkImageLayout &layout) {
     auto iv_data = getImageViewData(dev_data, imageView);
     assert(iv_data);
-    const VkImage &image = iv_data->image;
-    const VkImageSubresourceRange &subRange = iv_data->subresourceRange;
-    // TODO: Do not iterate over every possibility - consolidate where possible
-    for (uint32_t j = 0; j < subRange.levelCount; j++) {
-        uint32_t level = subRange.baseMipLevel + j;
-        for (uint32_t k = 0; k < subRange.layerCount; k++) {
-            uint32_t layer = subRange.baseArrayLayer + k;
-            VkImageSubresource sub = {subRange.aspectMask, level, layer};
-            SetLayout(pCB, image, sub, layout);
-        }
-    }
+    auto layout_map = GetCBLayoutMap(dev_data, pCB, iv_data->image);
+    if (!layout_map)
+        return;
+    layout_map->update(iv_data->subresourceRange, [&](const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+        return IMAGE_CMD_BUF_LAYOUT_NODE(node ? node->initialLayout : layout, layout);
+    });
 }
 
 // Validate that given set is valid and that it's not being used by an in-flight CmdBuffer
@@ -3558,10 +3973,39 @@ static bool validateIdleDescriptorSet(const layer_data *my_data, VkDescriptorSet
     return skip_call;
 }
 
-// Remove set from setMap and delete the set
-static void freeDescriptorSet(layer_data *dev_data, cvdescriptorset::DescriptorSet *descriptor_set) {
+// Remove set from setMap and destroy the set
+//  A set constructed in its pool's arena is not deleted, as its memory goes back to the arena when the pool is reset
+static void freeDescriptorSet(layer_data *dev_data, DESCRIPTOR_POOL_NODE *pool, cvdescriptorset::DescriptorSet *descriptor_set) {
     dev_data->setMap.erase(descriptor_set->GetSet());
-    delete descriptor_set;
+    dev_data->descriptorResourceEpoch++;
+    if (pool->setArena) {
+        descriptor_set->~DescriptorSet();
+    } else {
+        delete descriptor_set;
+    }
+}
+// Remove all of the pool's sets from setMap and free them. If the pool itself is being destroyed, its arena goes with it
+//  and is not readied for reuse.
+static void freePoolDescriptorSets(layer_data *dev_data, DESCRIPTOR_POOL_NODE *pool, bool destroying_pool) {
+    if (pool->setArena) {
+        // Everything the sets hold is in the arena, so rather than destroy each set, release the arena in one go.
+        //  Bound command buffers find the sets gone from setMap once the generation has moved on.
+        for (auto ds : pool->sets) {
+            dev_data->setMap.erase(ds->GetSet());
+        }
+        // The set container's own storage is in the arena too, so it must go before the arena is reset
+        pool_unordered_set<cvdescriptorset::DescriptorSet *>(pool->sets.get_allocator()).swap(pool->sets);
+        if (!destroying_pool) {
+            pool->setArena->reset();
+        }
+        newObjectGeneration();
+        dev_data->descriptorResourceEpoch++;
+    } else {
+        for (auto ds : pool->sets) {
+            freeDescriptorSet(dev_data, pool, ds);
+        }
+        pool->sets.clear();
+    }
 }
 // Free all DS Pools including their Sets & related sub-structs
 // NOTE : Calls to this function should be wrapped in mutex
@@ -3569,11 +4013,9 @@ static void deletePools(layer_data *my_data) {
     if (my_data->descriptorPoolMap.size() <= 0)
         return;
     for (auto ii = my_data->descriptorPoolMap.begin(); ii != my_data->descriptorPoolMap.end(); ++ii) {
-        // Remove this pools' sets from setMap and delete them
-        for (auto ds : (*ii).second->sets) {
-            freeDescriptorSet(my_data, ds);
-        }
-        (*ii).second->sets.clear();
+        // Remove this pools' sets from setMap and free them
+        freePoolDescriptorSets(my_data, (*ii).second, true);
+        delete (*ii).second;
     }
     my_data->descriptorPoolMap.clear();
 }
@@ -3583,10 +4025,7 @@ static void clearDescriptorPool(layer_data *my_data, const VkDevice device, cons
     DESCRIPTOR_POOL_NODE *pPool = getPoolNode(my_data, pool);
     // TODO: validate flags
     // For every set off of this pool, clear it, remove from setMap, and free cvdescriptorset::DescriptorSet
-    for (auto ds : pPool->sets) {
-        freeDescriptorSet(my_data, ds);
-    }
-    pPool->sets.clear();
+    freePoolDescriptorSets(my_data, pPool, false);
     // Reset available count for each type and available sets for this pool
     for (uint32_t i = 0; i < pPool->availableDescriptorTypeCount.size(); ++i) {
         pPool->availableDescriptorTypeCount[i] = pPool->maxDescriptorTypeCount[i];
@@ -3741,49 +4180,52 @@ static bool addCmd(layer_data *my_data, GLOBAL_CB_NODE *pCB, const CMD_TYPE cmd,
     }
     return skip_call;
 }
-// Tie the VK_OBJECT to the cmd buffer which includes:
-//  Add object_binding to cmd buffer
-//  Add cb_binding to object
-static void addCommandBufferBinding(std::unordered_set<GLOBAL_CB_NODE *> *cb_bindings, VK_OBJECT obj, GLOBAL_CB_NODE *cb_node) {
-    cb_bindings->insert(cb_node);
-    cb_node->object_bindings.insert(obj);
-}
-// For a given object, if cb_node is in that objects cb_bindings, remove cb_node
-static void removeCommandBufferBinding(layer_data *dev_data, VK_OBJECT const *object, GLOBAL_CB_NODE *cb_node) {
-    switch (object->type) {
-    case VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT: {
-        auto img_node = getImageNode(dev_data, reinterpret_cast<const VkImage &>(object->handle));
-        if (img_node)
-            img_node->cb_bindings.erase(cb_node);
+// Return the generation of the object obj refers to, or 0 if it has been destroyed
+static uint64_t getObjectGeneration(layer_data *dev_data, VK_OBJECT const &obj) {
+    BASE_NODE *node = nullptr;
+    switch (obj.type) {
+    case VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT:
+        node = getImageNode(dev_data, reinterpret_cast<const VkImage &>(obj.handle));
         break;
-    }
-    case VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT: {
-        auto buf_node = getBufferNode(dev_data, reinterpret_cast<const VkBuffer &>(object->handle));
-        if (buf_node)
-            buf_node->cb_bindings.erase(cb_node);
+    case VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT:
+        node = getBufferNode(dev_data, reinterpret_cast<const VkBuffer &>(obj.handle));
         break;
-    }
-    case VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT: {
-        auto evt_node = getEventNode(dev_data, reinterpret_cast<const VkEvent &>(object->handle));
-        if (evt_node)
-            evt_node->cb_bindings.erase(cb_node);
+    case VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT:
+        node = getEventNode(dev_data, reinterpret_cast<const VkEvent &>(obj.handle));
         break;
-    }
-    case VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT: {
-        auto qp_node = getQueryPoolNode(dev_data, reinterpret_cast<const VkQueryPool &>(object->handle));
-        if (qp_node)
-            qp_node->cb_bindings.erase(cb_node);
+    case VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT:
+        node = getQueryPoolNode(dev_data, reinterpret_cast<const VkQueryPool &>(obj.handle));
         break;
-    }
-    case VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT: {
-        auto pipe_node = getPipeline(dev_data, reinterpret_cast<const VkPipeline &>(object->handle));
-        if (pipe_node)
-            pipe_node->cb_bindings.erase(cb_node);
+    case VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT:
+        node = getPipeline(dev_data, reinterpret_cast<const VkPipeline &>(obj.handle));
+        break;
+    case VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT:
+        node = getSetNode(dev_data, reinterpret_cast<const VkDescriptorSet &>(obj.handle));
+        break;
+    case VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT:
+        node = getFramebuffer(dev_data, reinterpret_cast<const VkFramebuffer &>(obj.handle));
         break;
-    }
     default:
         assert(0); // unhandled object type
     }
+    return node ? node->generation : 0;
+}
+// Move pCB to CB_INVALID if any object it has bound was destroyed, or changed in a way that invalidates
+//  it, since it was bound. Nothing is looked up unless some object has changed since the last call.
+static void updateCmdBufferBindingState(layer_data *dev_data, GLOBAL_CB_NODE *pCB) {
+    uint64_t current = objectGenerationCounter().load();
+    if (pCB->bindingsCheckedGeneration == current)
+        return;
+    for (auto const &binding : pCB->object_bindings) {
+        if (getObjectGeneration(dev_data, binding.first) != binding.second) {
+            pCB->state = CB_INVALID;
+            if (std::find(pCB->broken_bindings.begin(), pCB->broken_bindings.end(), binding.first) ==
+                pCB->broken_bindings.end()) {
+                pCB->broken_bindings.push_back(binding.first);
+            }
+        }
+    }
+    pCB->bindingsCheckedGeneration = current;
 }
 // Reset the command buffer state
 //  Maintain the createInfo and set state to CB_NEW, but clear all other state
@@ -3805,10 +4247,6 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         pCB->scissors.clear();
 
         for (uint32_t i = 0; i < VK_PIPELINE_BIND_POINT_RANGE_SIZE; ++i) {
-            // Before clearing lastBoundState, remove any CB bindings from all uniqueBoundSets
-            for (auto set : pCB->lastBound[i].uniqueBoundSets) {
-                set->RemoveBoundCommandBuffer(pCB);
-            }
             pCB->lastBound[i].reset();
         }
 
@@ -3824,7 +4262,6 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         pCB->queryToStateMap.clear();
         pCB->activeQueries.clear();
         pCB->startedQueries.clear();
-        pCB->imageSubresourceMap.clear();
         pCB->imageLayoutMap.clear();
         pCB->eventToStageMap.clear();
         pCB->drawData.clear();
@@ -3840,17 +4277,9 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         clear_cmd_buf_and_mem_references(dev_data, pCB);
         pCB->eventUpdates.clear();
         pCB->queryUpdates.clear();
-
-        // Remove object bindings
-        for (auto obj : pCB->object_bindings) {
-            removeCommandBufferBinding(dev_data, &obj, pCB);
-        }
-        // Remove this cmdBuffer's reference from each FrameBuffer's CB ref list
-        for (auto framebuffer : pCB->framebuffers) {
-            auto fb_node = getFramebuffer(dev_data, framebuffer);
-            if (fb_node)
-                fb_node->cb_bindings.erase(pCB);
-        }
+        pCB->submitCache.reset();
+        pCB->object_bindings.clear();
+        pCB->bindingsCheckedGeneration = 0;
         pCB->framebuffers.clear();
         pCB->activeFramebuffer = VK_NULL_HANDLE;
     }
@@ -4025,7 +4454,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     pTable->DestroyInstance(instance, pAllocator);
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
+    // Deliver queued messages before the callbacks that would receive them are removed
+    layer_debug_report_disable_async(my_data->report_data);
+
     // Clean up logging callback, if any
     while (my_data->logging_callback.size() > 0) {
         VkDebugReportCallbackEXT callback = my_data->logging_callback.back();
@@ -4122,6 +4554,10 @@ static bool ValidateRequestedFeatures(layer_data *dev_data, const VkPhysicalDevi
     return skip_call;
 }
 
+// prototypes
+static const size_t SHADER_CACHE_DEFAULT_MAX_ENTRIES = 1024;
+static void load_shader_cache(layer_data *);
+static void save_shader_cache(layer_data *);
 VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
                                             const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
     layer_data *my_instance_data = get_my_data_ptr(get_dispatch_key(gpu), layer_data_map);
@@ -4151,7 +4587,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         return result;
     }
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(*pDevice), layer_data_map);
 
     // Setup device dispatch table
@@ -4176,6 +4612,16 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     }
     // Store physical device mem limits into device layer_data struct
     my_instance_data->instance_dispatch_table->GetPhysicalDeviceMemoryProperties(gpu, &my_device_data->phys_dev_mem_props);
+    my_device_data->shaderCacheFile = getLayerOption("lunarg_core_validation.shader_cache_file");
+    const char *shader_cache_max_entries = getLayerOption("lunarg_core_validation.shader_cache_max_entries");
+    my_device_data->shaderCacheMaxEntries =
+        *shader_cache_max_entries ? strtoul(shader_cache_max_entries, NULL, 10) : SHADER_CACHE_DEFAULT_MAX_ENTRIES;
+    if (!my_device_data->shaderCacheFile.empty()) {
+        load_shader_cache(my_device_data);
+    }
+    init_state_dump(my_device_data);
+    my_device_data->noncoherentGuardPages =
+        !strcmp(getLayerOption("lunarg_core_validation.noncoherent_shadow"), "guard_pages");
     lock.unlock();
 
     ValidateLayerOrdering(*pCreateInfo);
@@ -4190,7 +4636,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dispatch_key key = get_dispatch_key(device);
     layer_data *dev_data = get_my_data_ptr(key, layer_data_map);
     // Free all the memory
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
+    if (!dev_data->stateDumpFile.empty()) {
+        dump_layer_state(dev_data, "vkDestroyDevice");
+    }
+    finish_state_dump(dev_data);
     deletePipelines(dev_data);
     deleteRenderPasses(dev_data);
     deleteCommandBuffers(dev_data);
@@ -4204,12 +4654,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->descriptorSetLayoutMap.clear();
     dev_data->imageViewMap.clear();
     dev_data->imageMap.clear();
-    dev_data->imageSubresourceMap.clear();
     dev_data->imageLayoutMap.clear();
     dev_data->bufferViewMap.clear();
     dev_data->bufferMap.clear();
     // Queues persist until device is destroyed
     dev_data->queueMap.clear();
+    if (!dev_data->shaderCacheFile.empty()) {
+        save_shader_cache(dev_data);
+    }
+    dev_data->shaderModuleMap.clear();
+    dev_data->shaderModuleCache.clear();
+    dev_data->shaderCacheRecords.clear();
     lock.unlock();
 #if MTMERGESOURCE
     bool skip_call = false;
@@ -4246,54 +4701,177 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     if (!skip_call) {
         pDisp->DestroyDevice(device, pAllocator);
     }
-#else
-    dev_data->device_dispatch_table->DestroyDevice(device, pAllocator);
-#endif
-    delete dev_data->device_dispatch_table;
-    layer_data_map.erase(key);
+#else
+    dev_data->device_dispatch_table->DestroyDevice(device, pAllocator);
+#endif
+    dev_data->shaderValidationPool.reset();
+    delete dev_data->device_dispatch_table;
+    layer_data_map.erase(key);
+}
+
+static const VkExtensionProperties instance_extensions[] = {{VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_REPORT_SPEC_VERSION}};
+
+bool setEventStageMask(VkQueue, VkCommandBuffer, VkEvent, VkPipelineStageFlags);
+bool validateEventStageMask(VkQueue, GLOBAL_CB_NODE *, uint32_t, size_t, VkPipelineStageFlags);
+bool setQueryState(VkQueue, VkCommandBuffer, QueryObject, bool);
+bool validateQuery(VkQueue, VkCommandBuffer, VkQueryPool, uint32_t, uint32_t);
+
+// Distinct buffers used by the draws recorded in pCB, so that submit and retire visit each buffer
+// once however many draws use it
+static const std::vector<VkBuffer> &GetDrawBuffers(GLOBAL_CB_NODE *pCB) {
+    CB_SUBMIT_CACHE &cache = pCB->submitCache;
+    if (cache.drawDataCount != pCB->drawData.size()) {
+        std::unordered_set<VkBuffer> seen;
+        cache.drawBuffers.clear();
+        for (const auto &draw_data : pCB->drawData) {
+            for (auto buffer : draw_data.buffers) {
+                if (seen.insert(buffer).second)
+                    cache.drawBuffers.push_back(buffer);
+            }
+        }
+        cache.drawDataCount = pCB->drawData.size();
+    }
+    return cache.drawBuffers;
+}
+
+// The memory checks recorded in pCB with the same outcome at submit but one entry per memory object:
+// the first read of each object made before pCB writes it, then the last validity pCB writes to it.
+// A read after pCB's own write sees that write, so it can only fail if the write made the memory
+// undefined; command buffers that do that replay their checks in full.
+static const std::vector<CB_DEFERRED_CHECK> &GetReducedMemoryChecks(GLOBAL_CB_NODE *pCB) {
+    CB_SUBMIT_CACHE &cache = pCB->submitCache;
+    if (cache.memoryCheckCount != pCB->memoryChecks.size()) {
+        static const size_t not_written = SIZE_MAX;
+        // Memory object (or swapchain image) to the index of its last write in writes
+        std::map<std::pair<VkDeviceMemory, VkImage>, size_t> targets;
+        std::vector<CB_DEFERRED_CHECK> writes;
+        cache.memoryChecks.clear();
+        cache.memoryChecksReducible = true;
+        for (const auto &check : pCB->memoryChecks) {
+            VkImage image = (check.memory.mem == MEMTRACKER_SWAP_CHAIN_IMAGE_KEY) ? check.memory.image : VK_NULL_HANDLE;
+            auto target = targets.insert(std::make_pair(std::make_pair(check.memory.mem, image), not_written));
+            size_t &last_write = target.first->second;
+            if (check.op == CB_DEFERRED_VALIDATE_MEMORY) {
+                if (target.second) {
+                    cache.memoryChecks.push_back(check);
+                } else if (last_write != not_written && writes[last_write].op == CB_DEFERRED_SET_MEMORY_INVALID) {
+                    cache.memoryChecksReducible = false;
+                    break;
+                }
+            } else if (last_write == not_written) {
+                last_write = writes.size();
+                writes.push_back(check);
+            } else {
+                writes[last_write].op = check.op;
+            }
+        }
+        cache.memoryChecks.insert(cache.memoryChecks.end(), writes.begin(), writes.end());
+        cache.memoryCheckCount = pCB->memoryChecks.size();
+    }
+    return cache.memoryChecksReducible ? cache.memoryChecks : pCB->memoryChecks;
+}
+
+// Run the work pCB deferred to submit time while it was recorded
+static bool RunDeferredChecks(layer_data *dev_data, VkQueue queue, GLOBAL_CB_NODE *pCB,
+                              const std::vector<CB_DEFERRED_CHECK> &checks) {
+    bool skip_call = false;
+    for (const auto &check : checks) {
+        switch (check.op) {
+        case CB_DEFERRED_VALIDATE_MEMORY:
+            skip_call |= validate_memory_is_valid(dev_data, check.memory.mem, check.memory.func_name, check.memory.image);
+            break;
+        case CB_DEFERRED_SET_MEMORY_VALID:
+            set_memory_valid(dev_data, check.memory.mem, true, check.memory.image);
+            break;
+        case CB_DEFERRED_SET_MEMORY_INVALID:
+            set_memory_valid(dev_data, check.memory.mem, false, check.memory.image);
+            break;
+        case CB_DEFERRED_SET_EVENT:
+            skip_call |= setEventStageMask(queue, check.event.commandBuffer, check.event.event, check.event.stageMask);
+            break;
+        case CB_DEFERRED_WAIT_EVENTS:
+            skip_call |= validateEventStageMask(queue, pCB, check.wait_events.eventCount, check.wait_events.firstEventIndex,
+                                                check.wait_events.sourceStageMask);
+            break;
+        case CB_DEFERRED_SET_QUERY:
+            skip_call |= setQueryState(queue, check.query.commandBuffer, check.query.object, check.query.available);
+            break;
+        case CB_DEFERRED_VALIDATE_QUERY:
+            skip_call |= validateQuery(queue, check.query_range.commandBuffer, check.query_range.queryPool,
+                                       check.query_range.queryCount, check.query_range.firstQuery);
+            break;
+        }
+    }
+    return skip_call;
 }
 
-static const VkExtensionProperties instance_extensions[] = {{VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_REPORT_SPEC_VERSION}};
+// True if the global layouts of every image pCB uses are unchanged since a submit of pCB that found
+// them all as expected and left them as they were, in which case checking them again would pass
+// and carrying pCB's final layouts over would change nothing
+static bool ImageLayoutsUnchangedSinceSubmit(const layer_data *dev_data, const GLOBAL_CB_NODE *pCB) {
+    const auto &versions = pCB->submitCache.imageLayoutVersions;
+    if (pCB->state != CB_RECORDED || versions.empty())
+        return false;
+    for (const auto &image_version : versions) {
+        auto global_map = dev_data->imageLayoutMap.find(image_version.first);
+        if (global_map == dev_data->imageLayoutMap.end() || global_map->second.version != image_version.second)
+            return false;
+    }
+    return true;
+}
 
 // This validates that the initial layout specified in the command buffer for
 // the IMAGE is the same
 // as the global IMAGE layout
 static bool ValidateCmdBufImageLayouts(layer_data *dev_data, GLOBAL_CB_NODE *pCB) {
     bool skip_call = false;
-    for (auto cb_image_data : pCB->imageLayoutMap) {
-        VkImageLayout imageLayout;
-        if (!FindLayout(dev_data, cb_image_data.first, imageLayout)) {
+    if (ImageLayoutsUnchangedSinceSubmit(dev_data, pCB))
+        return skip_call;
+    auto &versions = pCB->submitCache.imageLayoutVersions;
+    bool unchanged = true;
+    versions.clear();
+    for (auto &cb_image_data : pCB->imageLayoutMap) {
+        const VkImage image = cb_image_data.first;
+        auto global_map = dev_data->imageLayoutMap.find(image);
+        if (global_map == dev_data->imageLayoutMap.end()) {
+            unchanged = false;
             skip_call |=
                 log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
                         __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot submit cmd buffer using deleted image 0x%" PRIx64 ".",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first));
-        } else {
-            if (cb_image_data.second.initialLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (imageLayout != cb_image_data.second.initialLayout) {
-                if (cb_image_data.first.hasSubresource) {
+                        reinterpret_cast<const uint64_t &>(image));
+            continue;
+        }
+        auto &image_layouts = global_map->second;
+        // Compare each run of the cmd buffer's first-use layouts against the runs of the current
+        // global layouts it overlaps, then carry the cmd buffer's final layouts over.
+        cb_image_data.second.runs.for_each([&](uint64_t begin, uint64_t end, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+            if (node.initialLayout != VK_IMAGE_LAYOUT_UNDEFINED) {
+                // TODO: Set memory invalid for UNDEFINED, which is in mem_tracker currently
+                image_layouts.runs.for_each(begin, end, [&](uint64_t piece_begin, uint64_t, const VkImageLayout *imageLayout) {
+                    if (!imageLayout || *imageLayout == node.initialLayout)
+                        return;
+                    unchanged = false;
+                    VkImageSubresource sub = image_layouts.subresource(piece_begin);
                     skip_call |= log_msg(
                         dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                         reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
                         "Cannot submit cmd buffer using image (0x%" PRIx64 ") [sub-resource: aspectMask 0x%X array layer %u, mip level %u], "
                         "with layout %s when first use is %s.",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first.image), cb_image_data.first.subresource.aspectMask,
-                                cb_image_data.first.subresource.arrayLayer,
-                                cb_image_data.first.subresource.mipLevel, string_VkImageLayout(imageLayout),
-                        string_VkImageLayout(cb_image_data.second.initialLayout));
-                } else {
-                    skip_call |= log_msg(
-                        dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                        reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
-                        "Cannot submit cmd buffer using image (0x%" PRIx64 ") with layout %s when "
-                        "first use is %s.",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first.image), string_VkImageLayout(imageLayout),
-                        string_VkImageLayout(cb_image_data.second.initialLayout));
-                }
+                        reinterpret_cast<const uint64_t &>(image), sub.aspectMask, sub.arrayLayer, sub.mipLevel,
+                        string_VkImageLayout(*imageLayout), string_VkImageLayout(node.initialLayout));
+                });
             }
-            SetLayout(dev_data, cb_image_data.first, cb_image_data.second.layout);
-        }
+            VkImageLayout current;
+            if (!image_layouts.runs.uniform(begin, end, &current) || current != node.layout) {
+                image_layouts.runs.set(begin, end, node.layout);
+                image_layouts.version = ++dev_data->imageLayoutVersion;
+                unchanged = false;
+            }
+        });
+        versions.push_back(std::make_pair(image, image_layouts.version));
     }
+    if (!unchanged || pCB->state != CB_RECORDED)
+        versions.clear();
     return skip_call;
 }
 
@@ -4304,28 +4882,26 @@ static bool validateAndIncrementResources(layer_data *my_data, GLOBAL_CB_NODE *p
     pCB->in_use.fetch_add(1);
     my_data->globalInFlightCmdBuffers.insert(pCB->commandBuffer);
 
-    for (auto drawDataElement : pCB->drawData) {
-        for (auto buffer : drawDataElement.buffers) {
-            auto buffer_node = getBufferNode(my_data, buffer);
-            if (!buffer_node) {
-                skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
-                                     (uint64_t)(buffer), __LINE__, DRAWSTATE_INVALID_BUFFER, "DS",
-                                     "Cannot submit cmd buffer using deleted buffer 0x%" PRIx64 ".", (uint64_t)(buffer));
-            } else {
-                buffer_node->in_use.fetch_add(1);
-            }
+    for (auto buffer : GetDrawBuffers(pCB)) {
+        auto buffer_node = getBufferNode(my_data, buffer);
+        if (!buffer_node) {
+            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
+                                 (uint64_t)(buffer), __LINE__, DRAWSTATE_INVALID_BUFFER, "DS",
+                                 "Cannot submit cmd buffer using deleted buffer 0x%" PRIx64 ".", (uint64_t)(buffer));
+        } else {
+            buffer_node->in_use.fetch_add(1);
         }
     }
-    for (uint32_t i = 0; i < VK_PIPELINE_BIND_POINT_RANGE_SIZE; ++i) {
-        for (auto set : pCB->lastBound[i].uniqueBoundSets) {
-            if (!my_data->setMap.count(set->GetSet())) {
-                skip_call |=
-                    log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
-                            (uint64_t)(set), __LINE__, DRAWSTATE_INVALID_DESCRIPTOR_SET, "DS",
-                            "Cannot submit cmd buffer using deleted descriptor set 0x%" PRIx64 ".", (uint64_t)(set));
-            } else {
-                set->in_use.fetch_add(1);
-            }
+    for (auto const &binding : pCB->object_bindings) {
+        if (binding.first.type != VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT)
+            continue;
+        auto set = getSetNode(my_data, reinterpret_cast<const VkDescriptorSet &>(binding.first.handle));
+        if (!set) {
+            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
+                                 binding.first.handle, __LINE__, DRAWSTATE_INVALID_DESCRIPTOR_SET, "DS",
+                                 "Cannot submit cmd buffer using deleted descriptor set 0x%" PRIx64 ".", binding.first.handle);
+        } else {
+            set->in_use.fetch_add(1);
         }
     }
     for (auto event : pCB->events) {
@@ -4380,16 +4956,17 @@ static inline void removeInFlightCmdBuffer(layer_data *dev_data, VkCommandBuffer
 static void decrementResources(layer_data *my_data, CB_SUBMISSION *submission) {
     for (auto cb : submission->cbs) {
         auto pCB = getCBNode(my_data, cb);
-        for (auto drawDataElement : pCB->drawData) {
-            for (auto buffer : drawDataElement.buffers) {
-                auto buffer_node = getBufferNode(my_data, buffer);
-                if (buffer_node) {
-                    buffer_node->in_use.fetch_sub(1);
-                }
+        for (auto buffer : GetDrawBuffers(pCB)) {
+            auto buffer_node = getBufferNode(my_data, buffer);
+            if (buffer_node) {
+                buffer_node->in_use.fetch_sub(1);
             }
         }
-        for (uint32_t i = 0; i < VK_PIPELINE_BIND_POINT_RANGE_SIZE; ++i) {
-            for (auto set : pCB->lastBound[i].uniqueBoundSets) {
+        for (auto const &binding : pCB->object_bindings) {
+            if (binding.first.type != VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT)
+                continue;
+            auto set = getSetNode(my_data, reinterpret_cast<const VkDescriptorSet &>(binding.first.handle));
+            if (set) {
                 set->in_use.fetch_sub(1);
             }
         }
@@ -4570,6 +5147,7 @@ static bool validateCommandBufferSimultaneousUse(layer_data *dev_data, GLOBAL_CB
 
 static bool validateCommandBufferState(layer_data *dev_data, GLOBAL_CB_NODE *pCB) {
     bool skip_call = false;
+    updateCmdBufferBindingState(dev_data, pCB);
     // Validate ONE_TIME_SUBMIT_BIT CB is not being submitted more than once
     if ((pCB->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) && (pCB->submitCount > 1)) {
         skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
@@ -4669,7 +5247,7 @@ QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, V
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     auto pQueue = getQueueNode(dev_data, queue);
     auto pFence = getFenceNode(dev_data, fence);
@@ -4679,9 +5257,9 @@ QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, V
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
-    // TODO : Review these old print functions and clean up as appropriate
-    print_mem_list(dev_data);
-    printCBList(dev_data);
+    if (!dev_data->stateDumpFile.empty() && state_dump_requested.exchange(false)) {
+        dump_layer_state(dev_data, "vkQueueSubmit");
+    }
 
     // Mark the fence in-use.
     if (pFence) {
@@ -4746,6 +5324,8 @@ QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, V
 
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto pCBNode = getCBNode(dev_data, submit->pCommandBuffers[i]);
+            if (pCBNode)
+                updateCmdBufferBindingState(dev_data, pCBNode);
             skip_call |= ValidateCmdBufImageLayouts(dev_data, pCBNode);
             if (pCBNode) {
                 cbs.push_back(submit->pCommandBuffers[i]);
@@ -4755,16 +5335,10 @@ QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, V
 
                 pCBNode->submitCount++; // increment submit count
                 skip_call |= validatePrimaryCommandBufferState(dev_data, pCBNode);
-                // Call submit-time functions to validate/update state
-                for (auto &function : pCBNode->validate_functions) {
-                    skip_call |= function();
-                }
-                for (auto &function : pCBNode->eventUpdates) {
-                    skip_call |= function(queue);
-                }
-                for (auto &function : pCBNode->queryUpdates) {
-                    skip_call |= function(queue);
-                }
+                // Run deferred submit-time checks to validate/update state
+                skip_call |= RunDeferredChecks(dev_data, queue, pCBNode, GetReducedMemoryChecks(pCBNode));
+                skip_call |= RunDeferredChecks(dev_data, queue, pCBNode, pCBNode->eventUpdates);
+                skip_call |= RunDeferredChecks(dev_data, queue, pCBNode, pCBNode->queryUpdates);
             }
         }
 
@@ -4782,7 +5356,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAll
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = my_data->device_dispatch_table->AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     // TODO : Track allocations and overall size here
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     add_mem_obj_info(my_data, device, *pMemory, pAllocateInfo);
     print_mem_list(my_data);
     return result;
@@ -4799,7 +5373,7 @@ FreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAl
     // buffers (on host or device) for anything other than destroying those objects will result in
     // undefined behavior.
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip_call = freeMemObjInfo(my_data, device, mem, false);
     print_mem_list(my_data);
     printCBList(my_data);
@@ -4873,6 +5447,7 @@ static bool deleteMemRanges(layer_data *my_data, VkDeviceMemory mem) {
             free(mem_info->pData);
             mem_info->pData = 0;
         }
+        mem_info->shadow.reset();
     }
     return skip_call;
 }
@@ -4887,6 +5462,17 @@ static void initializeAndTrackMemory(layer_data *dev_data, VkDeviceMemory mem, V
         if (dev_data->phys_dev_mem_props.memoryTypes[index].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) {
             mem_info->pData = 0;
         } else {
+            if (dev_data->noncoherentGuardPages) {
+                VkDeviceSize mapped_size =
+                    (size == VK_WHOLE_SIZE) ? mem_info->allocInfo.allocationSize - mem_info->memRange.offset : size;
+                mem_info->shadow = guarded_mapping::create(*ppData, static_cast<size_t>(mapped_size),
+                                                           dev_data->phys_dev_properties.properties.limits.minMemoryMapAlignment);
+                if (mem_info->shadow) {
+                    *ppData = mem_info->shadow->data();
+                    return;
+                }
+                // Fall back to the guard-banded copy below, e.g. on platforms without guard page support
+            }
             if (size == VK_WHOLE_SIZE) {
                 size = mem_info->allocInfo.allocationSize;
             }
@@ -4921,7 +5507,7 @@ WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBo
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
     // Verify fence status of submitted fences
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     for (uint32_t i = 0; i < fenceCount; i++) {
         skip_call |= verifyWaitFenceState(dev_data, pFences[i], "vkWaitForFences");
     }
@@ -4950,7 +5536,7 @@ WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBo
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     skip_call = verifyWaitFenceState(dev_data, fence, "vkGetFenceStatus");
     lock.unlock();
 
@@ -4972,7 +5558,7 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyI
                                                             VkQueue *pQueue) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     dev_data->device_dispatch_table->GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
 
     // Add queue to tracking set only if it is new
     auto result = dev_data->queues.emplace(*pQueue);
@@ -4996,7 +5582,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     for (auto queue : dev_data->queues) {
         skip_call |= decrementResources(dev_data, queue);
     }
@@ -5011,7 +5597,7 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
 VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto fence_pair = dev_data->fenceMap.find(fence);
     if (fence_pair != dev_data->fenceMap.end()) {
         if (fence_pair->second.state == FENCE_INFLIGHT) {
@@ -5031,7 +5617,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto item = dev_data->semaphoreMap.find(semaphore);
     if (item != dev_data->semaphoreMap.end()) {
         if (item->second.in_use.load()) {
@@ -5048,7 +5634,7 @@ DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallb
 VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto event_node = getEventNode(dev_data, event);
     if (event_node) {
         if (event_node->in_use.load()) {
@@ -5058,8 +5644,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const Vk
                 "Cannot delete event 0x%" PRIx64 " which is in use by a command buffer.", reinterpret_cast<uint64_t &>(event));
         }
         // Any bound cmd buffers are now invalid
-        invalidateCommandBuffers(event_node->cb_bindings,
-                                 {reinterpret_cast<uint64_t &>(event), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT});
+        invalidateCommandBuffers(event_node);
         dev_data->eventMap.erase(event);
     }
     lock.unlock();
@@ -5071,12 +5656,11 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     // TODO : Add detection for an in-flight queryPool
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto qp_node = getQueryPoolNode(dev_data, queryPool);
     if (qp_node) {
         // Any bound cmd buffers are now invalid
-        invalidateCommandBuffers(qp_node->cb_bindings,
-                                 {reinterpret_cast<uint64_t &>(queryPool), VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT});
+        invalidateCommandBuffers(qp_node);
         dev_data->queryPoolMap.erase(queryPool);
     }
     lock.unlock();
@@ -5088,7 +5672,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool
                                                    VkQueryResultFlags flags) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     unordered_map<QueryObject, vector<VkCommandBuffer>> queriesInFlight;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     for (auto cmdBuffer : dev_data->globalInFlightCmdBuffers) {
         auto pCB = getCBNode(dev_data, cmdBuffer);
         for (auto queryStatePair : pCB->queryToStateMap) {
@@ -5186,59 +5770,48 @@ static bool print_memory_range_error(layer_data *dev_data, const uint64_t object
     }
 }
 
-static bool validate_memory_range(layer_data *dev_data, const vector<MEMORY_RANGE> &ranges, const MEMORY_RANGE &new_range,
+static bool validate_memory_range(layer_data *dev_data, const interval_tree<MEMORY_RANGE> &ranges, const MEMORY_RANGE &new_range,
                                   VkDebugReportObjectTypeEXT object_type) {
     bool skip_call = false;
-
-    for (auto range : ranges) {
-        if ((range.end & ~(dev_data->phys_dev_properties.properties.limits.bufferImageGranularity - 1)) <
-            (new_range.start & ~(dev_data->phys_dev_properties.properties.limits.bufferImageGranularity - 1)))
-            continue;
-        if ((range.start & ~(dev_data->phys_dev_properties.properties.limits.bufferImageGranularity - 1)) >
-            (new_range.end & ~(dev_data->phys_dev_properties.properties.limits.bufferImageGranularity - 1)))
-            continue;
-        skip_call |= print_memory_range_error(dev_data, new_range.handle, range.handle, object_type);
-    }
+    // Ranges conflict if they share a bufferImageGranularity-sized page, so widen the query to whole pages
+    const VkDeviceSize granularity_mask = dev_data->phys_dev_properties.properties.limits.bufferImageGranularity - 1;
+    ranges.for_each_overlap(new_range.start & ~granularity_mask, new_range.end | granularity_mask,
+                            [&](const MEMORY_RANGE &range) {
+                                skip_call |= print_memory_range_error(dev_data, new_range.handle, range.handle, object_type);
+                            });
     return skip_call;
 }
 
 static MEMORY_RANGE insert_memory_ranges(uint64_t handle, VkDeviceMemory mem, VkDeviceSize memoryOffset,
-                                         VkMemoryRequirements memRequirements, vector<MEMORY_RANGE> &ranges) {
+                                         VkMemoryRequirements memRequirements, interval_tree<MEMORY_RANGE> &ranges) {
     MEMORY_RANGE range;
     range.handle = handle;
     range.memory = mem;
     range.start = memoryOffset;
     range.end = memoryOffset + memRequirements.size - 1;
-    ranges.push_back(range);
+    ranges.insert(handle, range.start, range.end, range);
     return range;
 }
 
-static void remove_memory_ranges(uint64_t handle, VkDeviceMemory mem, vector<MEMORY_RANGE> &ranges) {
-    for (uint32_t item = 0; item < ranges.size(); item++) {
-        if ((ranges[item].handle == handle) && (ranges[item].memory == mem)) {
-            ranges.erase(ranges.begin() + item);
-            break;
-        }
-    }
-}
+static void remove_memory_ranges(uint64_t handle, interval_tree<MEMORY_RANGE> &ranges) { ranges.erase(handle); }
 
 VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer,
                                          const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     if (!validateIdleBuffer(dev_data, buffer)) {
         // Clean up memory binding and range information for buffer
         auto buff_node = getBufferNode(dev_data, buffer);
         if (buff_node) {
             // Any bound cmd buffers are now invalid
-            invalidateCommandBuffers(buff_node->cb_bindings,
-                                     {reinterpret_cast<uint64_t &>(buff_node->buffer), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT});
+            invalidateCommandBuffers(buff_node);
             auto mem_info = getMemObjInfo(dev_data, buff_node->mem);
             if (mem_info) {
-                remove_memory_ranges(reinterpret_cast<uint64_t &>(buffer), buff_node->mem, mem_info->bufferRanges);
+                remove_memory_ranges(reinterpret_cast<uint64_t &>(buffer), mem_info->bufferRanges);
             }
             clear_object_binding(dev_data, reinterpret_cast<uint64_t &>(buffer), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT);
             dev_data->bufferMap.erase(buff_node->buffer);
+            dev_data->descriptorResourceEpoch++;
         }
         lock.unlock();
         dev_data->device_dispatch_table->DestroyBuffer(device, buffer, pAllocator);
@@ -5249,7 +5822,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto item = dev_data->bufferViewMap.find(bufferView);
     if (item != dev_data->bufferViewMap.end()) {
         dev_data->bufferViewMap.erase(item);
@@ -5261,29 +5834,22 @@ DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCa
 VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto img_node = getImageNode(dev_data, image);
     if (img_node) {
         // Any bound cmd buffers are now invalid
-        invalidateCommandBuffers(img_node->cb_bindings,
-                                 {reinterpret_cast<uint64_t &>(img_node->image), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT});
+        invalidateCommandBuffers(img_node);
         // Clean up memory mapping, bindings and range references for image
         auto mem_info = getMemObjInfo(dev_data, img_node->mem);
         if (mem_info) {
-            remove_memory_ranges(reinterpret_cast<uint64_t &>(image), img_node->mem, mem_info->imageRanges);
+            remove_memory_ranges(reinterpret_cast<uint64_t &>(image), mem_info->imageRanges);
             clear_object_binding(dev_data, reinterpret_cast<uint64_t &>(image), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT);
             mem_info->image = VK_NULL_HANDLE;
         }
         // Remove image from imageMap
         dev_data->imageMap.erase(img_node->image);
     }
-    const auto& subEntry = dev_data->imageSubresourceMap.find(image);
-    if (subEntry != dev_data->imageSubresourceMap.end()) {
-        for (const auto& pair : subEntry->second) {
-            dev_data->imageLayoutMap.erase(pair);
-        }
-        dev_data->imageSubresourceMap.erase(subEntry);
-    }
+    dev_data->imageLayoutMap.erase(image);
     lock.unlock();
     dev_data->device_dispatch_table->DestroyImage(device, image, pAllocator);
 }
@@ -5306,7 +5872,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory mem, VkDeviceSize memoryOffset) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // Track objects tied to memory
     uint64_t buffer_handle = (uint64_t)(buffer);
     bool skip_call = set_mem_binding(dev_data, mem, buffer_handle, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, "vkBindBufferMemory");
@@ -5408,7 +5974,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks *pAllocator) {
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     my_data->shaderModuleMap.erase(shaderModule);
     lock.unlock();
 
@@ -5419,12 +5985,11 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     // TODO : Add detection for in-flight pipeline
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pipe_node = getPipeline(dev_data, pipeline);
     if (pipe_node) {
         // Any bound cmd buffers are now invalid
-        invalidateCommandBuffers(pipe_node->cb_bindings,
-                                 {reinterpret_cast<uint64_t &>(pipeline), VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT});
+        invalidateCommandBuffers(pipe_node);
         dev_data->pipelineMap.erase(pipeline);
     }
     lock.unlock();
@@ -5434,7 +5999,7 @@ DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallback
 VKAPI_ATTR void VKAPI_CALL
 DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     dev_data->pipelineLayoutMap.erase(pipelineLayout);
     lock.unlock();
 
@@ -5456,9 +6021,17 @@ DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetL
 
 VKAPI_ATTR void VKAPI_CALL
 DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks *pAllocator) {
-    // TODO : Clean up any internal data structures using this obj.
-    get_my_data_ptr(get_dispatch_key(device), layer_data_map)
-        ->device_dispatch_table->DestroyDescriptorPool(device, descriptorPool, pAllocator);
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
+    // TODO : Validate that no sets from this pool are in use
+    dev_data->device_dispatch_table->DestroyDescriptorPool(device, descriptorPool, pAllocator);
+    std::lock_guard<rw_lock> lock(global_lock);
+    // Destroying the pool frees its sets, and its set arena along with it
+    DESCRIPTOR_POOL_NODE *pPool = getPoolNode(dev_data, descriptorPool);
+    if (pPool) {
+        freePoolDescriptorSets(dev_data, pPool, true);
+        dev_data->descriptorPoolMap.erase(descriptorPool);
+        delete pPool;
+    }
 }
 // Verify cmdBuffer in given cb_node is not in global in-flight set, and return skip_call result
 //  If this is a secondary command buffer, then make sure its primary is also in-flight
@@ -5501,7 +6074,7 @@ VKAPI_ATTR void VKAPI_CALL
 FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         auto cb_node = getCBNode(dev_data, pCommandBuffers[i]);
@@ -5543,7 +6116,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkComman
     VkResult result = dev_data->device_dispatch_table->CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->commandPoolMap[*pCommandPool].createFlags = pCreateInfo->flags;
         dev_data->commandPoolMap[*pCommandPool].queueFamilyIndex = pCreateInfo->queueFamilyIndex;
     }
@@ -5556,7 +6129,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoo
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->queryPoolMap[*pQueryPool].createInfo = *pCreateInfo;
     }
     return result;
@@ -5567,7 +6140,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // Verify that command buffers in pool are complete (not in-flight)
     auto pPool = getCommandPoolNode(dev_data, commandPool);
     skip_call |= checkCommandBuffersInFlight(dev_data, pPool, "destroy command pool with");
@@ -5579,9 +6152,6 @@ DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocatio
     for (auto cb : pPool->commandBuffers) {
         clear_cmd_buf_and_mem_references(dev_data, cb);
         auto cb_node = getCBNode(dev_data, cb);
-        for (auto obj : cb_node->object_bindings) {
-            removeCommandBufferBinding(dev_data, &obj, cb_node);
-        }
         dev_data->commandBufferMap.erase(cb); // Remove this command buffer
         delete cb_node;                       // delete CB info structure
     }
@@ -5596,7 +6166,7 @@ ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetF
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pPool = getCommandPoolNode(dev_data, commandPool);
     skip_call |= checkCommandBuffersInFlight(dev_data, pPool, "reset command pool with");
     lock.unlock();
@@ -5621,7 +6191,7 @@ ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetF
 VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     for (uint32_t i = 0; i < fenceCount; ++i) {
         auto pFence = getFenceNode(dev_data, pFences[i]);
         if (pFence && pFence->state == FENCE_INFLIGHT) {
@@ -5655,22 +6225,16 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount,
     return result;
 }
 
-// For given cb_nodes, invalidate them and track object causing invalidation
-void invalidateCommandBuffers(std::unordered_set<GLOBAL_CB_NODE *> cb_nodes, VK_OBJECT obj) {
-    for (auto cb_node : cb_nodes) {
-        cb_node->state = CB_INVALID;
-        cb_node->broken_bindings.push_back(obj);
-    }
-}
+// Invalidate the cmd buffers node is bound to; each finds out at its next submit (see updateCmdBufferBindingState)
+void invalidateCommandBuffers(BASE_NODE *node) { node->generation = newObjectGeneration(); }
 
 VKAPI_ATTR void VKAPI_CALL
 DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto fb_node = getFramebuffer(dev_data, framebuffer);
     if (fb_node) {
-        invalidateCommandBuffers(fb_node->cb_bindings,
-                                 {reinterpret_cast<uint64_t &>(fb_node->framebuffer), VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT});
+        invalidateCommandBuffers(fb_node);
         dev_data->frameBufferMap.erase(fb_node->framebuffer);
     }
     lock.unlock();
@@ -5680,7 +6244,7 @@ DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocatio
 VKAPI_ATTR void VKAPI_CALL
 DestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     dev_data->renderPassMap.erase(renderPass);
     // TODO: leaking all the guts of the renderpass node here!
     lock.unlock();
@@ -5694,7 +6258,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
     VkResult result = dev_data->device_dispatch_table->CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         // TODO : This doesn't create deep copy of pQueueFamilyIndices so need to fix that if/when we want that data to be valid
         dev_data->bufferMap.insert(std::make_pair(*pBuffer, unique_ptr<BUFFER_NODE>(new BUFFER_NODE(*pBuffer, pCreateInfo))));
     }
@@ -5719,7 +6283,7 @@ static bool PreCallValidateCreateBufferView(layer_data *dev_data, const VkBuffer
 VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkBufferView *pView) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip_call = PreCallValidateCreateBufferView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip_call)
@@ -5740,14 +6304,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
     VkResult result = dev_data->device_dispatch_table->CreateImage(device, pCreateInfo, pAllocator, pImage);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        IMAGE_LAYOUT_NODE image_node;
-        image_node.layout = pCreateInfo->initialLayout;
-        image_node.format = pCreateInfo->format;
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->imageMap.insert(std::make_pair(*pImage, unique_ptr<IMAGE_NODE>(new IMAGE_NODE(*pImage, pCreateInfo))));
-        ImageSubresourcePair subpair = {*pImage, false, VkImageSubresource()};
-        dev_data->imageSubresourceMap[*pImage].push_back(subpair);
-        dev_data->imageLayoutMap[subpair] = image_node;
+        InitImageLayouts(dev_data, *pImage, pCreateInfo, pCreateInfo->initialLayout);
     }
     return result;
 }
@@ -5771,25 +6330,6 @@ static void ResolveRemainingLevelsLayers(layer_data *dev_data, VkImageSubresourc
     }
 }
 
-// Return the correct layer/level counts if the caller used the special
-// values VK_REMAINING_MIP_LEVELS or VK_REMAINING_ARRAY_LAYERS.
-static void ResolveRemainingLevelsLayers(layer_data *dev_data, uint32_t *levels, uint32_t *layers, VkImageSubresourceRange range,
-                                         VkImage image) {
-    /* expects global_lock to be held by caller */
-
-    *levels = range.levelCount;
-    *layers = range.layerCount;
-    auto image_node = getImageNode(dev_data, image);
-    if (image_node) {
-        if (range.levelCount == VK_REMAINING_MIP_LEVELS) {
-            *levels = image_node->createInfo.mipLevels - range.baseMipLevel;
-        }
-        if (range.layerCount == VK_REMAINING_ARRAY_LAYERS) {
-            *layers = image_node->createInfo.arrayLayers - range.baseArrayLayer;
-        }
-    }
-}
-
 static bool PreCallValidateCreateImageView(layer_data *dev_data, const VkImageViewCreateInfo *pCreateInfo) {
     bool skip_call = false;
     IMAGE_NODE *image_node = getImageNode(dev_data, pCreateInfo->image);
@@ -5812,7 +6352,7 @@ static inline void PostCallRecordCreateImageView(layer_data *dev_data, const VkI
 VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
                                                const VkAllocationCallbacks *pAllocator, VkImageView *pView) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip_call = PreCallValidateCreateImageView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip_call)
@@ -5832,7 +6372,7 @@ CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo, const VkAlloc
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateFence(device, pCreateInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         auto &fence_node = dev_data->fenceMap[*pFence];
         fence_node.fence = *pFence;
         fence_node.createInfo = *pCreateInfo;
@@ -5906,15 +6446,25 @@ CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     for (i = 0; i < count; i++) {
         pPipeNode[i] = new PIPELINE_NODE;
         pPipeNode[i]->initGraphicsPipeline(&pCreateInfos[i]);
         pPipeNode[i]->render_pass_ci.initialize(getRenderPass(dev_data, pCreateInfos[i].renderPass)->pCreateInfo);
         pPipeNode[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
+        set_pipeline_state(pPipeNode[i]);
+    }
 
-        skip_call |= verifyPipelineCreateState(dev_data, device, pPipeNode, i);
+    // Shader interface checks dominate the cost of large batches, so run them in parallel up front;
+    //  their messages are still reported in pipeline order, from this thread
+    vector<vector<deferred_log_msg>> shader_msgs;
+    if (count >= PARALLEL_PIPELINE_VALIDATION_MIN_COUNT) {
+        validate_pipeline_shader_state_parallel(dev_data, pPipeNode, shader_msgs);
+    }
+
+    for (i = 0; i < count; i++) {
+        skip_call |= verifyPipelineCreateState(dev_data, device, pPipeNode, i, shader_msgs.empty() ? nullptr : &shader_msgs[i]);
     }
 
     if (!skip_call) {
@@ -5949,7 +6499,7 @@ CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     for (i = 0; i < count; i++) {
         // TODO: Verify compute stage bits
 
@@ -5991,7 +6541,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCre
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateSampler(device, pCreateInfo, pAllocator, pSampler);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->samplerMap[*pSampler] = unique_ptr<SAMPLER_NODE>(new SAMPLER_NODE(pSampler, pCreateInfo));
     }
     return result;
@@ -6004,7 +6554,7 @@ CreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo
     VkResult result = dev_data->device_dispatch_table->CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     if (VK_SUCCESS == result) {
         // TODOSC : Capture layout bindings set
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->descriptorSetLayoutMap[*pSetLayout] =
             new cvdescriptorset::DescriptorSetLayout(dev_data->report_data, pCreateInfo, *pSetLayout);
     }
@@ -6115,7 +6665,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
 
     VkResult result = dev_data->device_dispatch_table->CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         PIPELINE_LAYOUT_NODE &plNode = dev_data->pipelineLayoutMap[*pPipelineLayout];
         plNode.layout = *pPipelineLayout;
         plNode.set_layouts.resize(pCreateInfo->setLayoutCount);
@@ -6141,14 +6691,15 @@ CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateI
                     (uint64_t)*pDescriptorPool, __LINE__, DRAWSTATE_OUT_OF_MEMORY, "DS", "Created Descriptor Pool 0x%" PRIxLEAST64,
                     (uint64_t)*pDescriptorPool))
             return VK_ERROR_VALIDATION_FAILED_EXT;
-        DESCRIPTOR_POOL_NODE *pNewNode = new DESCRIPTOR_POOL_NODE(*pDescriptorPool, pCreateInfo);
+        DESCRIPTOR_POOL_NODE *pNewNode =
+            new DESCRIPTOR_POOL_NODE(*pDescriptorPool, pCreateInfo, cvdescriptorset::GetPoolArenaSize(pCreateInfo));
         if (NULL == pNewNode) {
             if (log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT,
                         (uint64_t)*pDescriptorPool, __LINE__, DRAWSTATE_OUT_OF_MEMORY, "DS",
                         "Out of memory while attempting to allocate DESCRIPTOR_POOL_NODE in vkCreateDescriptorPool()"))
                 return VK_ERROR_VALIDATION_FAILED_EXT;
         } else {
-            std::lock_guard<std::mutex> lock(global_lock);
+            std::lock_guard<rw_lock> lock(global_lock);
             dev_data->descriptorPoolMap[*pDescriptorPool] = pNewNode;
         }
     } else {
@@ -6162,7 +6713,7 @@ ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescript
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->ResetDescriptorPool(device, descriptorPool, flags);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         clearDescriptorPool(dev_data, device, descriptorPool, flags);
     }
     return result;
@@ -6187,7 +6738,7 @@ static void PostCallRecordAllocateDescriptorSets(layer_data *dev_data, const VkD
 VKAPI_ATTR VkResult VKAPI_CALL
 AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo, VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     cvdescriptorset::AllocateDescriptorSetsData common_data(pAllocateInfo->descriptorSetCount);
     bool skip_call = PreCallValidateAllocateDescriptorSets(dev_data, pAllocateInfo, &common_data);
     lock.unlock();
@@ -6238,8 +6789,8 @@ static void PostCallRecordFreeDescriptorSets(layer_data *dev_data, VkDescriptorP
             descriptor_count = set_state->GetDescriptorCountFromIndex(j);
             pool_state->availableDescriptorTypeCount[type_index] += descriptor_count;
         }
-        freeDescriptorSet(dev_data, set_state);
         pool_state->sets.erase(set_state);
+        freeDescriptorSet(dev_data, pool_state, set_state);
     }
 }
 
@@ -6247,7 +6798,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t count, const VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     // Make sure that no sets being destroyed are in-flight
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip_call = PreCallValidateFreeDescriptorSets(dev_data, descriptorPool, count, pDescriptorSets);
     lock.unlock();
 
@@ -6291,7 +6842,7 @@ UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWri
                      uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
     // Only map look-up at top level is for device-level layer_data
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip_call = PreCallValidateUpdateDescriptorSets(dev_data, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                          pDescriptorCopies);
     lock.unlock();
@@ -6310,14 +6861,14 @@ AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pCrea
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->AllocateCommandBuffers(device, pCreateInfo, pCommandBuffer);
     if (VK_SUCCESS == result) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         auto pPool = getCommandPoolNode(dev_data, pCreateInfo->commandPool);
 
         if (pPool) {
             for (uint32_t i = 0; i < pCreateInfo->commandBufferCount; i++) {
                 // Add command buffer to its commandPool map
                 pPool->commandBuffers.push_back(pCommandBuffer[i]);
-                GLOBAL_CB_NODE *pCB = new GLOBAL_CB_NODE;
+                GLOBAL_CB_NODE *pCB = new GLOBAL_CB_NODE(&pPool->arena);
                 // Add command buffer to map
                 dev_data->commandBufferMap[pCommandBuffer[i]] = pCB;
                 resetCB(dev_data, pCommandBuffer[i]);
@@ -6335,7 +6886,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // Validate command buffer level
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
@@ -6395,7 +6946,9 @@ BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo
                                     reinterpret_cast<uint64_t &>(framebuffer->createInfo.renderPass), errorString.c_str());
                             }
                             // Connect this framebuffer to this cmdBuffer
-                            framebuffer->cb_bindings.insert(pCB);
+                            addCommandBufferBinding(framebuffer, {reinterpret_cast<const uint64_t &>(pInfo->framebuffer),
+                                                                  VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT},
+                                                    pCB);
                         }
                     }
                 }
@@ -6478,7 +7031,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
     bool skip_call = false;
     VkResult result = VK_SUCCESS;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         if ((VK_COMMAND_BUFFER_LEVEL_PRIMARY == pCB->createInfo.level) || !(pCB->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
@@ -6499,6 +7052,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
         result = dev_data->device_dispatch_table->EndCommandBuffer(commandBuffer);
         lock.lock();
         if (VK_SUCCESS == result) {
+            mergeCmdBufMemReferences(dev_data, pCB);
             pCB->state = CB_RECORDED;
             // Reset CB status flags
             pCB->status = 0;
@@ -6515,7 +7069,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     VkCommandPool cmdPool = pCB->createInfo.commandPool;
     auto pPool = getCommandPoolNode(dev_data, cmdPool);
@@ -6544,7 +7098,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_BINDPIPELINE, "vkCmdBindPipeline()");
@@ -6559,14 +7113,14 @@ CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindP
         PIPELINE_NODE *pPN = getPipeline(dev_data, pipeline);
         if (pPN) {
             pCB->lastBound[pipelineBindPoint].pipeline = pipeline;
+            pCB->lastBound[pipelineBindPoint].descriptorsDirty = true;
             set_cb_pso_status(pCB, pPN);
-            set_pipeline_state(pPN);
         } else {
             skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT,
                                  (uint64_t)pipeline, __LINE__, DRAWSTATE_INVALID_PIPELINE, "DS",
                                  "Attempt to bind Pipeline 0x%" PRIxLEAST64 " that doesn't exist!", (uint64_t)(pipeline));
         }
-        addCommandBufferBinding(&getPipeline(dev_data, pipeline)->cb_bindings,
+        addCommandBufferBinding(getPipeline(dev_data, pipeline),
                                 {reinterpret_cast<uint64_t &>(pipeline), VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT}, pCB);
     }
     lock.unlock();
@@ -6578,7 +7132,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport *pViewports) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETVIEWPORTSTATE, "vkCmdSetViewport()");
@@ -6595,7 +7149,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *pScissors) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSCISSORSTATE, "vkCmdSetScissor()");
@@ -6611,7 +7165,7 @@ CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t sci
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETLINEWIDTHSTATE, "vkCmdSetLineWidth()");
@@ -6636,7 +7190,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETDEPTHBIASSTATE, "vkCmdSetDepthBias()");
@@ -6651,7 +7205,7 @@ CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, fl
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETBLENDSTATE, "vkCmdSetBlendConstants()");
@@ -6666,7 +7220,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETDEPTHBOUNDSSTATE, "vkCmdSetDepthBounds()");
@@ -6681,7 +7235,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSTENCILREADMASKSTATE, "vkCmdSetStencilCompareMask()");
@@ -6696,7 +7250,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSTENCILWRITEMASKSTATE, "vkCmdSetStencilWriteMask()");
@@ -6711,7 +7265,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSTENCILREFERENCESTATE, "vkCmdSetStencilReference()");
@@ -6728,7 +7282,7 @@ CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelin
                       const uint32_t *pDynamicOffsets) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         if (pCB->state == CB_RECORDING) {
@@ -6736,8 +7290,13 @@ CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelin
             uint32_t totalDynamicDescriptors = 0;
             string errorString = "";
             uint32_t lastSetIndex = firstSet + setCount - 1;
+            // Sets bound earlier are checked against the new layout below
+            dropFreedBoundDescriptorSets(dev_data, pCB->lastBound[pipelineBindPoint]);
+            pCB->lastBound[pipelineBindPoint].descriptorsDirty = true;
             if (lastSetIndex >= pCB->lastBound[pipelineBindPoint].boundDescriptorSets.size()) {
                 pCB->lastBound[pipelineBindPoint].boundDescriptorSets.resize(lastSetIndex + 1);
+                pCB->lastBound[pipelineBindPoint].boundDescriptorSetHandles.resize(lastSetIndex + 1);
+                pCB->lastBound[pipelineBindPoint].boundDescriptorSetIds.resize(lastSetIndex + 1);
                 pCB->lastBound[pipelineBindPoint].dynamicOffsets.resize(lastSetIndex + 1);
             }
             auto oldFinalBoundSet = pCB->lastBound[pipelineBindPoint].boundDescriptorSets[lastSetIndex];
@@ -6745,10 +7304,13 @@ CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelin
             for (uint32_t i = 0; i < setCount; i++) {
                 cvdescriptorset::DescriptorSet *pSet = getSetNode(dev_data, pDescriptorSets[i]);
                 if (pSet) {
-                    pCB->lastBound[pipelineBindPoint].uniqueBoundSets.insert(pSet);
-                    pSet->BindCommandBuffer(pCB);
+                    addCommandBufferBinding(pSet, {reinterpret_cast<const uint64_t &>(pDescriptorSets[i]),
+                                                   VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT},
+                                            pCB);
                     pCB->lastBound[pipelineBindPoint].pipeline_layout = *pipeline_layout;
                     pCB->lastBound[pipelineBindPoint].boundDescriptorSets[i + firstSet] = pSet;
+                    pCB->lastBound[pipelineBindPoint].boundDescriptorSetHandles[i + firstSet] = pDescriptorSets[i];
+                    pCB->lastBound[pipelineBindPoint].boundDescriptorSetIds[i + firstSet] = pSet->GetAllocationId();
                     skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT,
                                          VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)pDescriptorSets[i], __LINE__,
                                          DRAWSTATE_NONE, "DS", "DS 0x%" PRIxLEAST64 " bound on pipeline %s",
@@ -6870,6 +7432,8 @@ CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelin
                                     (uint64_t)pCB->lastBound[pipelineBindPoint].boundDescriptorSets[lastSetIndex], lastSetIndex,
                                     lastSetIndex + 1, (uint64_t)layout);
                         pCB->lastBound[pipelineBindPoint].boundDescriptorSets.resize(lastSetIndex + 1);
+                        pCB->lastBound[pipelineBindPoint].boundDescriptorSetHandles.resize(lastSetIndex + 1);
+                        pCB->lastBound[pipelineBindPoint].boundDescriptorSetIds.resize(lastSetIndex + 1);
                     }
                 }
             }
@@ -6897,16 +7461,13 @@ CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that IBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto buff_node = getBufferNode(dev_data, buffer);
     auto cb_node = getCBNode(dev_data, commandBuffer);
     if (cb_node && buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdBindIndexBuffer()");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, buff_node->mem, "vkCmdBindIndexBuffer()");
-        };
-        cb_node->validate_functions.push_back(function);
+        AddMemoryCheck(cb_node, buff_node->mem, "vkCmdBindIndexBuffer()");
         skip_call |= addCmd(dev_data, cb_node, CMD_BINDINDEXBUFFER, "vkCmdBindIndexBuffer()");
         VkDeviceSize offset_align = 0;
         switch (indexType) {
@@ -6953,7 +7514,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that VBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     if (cb_node) {
@@ -6961,10 +7522,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
             auto buff_node = getBufferNode(dev_data, pBuffers[i]);
             assert(buff_node);
             skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdBindVertexBuffers()");
-            std::function<bool()> function = [=]() {
-                return validate_memory_is_valid(dev_data, buff_node->mem, "vkCmdBindVertexBuffers()");
-            };
-            cb_node->validate_functions.push_back(function);
+            AddMemoryCheck(cb_node, buff_node->mem, "vkCmdBindVertexBuffers()");
         }
         addCmd(dev_data, cb_node, CMD_BINDVERTEXBUFFER, "vkCmdBindVertexBuffer()");
         updateResourceTracking(cb_node, firstBinding, bindingCount, pBuffers);
@@ -6987,20 +7545,12 @@ static bool markStoreImagesAndBuffersAsWritten(layer_data *dev_data, GLOBAL_CB_N
 
         auto img_node = getImageNode(dev_data, iv_data->image);
         assert(img_node);
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, img_node->mem, true, iv_data->image);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        AddSetMemoryValid(pCB, img_node->mem, true, iv_data->image);
     }
     for (auto buffer : pCB->updateBuffers) {
         auto buff_node = getBufferNode(dev_data, buffer);
         assert(buff_node);
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, buff_node->mem, true);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        AddSetMemoryValid(pCB, buff_node->mem, true);
     }
     return skip_call;
 }
@@ -7009,7 +7559,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
                                    uint32_t firstVertex, uint32_t firstInstance) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_DRAW, "vkCmdDraw()");
@@ -7036,7 +7586,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
                                                             uint32_t firstInstance) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_DRAWINDEXED, "vkCmdDrawIndexed()");
@@ -7063,7 +7613,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t count, uint32_t stride) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto buff_node = getBufferNode(dev_data, buffer);
@@ -7095,7 +7645,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t count, uint32_t stride) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto buff_node = getBufferNode(dev_data, buffer);
@@ -7127,7 +7677,7 @@ CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceS
 VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= validate_and_update_draw_state(dev_data, pCB, false, VK_PIPELINE_BIND_POINT_COMPUTE);
@@ -7144,7 +7694,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto buff_node = getBufferNode(dev_data, buffer);
@@ -7165,7 +7715,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
                                          uint32_t regionCount, const VkBufferCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto src_buff_node = getBufferNode(dev_data, srcBuffer);
@@ -7182,15 +7732,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdCopyBuffer()",
                                               "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
 
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_buff_node->mem, "vkCmdCopyBuffer()");
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddMemoryCheck(cb_node, src_buff_node->mem, "vkCmdCopyBuffer()");
+        AddSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYBUFFER, "vkCmdCopyBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyBuffer()");
@@ -7207,22 +7750,23 @@ static bool VerifySourceImageLayout(layer_data *dev_data, GLOBAL_CB_NODE *cb_nod
                                     VkImageSubresourceLayers subLayers, VkImageLayout srcImageLayout) {
     bool skip_call = false;
 
-    for (uint32_t i = 0; i < subLayers.layerCount; ++i) {
-        uint32_t layer = i + subLayers.baseArrayLayer;
-        VkImageSubresource sub = {subLayers.aspectMask, subLayers.mipLevel, layer};
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindLayout(cb_node, srcImage, sub, node)) {
-            SetLayout(cb_node, srcImage, sub, IMAGE_CMD_BUF_LAYOUT_NODE(srcImageLayout, srcImageLayout));
-            continue;
-        }
-        if (node.layout != srcImageLayout) {
-            // TODO: Improve log message in the next pass
-            skip_call |=
-                log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
-                        __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot copy from an image whose source layout is %s "
-                                                                        "and doesn't match the current layout %s.",
-                        string_VkImageLayout(srcImageLayout), string_VkImageLayout(node.layout));
-        }
+    auto layout_map = GetCBLayoutMap(dev_data, cb_node, srcImage);
+    if (layout_map) {
+        VkImageSubresourceRange range = {subLayers.aspectMask, subLayers.mipLevel, 1, subLayers.baseArrayLayer,
+                                         subLayers.layerCount};
+        layout_map->update(range, [&](const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+            if (!node)
+                return IMAGE_CMD_BUF_LAYOUT_NODE(srcImageLayout, srcImageLayout);
+            if (node->layout != srcImageLayout) {
+                // TODO: Improve log message in the next pass
+                skip_call |=
+                    log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
+                            __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot copy from an image whose source layout is %s "
+                                                                            "and doesn't match the current layout %s.",
+                            string_VkImageLayout(srcImageLayout), string_VkImageLayout(node->layout));
+            }
+            return *node;
+        });
     }
     if (srcImageLayout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
         if (srcImageLayout == VK_IMAGE_LAYOUT_GENERAL) {
@@ -7248,21 +7792,22 @@ static bool VerifyDestImageLayout(layer_data *dev_data, GLOBAL_CB_NODE *cb_node,
                                   VkImageSubresourceLayers subLayers, VkImageLayout destImageLayout) {
     bool skip_call = false;
 
-    for (uint32_t i = 0; i < subLayers.layerCount; ++i) {
-        uint32_t layer = i + subLayers.baseArrayLayer;
-        VkImageSubresource sub = {subLayers.aspectMask, subLayers.mipLevel, layer};
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindLayout(cb_node, destImage, sub, node)) {
-            SetLayout(cb_node, destImage, sub, IMAGE_CMD_BUF_LAYOUT_NODE(destImageLayout, destImageLayout));
-            continue;
-        }
-        if (node.layout != destImageLayout) {
-            skip_call |=
-                log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
-                        __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot copy from an image whose dest layout is %s and "
-                                                                        "doesn't match the current layout %s.",
-                        string_VkImageLayout(destImageLayout), string_VkImageLayout(node.layout));
-        }
+    auto layout_map = GetCBLayoutMap(dev_data, cb_node, destImage);
+    if (layout_map) {
+        VkImageSubresourceRange range = {subLayers.aspectMask, subLayers.mipLevel, 1, subLayers.baseArrayLayer,
+                                         subLayers.layerCount};
+        layout_map->update(range, [&](const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+            if (!node)
+                return IMAGE_CMD_BUF_LAYOUT_NODE(destImageLayout, destImageLayout);
+            if (node->layout != destImageLayout) {
+                skip_call |=
+                    log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
+                            __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot copy from an image whose dest layout is %s and "
+                                                                            "doesn't match the current layout %s.",
+                            string_VkImageLayout(destImageLayout), string_VkImageLayout(node->layout));
+            }
+            return *node;
+        });
     }
     if (destImageLayout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
         if (destImageLayout == VK_IMAGE_LAYOUT_GENERAL) {
@@ -7288,7 +7833,7 @@ CmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
              VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto src_img_node = getImageNode(dev_data, srcImage);
@@ -7304,15 +7849,8 @@ CmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
                                              "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateImageUsageFlags(dev_data, dst_img_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdCopyImage()",
                                              "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdCopyImage()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddMemoryCheck(cb_node, src_img_node->mem, "vkCmdCopyImage()", srcImage);
+        AddSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYIMAGE, "vkCmdCopyImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyImage()");
@@ -7334,7 +7872,7 @@ CmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
              VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit *pRegions, VkFilter filter) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto src_img_node = getImageNode(dev_data, srcImage);
@@ -7350,15 +7888,8 @@ CmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
                                              "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateImageUsageFlags(dev_data, dst_img_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdBlitImage()",
                                              "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdBlitImage()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddMemoryCheck(cb_node, src_img_node->mem, "vkCmdBlitImage()", srcImage);
+        AddSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_BLITIMAGE, "vkCmdBlitImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdBlitImage()");
@@ -7376,7 +7907,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                                 uint32_t regionCount, const VkBufferImageCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto src_buff_node = getBufferNode(dev_data, srcBuffer);
@@ -7390,13 +7921,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                               "vkCmdCopyBufferToImage()", "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateImageUsageFlags(dev_data, dst_img_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                              "vkCmdCopyBufferToImage()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() { return validate_memory_is_valid(dev_data, src_buff_node->mem, "vkCmdCopyBufferToImage()"); };
-        cb_node->validate_functions.push_back(function);
+        AddSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
+        AddMemoryCheck(cb_node, src_buff_node->mem, "vkCmdCopyBufferToImage()");
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYBUFFERTOIMAGE, "vkCmdCopyBufferToImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyBufferToImage()");
@@ -7417,7 +7943,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
                                                 uint32_t regionCount, const VkBufferImageCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto src_img_node = getImageNode(dev_data, srcImage);
@@ -7433,15 +7959,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
                                              "vkCmdCopyImageToBuffer()", "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                               "vkCmdCopyImageToBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdCopyImageToBuffer()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddMemoryCheck(cb_node, src_img_node->mem, "vkCmdCopyImageToBuffer()", srcImage);
+        AddSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYIMAGETOBUFFER, "vkCmdCopyImageToBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyImageToBuffer()");
@@ -7461,7 +7980,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
                                            VkDeviceSize dstOffset, VkDeviceSize dataSize, const uint32_t *pData) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
@@ -7472,11 +7991,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
         // Validate that DST buffer has correct usage flags set
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                               "vkCmdUpdateBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_UPDATEBUFFER, "vkCmdUpdateBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyUpdateBuffer()");
@@ -7492,7 +8007,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
@@ -7503,11 +8018,7 @@ CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize ds
         // Validate that DST buffer has correct usage flags set
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdFillBuffer()",
                                               "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_FILLBUFFER, "vkCmdFillBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyFillBuffer()");
@@ -7524,7 +8035,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
                                                const VkClearRect *pRects) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_CLEARATTACHMENTS, "vkCmdClearAttachments()");
@@ -7594,7 +8105,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
                                               uint32_t rangeCount, const VkImageSubresourceRange *pRanges) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     // TODO : Verify memory is in VK_IMAGE_STATE_CLEAR state
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
@@ -7602,11 +8113,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
     if (cb_node && img_node) {
         skip_call |= ValidateMemoryIsBoundToImage(dev_data, img_node, "vkCmdClearColorImage()");
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, img_node, "vkCmdClearColorImage()");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, img_node->mem, true, image);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddSetMemoryValid(cb_node, img_node->mem, true, image);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_CLEARCOLORIMAGE, "vkCmdClearColorImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdClearColorImage()");
@@ -7624,7 +8131,7 @@ CmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageL
                           const VkImageSubresourceRange *pRanges) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     // TODO : Verify memory is in VK_IMAGE_STATE_CLEAR state
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
@@ -7632,11 +8139,7 @@ CmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageL
     if (cb_node && img_node) {
         skip_call |= ValidateMemoryIsBoundToImage(dev_data, img_node, "vkCmdClearDepthStencilImage()");
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, img_node, "vkCmdClearDepthStencilImage()");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, img_node->mem, true, image);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddSetMemoryValid(cb_node, img_node->mem, true, image);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_CLEARDEPTHSTENCILIMAGE, "vkCmdClearDepthStencilImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdClearDepthStencilImage()");
@@ -7654,7 +8157,7 @@ CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout s
                 VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto src_img_node = getImageNode(dev_data, srcImage);
@@ -7665,15 +8168,8 @@ CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout s
         // Update bindings between images and cmd buffer
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, src_img_node, "vkCmdCopyImage()");
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, dst_img_node, "vkCmdCopyImage()");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdResolveImage()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        AddMemoryCheck(cb_node, src_img_node->mem, "vkCmdResolveImage()", srcImage);
+        AddSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_RESOLVEIMAGE, "vkCmdResolveImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdResolveImage()");
@@ -7703,23 +8199,25 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETEVENT, "vkCmdSetEvent()");
         skip_call |= insideRenderPass(dev_data, pCB, "vkCmdSetEvent");
         auto event_node = getEventNode(dev_data, event);
         if (event_node) {
-            addCommandBufferBinding(&event_node->cb_bindings,
+            addCommandBufferBinding(event_node,
                                     {reinterpret_cast<uint64_t &>(event), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT}, pCB);
-            event_node->cb_bindings.insert(pCB);
         }
         pCB->events.push_back(event);
         if (!pCB->waitedEvents.count(event)) {
             pCB->writeEventsBeforeWait.push_back(event);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, stageMask);
+        CB_DEFERRED_CHECK eventUpdate = {};
+        eventUpdate.op = CB_DEFERRED_SET_EVENT;
+        eventUpdate.event.commandBuffer = commandBuffer;
+        eventUpdate.event.event = event;
+        eventUpdate.event.stageMask = stageMask;
         pCB->eventUpdates.push_back(eventUpdate);
     }
     lock.unlock();
@@ -7731,23 +8229,25 @@ VKAPI_ATTR void VKAPI_CALL
 CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_RESETEVENT, "vkCmdResetEvent()");
         skip_call |= insideRenderPass(dev_data, pCB, "vkCmdResetEvent");
         auto event_node = getEventNode(dev_data, event);
         if (event_node) {
-            addCommandBufferBinding(&event_node->cb_bindings,
+            addCommandBufferBinding(event_node,
                                     {reinterpret_cast<uint64_t &>(event), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT}, pCB);
-            event_node->cb_bindings.insert(pCB);
         }
         pCB->events.push_back(event);
         if (!pCB->waitedEvents.count(event)) {
             pCB->writeEventsBeforeWait.push_back(event);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, VkPipelineStageFlags(0));
+        CB_DEFERRED_CHECK eventUpdate = {};
+        eventUpdate.op = CB_DEFERRED_SET_EVENT;
+        eventUpdate.event.commandBuffer = commandBuffer;
+        eventUpdate.event.event = event;
+        eventUpdate.event.stageMask = VkPipelineStageFlags(0);
         pCB->eventUpdates.push_back(eventUpdate);
     }
     lock.unlock();
@@ -7760,39 +8260,28 @@ static bool TransitionImageLayouts(VkCommandBuffer cmdBuffer, uint32_t memBarrie
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(cmdBuffer), layer_data_map);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, cmdBuffer);
     bool skip = false;
-    uint32_t levelCount = 0;
-    uint32_t layerCount = 0;
 
     for (uint32_t i = 0; i < memBarrierCount; ++i) {
         auto mem_barrier = &pImgMemBarriers[i];
         if (!mem_barrier)
             continue;
-        // TODO: Do not iterate over every possibility - consolidate where
-        // possible
-        ResolveRemainingLevelsLayers(dev_data, &levelCount, &layerCount, mem_barrier->subresourceRange, mem_barrier->image);
-
-        for (uint32_t j = 0; j < levelCount; j++) {
-            uint32_t level = mem_barrier->subresourceRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < layerCount; k++) {
-                uint32_t layer = mem_barrier->subresourceRange.baseArrayLayer + k;
-                VkImageSubresource sub = {mem_barrier->subresourceRange.aspectMask, level, layer};
-                IMAGE_CMD_BUF_LAYOUT_NODE node;
-                if (!FindLayout(pCB, mem_barrier->image, sub, node)) {
-                    SetLayout(pCB, mem_barrier->image, sub,
-                              IMAGE_CMD_BUF_LAYOUT_NODE(mem_barrier->oldLayout, mem_barrier->newLayout));
-                    continue;
-                }
-                if (mem_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                    // TODO: Set memory invalid which is in mem_tracker currently
-                } else if (node.layout != mem_barrier->oldLayout) {
-                    skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
-                                    __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "You cannot transition the layout from %s "
-                                                                                    "when current layout is %s.",
-                                    string_VkImageLayout(mem_barrier->oldLayout), string_VkImageLayout(node.layout));
-                }
-                SetLayout(pCB, mem_barrier->image, sub, mem_barrier->newLayout);
+        auto layout_map = GetCBLayoutMap(dev_data, pCB, mem_barrier->image);
+        if (!layout_map)
+            continue;
+        // Each run of subresources that share a layout is checked and transitioned as a unit
+        layout_map->update(mem_barrier->subresourceRange, [&](const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+            if (!node)
+                return IMAGE_CMD_BUF_LAYOUT_NODE(mem_barrier->oldLayout, mem_barrier->newLayout);
+            if (mem_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                // TODO: Set memory invalid which is in mem_tracker currently
+            } else if (node->layout != mem_barrier->oldLayout) {
+                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
+                                __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "You cannot transition the layout from %s "
+                                                                                "when current layout is %s.",
+                                string_VkImageLayout(mem_barrier->oldLayout), string_VkImageLayout(node->layout));
             }
-        }
+            return IMAGE_CMD_BUF_LAYOUT_NODE(node->initialLayout, mem_barrier->newLayout);
+        });
     }
     return skip;
 }
@@ -8155,23 +8644,25 @@ CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent
               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         auto firstEventIndex = pCB->events.size();
         for (uint32_t i = 0; i < eventCount; ++i) {
             auto event_node = getEventNode(dev_data, pEvents[i]);
             if (event_node) {
-                addCommandBufferBinding(&event_node->cb_bindings,
+                addCommandBufferBinding(event_node,
                                         {reinterpret_cast<const uint64_t &>(pEvents[i]), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT},
                                         pCB);
-                event_node->cb_bindings.insert(pCB);
             }
             pCB->waitedEvents.insert(pEvents[i]);
             pCB->events.push_back(pEvents[i]);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(validateEventStageMask, std::placeholders::_1, pCB, eventCount, firstEventIndex, sourceStageMask);
+        CB_DEFERRED_CHECK eventUpdate = {};
+        eventUpdate.op = CB_DEFERRED_WAIT_EVENTS;
+        eventUpdate.wait_events.firstEventIndex = firstEventIndex;
+        eventUpdate.wait_events.eventCount = eventCount;
+        eventUpdate.wait_events.sourceStageMask = sourceStageMask;
         pCB->eventUpdates.push_back(eventUpdate);
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_WAITEVENTS, "vkCmdWaitEvents()");
@@ -8197,7 +8688,7 @@ CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageM
                    uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_PIPELINEBARRIER, "vkCmdPipelineBarrier()");
@@ -8213,6 +8704,16 @@ CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageM
                                                             pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
+// Deferred update of a query's availability when the command buffer is submitted
+static CB_DEFERRED_CHECK MakeQueryUpdate(VkCommandBuffer commandBuffer, QueryObject object, bool available) {
+    CB_DEFERRED_CHECK queryUpdate = {};
+    queryUpdate.op = CB_DEFERRED_SET_QUERY;
+    queryUpdate.query.commandBuffer = commandBuffer;
+    queryUpdate.query.object = object;
+    queryUpdate.query.available = available;
+    return queryUpdate;
+}
+
 bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, QueryObject object, bool value) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
@@ -8230,7 +8731,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         QueryObject query = {queryPool, slot};
@@ -8239,7 +8740,7 @@ CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slo
             pCB->startedQueries.insert(query);
         }
         skip_call |= addCmd(dev_data, pCB, CMD_BEGINQUERY, "vkCmdBeginQuery()");
-        addCommandBufferBinding(&getQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(getQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT}, pCB);
     }
     lock.unlock();
@@ -8250,7 +8751,7 @@ CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slo
 VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         QueryObject query = {queryPool, slot};
@@ -8262,14 +8763,13 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
         } else {
             pCB->activeQueries.erase(query);
         }
-        std::function<bool(VkQueue)> queryUpdate = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        pCB->queryUpdates.push_back(queryUpdate);
+        pCB->queryUpdates.push_back(MakeQueryUpdate(commandBuffer, query, true));
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_ENDQUERY, "VkCmdEndQuery()");
         } else {
             skip_call |= report_error_no_cb_begin(dev_data, commandBuffer, "vkCmdEndQuery()");
         }
-        addCommandBufferBinding(&getQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(getQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT}, pCB);
     }
     lock.unlock();
@@ -8281,14 +8781,13 @@ VKAPI_ATTR void VKAPI_CALL
 CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         for (uint32_t i = 0; i < queryCount; i++) {
             QueryObject query = {queryPool, firstQuery + i};
             pCB->waitedEventsBeforeQueryReset[query] = pCB->waitedEvents;
-            std::function<bool(VkQueue)> queryUpdate = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, false);
-            pCB->queryUpdates.push_back(queryUpdate);
+            pCB->queryUpdates.push_back(MakeQueryUpdate(commandBuffer, query, false));
         }
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_RESETQUERYPOOL, "VkCmdResetQueryPool()");
@@ -8296,7 +8795,7 @@ CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t
             skip_call |= report_error_no_cb_begin(dev_data, commandBuffer, "vkCmdResetQueryPool()");
         }
         skip_call |= insideRenderPass(dev_data, pCB, "vkCmdQueryPool");
-        addCommandBufferBinding(&getQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(getQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT}, pCB);
     }
     lock.unlock();
@@ -8304,9 +8803,9 @@ CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t
         dev_data->device_dispatch_table->CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
 }
 
-bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, uint32_t queryCount, uint32_t firstQuery) {
+bool validateQuery(VkQueue queue, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t queryCount, uint32_t firstQuery) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(pCB->commandBuffer), layer_data_map);
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     auto queue_data = dev_data->queueMap.find(queue);
     if (queue_data == dev_data->queueMap.end())
         return false;
@@ -8343,7 +8842,7 @@ CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, ui
                         VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
 
     auto cb_node = getCBNode(dev_data, commandBuffer);
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
@@ -8354,13 +8853,13 @@ CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, ui
         // Validate that DST buffer has correct usage flags set
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                               "vkCmdCopyQueryPoolResults()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
-        std::function<bool(VkQueue)> queryUpdate =
-            std::bind(validateQuery, std::placeholders::_1, cb_node, queryPool, queryCount, firstQuery);
+        AddSetMemoryValid(cb_node, dst_buff_node->mem, true);
+        CB_DEFERRED_CHECK queryUpdate = {};
+        queryUpdate.op = CB_DEFERRED_VALIDATE_QUERY;
+        queryUpdate.query_range.commandBuffer = commandBuffer;
+        queryUpdate.query_range.queryPool = queryPool;
+        queryUpdate.query_range.firstQuery = firstQuery;
+        queryUpdate.query_range.queryCount = queryCount;
         cb_node->queryUpdates.push_back(queryUpdate);
         if (cb_node->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, cb_node, CMD_COPYQUERYPOOLRESULTS, "vkCmdCopyQueryPoolResults()");
@@ -8368,7 +8867,7 @@ CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, ui
             skip_call |= report_error_no_cb_begin(dev_data, commandBuffer, "vkCmdCopyQueryPoolResults()");
         }
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyQueryPoolResults()");
-        addCommandBufferBinding(&getQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(getQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT}, cb_node);
     } else {
         assert(0);
@@ -8384,7 +8883,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
                                             const void *pValues) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         if (pCB->state == CB_RECORDING) {
@@ -8474,12 +8973,11 @@ VKAPI_ATTR void VKAPI_CALL
 CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t slot) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         QueryObject query = {queryPool, slot};
-        std::function<bool(VkQueue)> queryUpdate = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        pCB->queryUpdates.push_back(queryUpdate);
+        pCB->queryUpdates.push_back(MakeQueryUpdate(commandBuffer, query, true));
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_WRITETIMESTAMP, "vkCmdWriteTimestamp()");
         } else {
@@ -8684,7 +9182,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFrameb
                                                  const VkAllocationCallbacks *pAllocator,
                                                  VkFramebuffer *pFramebuffer) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip_call = PreCallValidateCreateFramebuffer(dev_data, pCreateInfo);
     lock.unlock();
 
@@ -9063,28 +9561,341 @@ static bool CreatePassDAG(const layer_data *my_data, VkDevice device, const VkRe
 }
 
 
+// Shader cache: identical SPIR-V is validated and analysed once per device. With
+//  lunarg_core_validation.shader_cache_file set, the analyses also persist across runs.
+
+// 128-bit content hash of a SPIR-V module; the word count is folded into both halves
+static spirv_hash_t hash_spirv(uint32_t const *code, size_t count) {
+    uint64_t a = 0xcbf29ce484222325ull ^ count;
+    uint64_t b = 0x9E3779B97F4A7C15ull + count;
+    for (size_t i = 0; i < count; i++) {
+        a = (a ^ code[i]) * 0x100000001b3ull;
+        b = (b + code[i]) * 0xBF58476D1CE4E5B9ull;
+        b ^= b >> 31;
+    }
+    return std::make_pair(a, b);
+}
+
+// Evicts entries until the cache holds at most limit of them. Entries from earlier runs that this run has not used
+//  are older than any it has, so they go first.
+static void trim_shader_cache(layer_data *dev_data, size_t limit) {
+    size_t total = dev_data->shaderModuleCache.size() + dev_data->shaderCacheRecords.size();
+    if (total <= limit) {
+        return;
+    }
+    if (!limit) {
+        dev_data->shaderModuleCache.clear();
+        dev_data->shaderCacheRecords.clear();
+        return;
+    }
+    std::vector<uint64_t> uses;
+    uses.reserve(total);
+    for (auto const &cached : dev_data->shaderModuleCache) {
+        uses.push_back(cached.second.last_use);
+    }
+    for (auto const &record : dev_data->shaderCacheRecords) {
+        uses.push_back(record.second.last_use);
+    }
+    // Uses are unique, so everything used before the oldest entry that stays is evicted
+    std::nth_element(uses.begin(), uses.begin() + (total - limit), uses.end());
+    uint64_t oldest_kept = uses[total - limit];
+    for (auto map : {&dev_data->shaderModuleCache, &dev_data->shaderCacheRecords}) {
+        for (auto it = map->begin(); it != map->end();) {
+            it = (it->second.last_use < oldest_kept) ? map->erase(it) : std::next(it);
+        }
+    }
+}
+
+static void add_cached_shader_module(layer_data *dev_data, spirv_hash_t const &hash, shared_ptr<shader_module> const &module) {
+    dev_data->shaderModuleCache[hash] = {module, ++dev_data->shaderCacheUseCount};
+    size_t limit = dev_data->shaderCacheMaxEntries;
+    if (dev_data->shaderModuleCache.size() + dev_data->shaderCacheRecords.size() > limit) {
+        // Make room for a batch of new entries at a time rather than evicting on every insertion
+        trim_shader_cache(dev_data, limit - limit / 8);
+    }
+}
+
+// Returns the analysed module for pCreateInfo's code if this device has seen the same code before. A hit is only
+//  taken if the stored code matches word for word, so neither a hash collision nor a damaged cache file can make
+//  unvalidated code look validated.
+static shared_ptr<shader_module> find_cached_shader_module(layer_data *dev_data, spirv_hash_t const &hash,
+                                                           VkShaderModuleCreateInfo const *pCreateInfo) {
+    size_t count = pCreateInfo->codeSize / sizeof(uint32_t);
+    auto cached = dev_data->shaderModuleCache.find(hash);
+    if (cached != dev_data->shaderModuleCache.end()) {
+        auto const &words = cached->second.module->words;
+        if (words.size() == count && std::equal(words.begin(), words.end(), pCreateInfo->pCode)) {
+            cached->second.last_use = ++dev_data->shaderCacheUseCount;
+            return cached->second.module;
+        }
+        return nullptr;
+    }
+
+    auto record_it = dev_data->shaderCacheRecords.find(hash);
+    if (record_it == dev_data->shaderCacheRecords.end()) {
+        return nullptr;
+    }
+    shared_ptr<shader_module> module = record_it->second.module;
+    auto const &words = module->words;
+    if (words.size() != count || !std::equal(words.begin(), words.end(), pCreateInfo->pCode)) {
+        return nullptr;
+    }
+    dev_data->shaderCacheRecords.erase(record_it);
+    // def_index is not stored, as rebuilding it costs one walk over the code. Analyses must be keyed on the code's own
+    //  OpEntryPoints, or a damaged file could point them anywhere.
+    build_def_index(module.get());
+    std::unordered_set<unsigned> entrypoint_offsets;
+    for (auto insn : *module) {
+        if (insn.opcode() == spv::OpEntryPoint)
+            entrypoint_offsets.insert(insn.offset());
+    }
+    for (auto const &entry : module->entrypoints) {
+        if (!entrypoint_offsets.count(entry.first))
+            return nullptr;
+    }
+    add_cached_shader_module(dev_data, hash, module);
+    return module;
+}
+
+static const uint32_t SHADER_CACHE_MAGIC = 0x4353564b; // "KVSC"
+// Bump whenever the record layout below, or what the analyses stored in it mean, changes. A cache file with any other
+//  version is ignored and rewritten.
+static const uint32_t SHADER_CACHE_VERSION = 2;
+
+static void write_interface_var(std::vector<uint32_t> &out, interface_var const &var) {
+    uint32_t words[] = {var.id, var.type_id, var.offset, var.is_patch, var.is_block_member};
+    out.insert(out.end(), words, words + 5);
+}
+
+static void write_shader_cache_record(std::vector<uint32_t> &out, spirv_hash_t const &hash, shader_module const *module) {
+    uint32_t header[] = {(uint32_t)hash.first, (uint32_t)(hash.first >> 32), (uint32_t)hash.second, (uint32_t)(hash.second >> 32)};
+    out.insert(out.end(), header, header + 4);
+    out.push_back((uint32_t)module->words.size());
+    out.insert(out.end(), module->words.begin(), module->words.end());
+    out.push_back((uint32_t)module->entrypoints.size());
+    for (auto const &entry : module->entrypoints) {
+        auto const &analysis = entry.second;
+        uint32_t flags = analysis.have_descriptor_uses;
+        for (unsigned i = 0; i < 4; i++) {
+            flags |= analysis.have_interface[i >> 1][i & 1] << (i + 1);
+        }
+        out.push_back(entry.first);
+        out.push_back(flags);
+        if (analysis.have_descriptor_uses) {
+            out.push_back((uint32_t)analysis.accessible_ids.size());
+            out.insert(out.end(), analysis.accessible_ids.begin(), analysis.accessible_ids.end());
+            out.push_back((uint32_t)analysis.descriptor_uses.size());
+            for (auto const &use : analysis.descriptor_uses) {
+                out.push_back(use.first.first);
+                out.push_back(use.first.second);
+                write_interface_var(out, use.second);
+            }
+        }
+        for (unsigned i = 0; i < 4; i++) {
+            if (analysis.have_interface[i >> 1][i & 1]) {
+                auto const &vars = analysis.interface[i >> 1][i & 1];
+                out.push_back((uint32_t)vars.size());
+                for (auto const &var : vars) {
+                    out.push_back(var.first.first);
+                    out.push_back(var.first.second);
+                    write_interface_var(out, var.second);
+                }
+            }
+        }
+    }
+}
+
+// Bounds-checked reader over the contents of a shader cache file
+struct shader_cache_reader {
+    std::vector<uint32_t> const &data;
+    size_t pos;
+    bool ok;
+
+    shader_cache_reader(std::vector<uint32_t> const &data) : data(data), pos(0), ok(true) {}
+
+    uint32_t read() {
+        if (pos >= data.size()) {
+            ok = false;
+            return 0;
+        }
+        return data[pos++];
+    }
+    uint64_t read64() {
+        uint64_t lo = read();
+        return lo | ((uint64_t)read() << 32);
+    }
+    // Element counts are checked against what is left so that a damaged file can't trigger huge allocations
+    uint32_t read_count(size_t words_per_element) {
+        uint32_t count = read();
+        if (count > (data.size() - pos) / words_per_element) {
+            ok = false;
+            return 0;
+        }
+        return count;
+    }
+    interface_var read_interface_var() {
+        interface_var var;
+        var.id = read();
+        var.type_id = read();
+        var.offset = read();
+        var.is_patch = read() != 0;
+        var.is_block_member = read() != 0;
+        return var;
+    }
+};
+
+static unique_ptr<shader_module> read_shader_cache_record(shader_cache_reader &in, spirv_hash_t &hash) {
+    unique_ptr<shader_module> module(new shader_module());
+    hash.first = in.read64();
+    hash.second = in.read64();
+    uint32_t word_count = in.read_count(1);
+    module->words.assign(in.data.begin() + in.pos, in.data.begin() + in.pos + word_count);
+    in.pos += word_count;
+    uint32_t entry_count = in.read_count(2);
+    for (uint32_t i = 0; i < entry_count && in.ok; i++) {
+        auto &analysis = module->entrypoints[in.read()];
+        uint32_t flags = in.read();
+        if (flags & 1) {
+            uint32_t id_count = in.read_count(1);
+            for (uint32_t j = 0; j < id_count; j++) {
+                analysis.accessible_ids.insert(in.read());
+            }
+            uint32_t use_count = in.read_count(7);
+            for (uint32_t j = 0; j < use_count; j++) {
+                descriptor_slot_t slot;
+                slot.first = in.read();
+                slot.second = in.read();
+                analysis.descriptor_uses.emplace_back(slot, in.read_interface_var());
+            }
+            analysis.have_descriptor_uses = true;
+        }
+        for (unsigned k = 0; k < 4; k++) {
+            if (flags & (2u << k)) {
+                uint32_t var_count = in.read_count(7);
+                for (uint32_t j = 0; j < var_count; j++) {
+                    location_t location;
+                    location.first = in.read();
+                    location.second = in.read();
+                    analysis.interface[k >> 1][k & 1][location] = in.read_interface_var();
+                }
+                analysis.have_interface[k >> 1][k & 1] = true;
+            }
+        }
+    }
+    return module;
+}
+
+static void load_shader_cache(layer_data *dev_data) {
+    FILE *file = fopen(dev_data->shaderCacheFile.c_str(), "rb");
+    if (!file) {
+        return; // Nothing cached yet
+    }
+    std::vector<uint32_t> data;
+    uint32_t buffer[1024];
+    size_t count;
+    while ((count = fread(buffer, sizeof(uint32_t), 1024, file)) > 0) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(file);
+
+    shader_cache_reader in(data);
+    if (in.read() != SHADER_CACHE_MAGIC || in.read() != SHADER_CACHE_VERSION) {
+        return; // Written by another version of the layer; it will be replaced on DestroyDevice
+    }
+    // Records are stored most recently used first
+    uint32_t record_count = in.read();
+    for (uint32_t i = 0; i < record_count && in.ok && i < dev_data->shaderCacheMaxEntries; i++) {
+        spirv_hash_t hash;
+        auto record = read_shader_cache_record(in, hash);
+        if (in.ok) {
+            dev_data->shaderCacheRecords[hash] = {shared_ptr<shader_module>(record.release()), record_count - i};
+        }
+    }
+    dev_data->shaderCacheUseCount = record_count;
+    if (!in.ok) {
+        log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
+                (uint64_t)dev_data->device, __LINE__, SHADER_CHECKER_NONE, "SC",
+                "Shader cache file %s is damaged; its remaining entries were ignored", dev_data->shaderCacheFile.c_str());
+    }
+}
+
+static void save_shader_cache(layer_data *dev_data) {
+    // Keep what earlier runs cached even if this run didn't use it, up to the size limit
+    trim_shader_cache(dev_data, dev_data->shaderCacheMaxEntries);
+    std::vector<std::pair<uint64_t, std::pair<spirv_hash_t, shader_module const *>>> entries;
+    for (auto map : {&dev_data->shaderModuleCache, &dev_data->shaderCacheRecords}) {
+        for (auto const &entry : *map) {
+            entries.push_back(std::make_pair(entry.second.last_use, std::make_pair(entry.first, entry.second.module.get())));
+        }
+    }
+    // Most recently used first, so that a smaller limit in a later run keeps the right records
+    std::sort(entries.rbegin(), entries.rend());
+
+    std::vector<uint32_t> out;
+    out.push_back(SHADER_CACHE_MAGIC);
+    out.push_back(SHADER_CACHE_VERSION);
+    out.push_back((uint32_t)entries.size());
+    for (auto const &entry : entries) {
+        write_shader_cache_record(out, entry.second.first, entry.second.second);
+    }
+
+    // Write a file of our own and move it over the cache, so that a crash or another process saving at the same time
+    //  can't leave a truncated or interleaved cache behind
+#if defined(_WIN32)
+    int pid = _getpid();
+#else
+    int pid = getpid();
+#endif
+    std::string temp_file = dev_data->shaderCacheFile + "." + std::to_string(pid) + ".tmp";
+    FILE *file = fopen(temp_file.c_str(), "wb");
+    bool written = file && fwrite(out.data(), sizeof(uint32_t), out.size(), file) == out.size();
+    if (file) {
+        written = (fclose(file) == 0) && written;
+    }
+#if defined(_WIN32)
+    written = written && MoveFileExA(temp_file.c_str(), dev_data->shaderCacheFile.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    written = written && rename(temp_file.c_str(), dev_data->shaderCacheFile.c_str()) == 0;
+#endif
+    if (!written) {
+        remove(temp_file.c_str());
+        log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
+                (uint64_t)dev_data->device, __LINE__, SHADER_CHECKER_NONE, "SC", "Could not write shader cache file %s",
+                dev_data->shaderCacheFile.c_str());
+    }
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator,
                                                   VkShaderModule *pShaderModule) {
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    /* Use SPIRV-Tools validator to try and catch any issues with the module itself */
-    spv_context ctx = spvContextCreate(SPV_ENV_VULKAN_1_0);
-    spv_const_binary_t binary { pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t) };
-    spv_diagnostic diag = nullptr;
+    auto hash = hash_spirv(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t));
+    std::unique_lock<rw_lock> lock(global_lock);
+    // Code that is already cached passed spvValidate cleanly, so only new code needs validating
+    auto module = find_cached_shader_module(my_data, hash, pCreateInfo);
+    lock.unlock();
+
+    auto result = SPV_SUCCESS;
+    if (!module) {
+        /* Use SPIRV-Tools validator to try and catch any issues with the module itself */
+        spv_context ctx = spvContextCreate(SPV_ENV_VULKAN_1_0);
+        spv_const_binary_t binary { pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t) };
+        spv_diagnostic diag = nullptr;
 
-    auto result = spvValidate(ctx, &binary, &diag);
-    if (result != SPV_SUCCESS) {
-        skip_call |= log_msg(my_data->report_data,
-                             result == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                             VkDebugReportObjectTypeEXT(0), 0,
-                             __LINE__, SHADER_CHECKER_INCONSISTENT_SPIRV, "SC", "SPIR-V module not valid: %s",
-                             diag && diag->error ? diag->error : "(no error text)");
-    }
+        result = spvValidate(ctx, &binary, &diag);
+        if (result != SPV_SUCCESS) {
+            skip_call |= log_msg(my_data->report_data,
+                                 result == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                 VkDebugReportObjectTypeEXT(0), 0,
+                                 __LINE__, SHADER_CHECKER_INCONSISTENT_SPIRV, "SC", "SPIR-V module not valid: %s",
+                                 diag && diag->error ? diag->error : "(no error text)");
+        }
 
-    spvDiagnosticDestroy(diag);
-    spvContextDestroy(ctx);
+        spvDiagnosticDestroy(diag);
+        spvContextDestroy(ctx);
+    }
 
     if (skip_call)
         return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -9092,8 +9903,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult res = my_data->device_dispatch_table->CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
 
     if (res == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        my_data->shaderModuleMap[*pShaderModule] = unique_ptr<shader_module>(new shader_module(pCreateInfo));
+        lock.lock();
+        if (!module) {
+            module = std::make_shared<shader_module>(pCreateInfo);
+            if (result == SPV_SUCCESS) {
+                add_cached_shader_module(my_data, hash, module);
+            }
+        }
+        my_data->shaderModuleMap[*pShaderModule] = module;
     }
     return res;
 }
@@ -9202,7 +10019,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     skip_call |= ValidateLayouts(dev_data, device, pCreateInfo);
     // TODO: As part of wrapping up the mem_tracker/core_validation merge the following routine should be consolidated with
@@ -9361,35 +10178,28 @@ static bool VerifyFramebufferAndRenderPassLayouts(layer_data *dev_data, GLOBAL_C
         const VkImageView &image_view = framebufferInfo.pAttachments[i];
         auto image_data = getImageViewData(dev_data, image_view);
         assert(image_data);
-        const VkImage &image = image_data->image;
-        const VkImageSubresourceRange &subRange = image_data->subresourceRange;
+        auto layout_map = GetCBLayoutMap(dev_data, pCB, image_data->image);
+        if (!layout_map)
+            continue;
         IMAGE_CMD_BUF_LAYOUT_NODE newNode = {pRenderPassInfo->pAttachments[i].initialLayout,
                                              pRenderPassInfo->pAttachments[i].initialLayout};
-        // TODO: Do not iterate over every possibility - consolidate where possible
-        for (uint32_t j = 0; j < subRange.levelCount; j++) {
-            uint32_t level = subRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < subRange.layerCount; k++) {
-                uint32_t layer = subRange.baseArrayLayer + k;
-                VkImageSubresource sub = {subRange.aspectMask, level, layer};
-                IMAGE_CMD_BUF_LAYOUT_NODE node;
-                if (!FindLayout(pCB, image, sub, node)) {
-                    SetLayout(pCB, image, sub, newNode);
-                    continue;
-                }
-                if (newNode.layout != VK_IMAGE_LAYOUT_UNDEFINED &&
-                    newNode.layout != node.layout) {
-                    skip_call |=
-                        log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
-                                DRAWSTATE_INVALID_RENDERPASS, "DS",
-                                "You cannot start a render pass using attachment %u "
-                                "where the render pass initial layout is %s and the previous "
-                                "known layout of the attachment is %s. The layouts must match, or "
-                                "the render pass initial layout for the attachment must be "
-                                "VK_IMAGE_LAYOUT_UNDEFINED",
-                                i, string_VkImageLayout(newNode.layout), string_VkImageLayout(node.layout));
-                }
+        layout_map->update(image_data->subresourceRange, [&](const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+            if (!node)
+                return newNode;
+            if (newNode.layout != VK_IMAGE_LAYOUT_UNDEFINED &&
+                newNode.layout != node->layout) {
+                skip_call |=
+                    log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+                            DRAWSTATE_INVALID_RENDERPASS, "DS",
+                            "You cannot start a render pass using attachment %u "
+                            "where the render pass initial layout is %s and the previous "
+                            "known layout of the attachment is %s. The layouts must match, or "
+                            "the render pass initial layout for the attachment must be "
+                            "VK_IMAGE_LAYOUT_UNDEFINED",
+                            i, string_VkImageLayout(newNode.layout), string_VkImageLayout(node->layout));
             }
-        }
+            return *node;
+        });
     }
     return skip_call;
 }
@@ -9489,7 +10299,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, VkSubpassContents contents) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     auto renderPass = pRenderPassBegin ? getRenderPass(dev_data, pRenderPassBegin->renderPass) : nullptr;
     auto framebuffer = pRenderPassBegin ? getFramebuffer(dev_data, pRenderPassBegin->framebuffer) : nullptr;
@@ -9504,32 +10314,18 @@ CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *p
                                                          renderPass->attachments[i].stencil_load_op,
                                                          VK_ATTACHMENT_LOAD_OP_CLEAR)) {
                     clear_op_size = static_cast<uint32_t>(i) + 1;
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, true, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddSetMemoryValid(pCB, fb_info.mem, true, fb_info.image);
                 } else if (FormatSpecificLoadAndStoreOpSettings(format, renderPass->attachments[i].load_op,
                                                                 renderPass->attachments[i].stencil_load_op,
                                                                 VK_ATTACHMENT_LOAD_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, false, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddSetMemoryValid(pCB, fb_info.mem, false, fb_info.image);
                 } else if (FormatSpecificLoadAndStoreOpSettings(format, renderPass->attachments[i].load_op,
                                                                 renderPass->attachments[i].stencil_load_op,
                                                                 VK_ATTACHMENT_LOAD_OP_LOAD)) {
-                    std::function<bool()> function = [=]() {
-                        return validate_memory_is_valid(dev_data, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddMemoryCheck(pCB, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
                 }
                 if (renderPass->attachment_first_read[renderPass->attachments[i].attachment]) {
-                    std::function<bool()> function = [=]() {
-                        return validate_memory_is_valid(dev_data, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddMemoryCheck(pCB, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
                 }
             }
             if (clear_op_size > pRenderPassBegin->clearValueCount) {
@@ -9558,7 +10354,9 @@ CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *p
             pCB->activeSubpassContents = contents;
             pCB->framebuffers.insert(pRenderPassBegin->framebuffer);
             // Connect this framebuffer to this cmdBuffer
-            framebuffer->cb_bindings.insert(pCB);
+            addCommandBufferBinding(framebuffer, {reinterpret_cast<const uint64_t &>(pRenderPassBegin->framebuffer),
+                                                  VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT},
+                                    pCB);
 
             // transition attachments to the correct layouts for the first subpass
             TransitionSubpassLayouts(dev_data, pCB, &pCB->activeRenderPassBeginInfo, pCB->activeSubpass);
@@ -9577,7 +10375,7 @@ CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *p
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip_call |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdNextSubpass");
@@ -9595,7 +10393,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_recording_lock lock(dev_data, commandBuffer);
     auto pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         RENDER_PASS_NODE* pRPNode = pCB->activeRenderPass;
@@ -9606,19 +10404,11 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
                 VkFormat format = pRPNode->pCreateInfo->pAttachments[pRPNode->attachments[i].attachment].format;
                 if (FormatSpecificLoadAndStoreOpSettings(format, pRPNode->attachments[i].store_op,
                                                          pRPNode->attachments[i].stencil_store_op, VK_ATTACHMENT_STORE_OP_STORE)) {
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, true, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddSetMemoryValid(pCB, fb_info.mem, true, fb_info.image);
                 } else if (FormatSpecificLoadAndStoreOpSettings(format, pRPNode->attachments[i].store_op,
                                                                 pRPNode->attachments[i].stencil_store_op,
                                                                 VK_ATTACHMENT_STORE_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, false, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    AddSetMemoryValid(pCB, fb_info.mem, false, fb_info.image);
                 }
             }
         }
@@ -9836,7 +10626,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount, const VkCommandBuffer *pCommandBuffers) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         GLOBAL_CB_NODE *pSubCB = NULL;
@@ -9937,9 +10727,7 @@ CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount,
             pSubCB->primaryCommandBuffer = pCB->commandBuffer;
             pCB->secondaryCommandBuffers.insert(pSubCB->commandBuffer);
             dev_data->globalInFlightCmdBuffers.insert(pSubCB->commandBuffer);
-            for (auto &function : pSubCB->queryUpdates) {
-                pCB->queryUpdates.push_back(function);
-            }
+            pCB->queryUpdates.insert(pCB->queryUpdates.end(), pSubCB->queryUpdates.begin(), pSubCB->queryUpdates.end());
         }
         skip_call |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdExecuteComands");
         skip_call |= addCmd(dev_data, pCB, CMD_EXECUTECOMMANDS, "vkCmdExecuteComands()");
@@ -9975,7 +10763,7 @@ MapMemory(VkDevice device, VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize
 
     bool skip_call = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 #if MTMERGESOURCE
     DEVICE_MEM_INFO *pMemObj = getMemObjInfo(dev_data, mem);
     if (pMemObj) {
@@ -10011,7 +10799,7 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory mem) {
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     skip_call |= deleteMemRanges(my_data, mem);
     lock.unlock();
     if (!skip_call) {
@@ -10056,7 +10844,26 @@ static bool validateAndCopyNoncoherentMemoryToDriver(layer_data *my_data, uint32
     for (uint32_t i = 0; i < memRangeCount; ++i) {
         auto mem_info = getMemObjInfo(my_data, pMemRanges[i].memory);
         if (mem_info) {
-            if (mem_info->pData) {
+            if (mem_info->shadow) {
+                // Offsets in pMemRanges are from the start of the memory object, the shadow's from the mapped offset. A range
+                //  starting before the mapping (reported by validateMemoryIsMapped) is cut down to the part that is mapped.
+                VkDeviceSize offset = pMemRanges[i].offset;
+                VkDeviceSize size = pMemRanges[i].size;
+                if (offset < mem_info->memRange.offset) {
+                    VkDeviceSize unmapped = mem_info->memRange.offset - offset;
+                    if (size != VK_WHOLE_SIZE)
+                        size = (size > unmapped) ? size - unmapped : 0;
+                    offset = 0;
+                } else {
+                    offset -= mem_info->memRange.offset;
+                }
+                if (mem_info->shadow->flush(offset, size)) {
+                    skip_call |= log_msg(
+                        my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
+                        (uint64_t)pMemRanges[i].memory, __LINE__, MEMTRACK_INVALID_MAP, "MEM",
+                        "Memory overflow was detected on mem obj 0x%" PRIxLEAST64, (uint64_t)pMemRanges[i].memory);
+                }
+            } else if (mem_info->pData) {
                 VkDeviceSize size = mem_info->memRange.size;
                 VkDeviceSize half_size = (size / 2);
                 char *data = static_cast<char *>(mem_info->pData);
@@ -10089,7 +10896,7 @@ FlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMappedM
     bool skip_call = false;
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     skip_call |= validateAndCopyNoncoherentMemoryToDriver(my_data, memRangeCount, pMemRanges);
     skip_call |= validateMemoryIsMapped(my_data, "vkFlushMappedMemoryRanges", memRangeCount, pMemRanges);
     lock.unlock();
@@ -10105,7 +10912,7 @@ InvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMa
     bool skip_call = false;
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     skip_call |= validateMemoryIsMapped(my_data, "vkInvalidateMappedMemoryRanges", memRangeCount, pMemRanges);
     lock.unlock();
     if (!skip_call) {
@@ -10118,7 +10925,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(VkDevice device, VkImage image, V
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto image_node = getImageNode(dev_data, image);
     if (image_node) {
         // Track objects tied to memory
@@ -10162,7 +10969,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
     bool skip_call = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto event_node = getEventNode(dev_data, event);
     if (event_node) {
         event_node->needsSignaled = false;
@@ -10194,7 +11001,7 @@ QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *p
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pFence = getFenceNode(dev_data, fence);
     auto pQueue = getQueueNode(dev_data, queue);
 
@@ -10264,7 +11071,6 @@ QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *p
             }
         }
     }
-    print_mem_list(dev_data);
     lock.unlock();
 
     if (!skip_call)
@@ -10278,7 +11084,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphor
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         SEMAPHORE_NODE* sNode = &dev_data->semaphoreMap[*pSemaphore];
         sNode->signaled = false;
         sNode->queue = VK_NULL_HANDLE;
@@ -10292,7 +11098,7 @@ CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo, const VkAlloc
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateEvent(device, pCreateInfo, pAllocator, pEvent);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->eventMap[*pEvent].needsSignaled = false;
         dev_data->eventMap[*pEvent].in_use.store(0);
         dev_data->eventMap[*pEvent].write_in_use = 0;
@@ -10308,7 +11114,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
     VkResult result = dev_data->device_dispatch_table->CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->device_extensions.swapchainMap[*pSwapchain] = unique_ptr<SWAPCHAIN_NODE>(new SWAPCHAIN_NODE(pCreateInfo));
     }
 
@@ -10320,21 +11126,12 @@ DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocatio
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto swapchain_data = getSwapchainNode(dev_data, swapchain);
     if (swapchain_data) {
         if (swapchain_data->images.size() > 0) {
             for (auto swapchain_image : swapchain_data->images) {
-                auto image_sub = dev_data->imageSubresourceMap.find(swapchain_image);
-                if (image_sub != dev_data->imageSubresourceMap.end()) {
-                    for (auto imgsubpair : image_sub->second) {
-                        auto image_item = dev_data->imageLayoutMap.find(imgsubpair);
-                        if (image_item != dev_data->imageLayoutMap.end()) {
-                            dev_data->imageLayoutMap.erase(image_item);
-                        }
-                    }
-                    dev_data->imageSubresourceMap.erase(image_sub);
-                }
+                dev_data->imageLayoutMap.erase(swapchain_image);
                 skip_call =
                     clear_object_binding(dev_data, (uint64_t)swapchain_image, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT);
                 dev_data->imageMap.erase(swapchain_image);
@@ -10356,7 +11153,7 @@ GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pCoun
         // This should never happen and is checked by param checker.
         if (!pCount)
             return result;
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         const size_t count = *pCount;
         auto swapchain_node = getSwapchainNode(dev_data, swapchain);
         if (swapchain_node && !swapchain_node->images.empty()) {
@@ -10373,9 +11170,6 @@ GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pCoun
             }
         }
         for (uint32_t i = 0; i < *pCount; ++i) {
-            IMAGE_LAYOUT_NODE image_layout_node;
-            image_layout_node.layout = VK_IMAGE_LAYOUT_UNDEFINED;
-            image_layout_node.format = swapchain_node->createInfo.imageFormat;
             // Add imageMap entries for each swapchain image
             VkImageCreateInfo image_ci = {};
             image_ci.mipLevels = 1;
@@ -10391,9 +11185,7 @@ GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pCoun
             image_node->valid = false;
             image_node->mem = MEMTRACKER_SWAP_CHAIN_IMAGE_KEY;
             swapchain_node->images.push_back(pSwapchainImages[i]);
-            ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
-            dev_data->imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
-            dev_data->imageLayoutMap[subpair] = image_layout_node;
+            InitImageLayouts(dev_data, pSwapchainImages[i], &image_ci, VK_IMAGE_LAYOUT_UNDEFINED);
             dev_data->device_extensions.imageToSwapchainMap[pSwapchainImages[i]] = swapchain;
         }
     }
@@ -10404,7 +11196,10 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     bool skip_call = false;
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
+    if (!dev_data->stateDumpFile.empty() && state_dump_requested.exchange(false)) {
+        dump_layer_state(dev_data, "vkQueuePresentKHR");
+    }
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
         auto pSemaphore = getSemaphoreNode(dev_data, pPresentInfo->pWaitSemaphores[i]);
         if (pSemaphore && !pSemaphore->signaled) {
@@ -10462,7 +11257,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainK
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pSemaphore = getSemaphoreNode(dev_data, semaphore);
     if (pSemaphore && pSemaphore->signaled) {
         skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,
@@ -10613,7 +11408,7 @@ CreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCre
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     VkResult res = pTable->CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
     if (VK_SUCCESS == res) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         res = layer_create_msg_callback(my_data->report_data, false, pCreateInfo, pAllocator, pMsgCallback);
     }
     return res;
@@ -10625,7 +11420,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance,
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(instance), layer_data_map);
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     pTable->DestroyDebugReportCallbackEXT(instance, msgCallback, pAllocator);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     layer_destroy_msg_callback(my_data->report_data, msgCallback, pAllocator);
 }
 
@@ -10722,190 +11517,166 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance
     return pTable->GetInstanceProcAddr(instance, funcName);
 }
 
+static const layer_proc_table core_instance_commands = {
+    { "vkGetInstanceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetInstanceProcAddr) },
+    { "vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr) },
+    { "vkCreateInstance", reinterpret_cast<PFN_vkVoidFunction>(CreateInstance) },
+    { "vkCreateDevice", reinterpret_cast<PFN_vkVoidFunction>(CreateDevice) },
+    { "vkEnumeratePhysicalDevices", reinterpret_cast<PFN_vkVoidFunction>(EnumeratePhysicalDevices) },
+    { "vkGetPhysicalDeviceQueueFamilyProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceQueueFamilyProperties) },
+    { "vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance) },
+    { "vkEnumerateInstanceLayerProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateInstanceLayerProperties) },
+    { "vkEnumerateDeviceLayerProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceLayerProperties) },
+    { "vkEnumerateInstanceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateInstanceExtensionProperties) },
+    { "vkEnumerateDeviceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceExtensionProperties) },
+};
+
 static PFN_vkVoidFunction
 intercept_core_instance_command(const char *name) {
-    static const struct {
-        const char *name;
-        PFN_vkVoidFunction proc;
-    } core_instance_commands[] = {
-        { "vkGetInstanceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetInstanceProcAddr) },
-        { "vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr) },
-        { "vkCreateInstance", reinterpret_cast<PFN_vkVoidFunction>(CreateInstance) },
-        { "vkCreateDevice", reinterpret_cast<PFN_vkVoidFunction>(CreateDevice) },
-        { "vkEnumeratePhysicalDevices", reinterpret_cast<PFN_vkVoidFunction>(EnumeratePhysicalDevices) },
-        { "vkGetPhysicalDeviceQueueFamilyProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceQueueFamilyProperties) },
-        { "vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance) },
-        { "vkEnumerateInstanceLayerProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateInstanceLayerProperties) },
-        { "vkEnumerateDeviceLayerProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceLayerProperties) },
-        { "vkEnumerateInstanceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateInstanceExtensionProperties) },
-        { "vkEnumerateDeviceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceExtensionProperties) },
-    };
-
-    for (size_t i = 0; i < ARRAY_SIZE(core_instance_commands); i++) {
-        if (!strcmp(core_instance_commands[i].name, name))
-            return core_instance_commands[i].proc;
-    }
-
-    return nullptr;
-}
+    return core_instance_commands.find(name);
+}
+
+static const layer_proc_table core_device_commands = {
+    {"vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr)},
+    {"vkQueueSubmit", reinterpret_cast<PFN_vkVoidFunction>(QueueSubmit)},
+    {"vkWaitForFences", reinterpret_cast<PFN_vkVoidFunction>(WaitForFences)},
+    {"vkGetFenceStatus", reinterpret_cast<PFN_vkVoidFunction>(GetFenceStatus)},
+    {"vkQueueWaitIdle", reinterpret_cast<PFN_vkVoidFunction>(QueueWaitIdle)},
+    {"vkDeviceWaitIdle", reinterpret_cast<PFN_vkVoidFunction>(DeviceWaitIdle)},
+    {"vkGetDeviceQueue", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceQueue)},
+    {"vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance)},
+    {"vkDestroyDevice", reinterpret_cast<PFN_vkVoidFunction>(DestroyDevice)},
+    {"vkDestroyFence", reinterpret_cast<PFN_vkVoidFunction>(DestroyFence)},
+    {"vkResetFences", reinterpret_cast<PFN_vkVoidFunction>(ResetFences)},
+    {"vkDestroySemaphore", reinterpret_cast<PFN_vkVoidFunction>(DestroySemaphore)},
+    {"vkDestroyEvent", reinterpret_cast<PFN_vkVoidFunction>(DestroyEvent)},
+    {"vkDestroyQueryPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyQueryPool)},
+    {"vkDestroyBuffer", reinterpret_cast<PFN_vkVoidFunction>(DestroyBuffer)},
+    {"vkDestroyBufferView", reinterpret_cast<PFN_vkVoidFunction>(DestroyBufferView)},
+    {"vkDestroyImage", reinterpret_cast<PFN_vkVoidFunction>(DestroyImage)},
+    {"vkDestroyImageView", reinterpret_cast<PFN_vkVoidFunction>(DestroyImageView)},
+    {"vkDestroyShaderModule", reinterpret_cast<PFN_vkVoidFunction>(DestroyShaderModule)},
+    {"vkDestroyPipeline", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipeline)},
+    {"vkDestroyPipelineLayout", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipelineLayout)},
+    {"vkDestroySampler", reinterpret_cast<PFN_vkVoidFunction>(DestroySampler)},
+    {"vkDestroyDescriptorSetLayout", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorSetLayout)},
+    {"vkDestroyDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorPool)},
+    {"vkDestroyFramebuffer", reinterpret_cast<PFN_vkVoidFunction>(DestroyFramebuffer)},
+    {"vkDestroyRenderPass", reinterpret_cast<PFN_vkVoidFunction>(DestroyRenderPass)},
+    {"vkCreateBuffer", reinterpret_cast<PFN_vkVoidFunction>(CreateBuffer)},
+    {"vkCreateBufferView", reinterpret_cast<PFN_vkVoidFunction>(CreateBufferView)},
+    {"vkCreateImage", reinterpret_cast<PFN_vkVoidFunction>(CreateImage)},
+    {"vkCreateImageView", reinterpret_cast<PFN_vkVoidFunction>(CreateImageView)},
+    {"vkCreateFence", reinterpret_cast<PFN_vkVoidFunction>(CreateFence)},
+    {"vkCreatePipelineCache", reinterpret_cast<PFN_vkVoidFunction>(CreatePipelineCache)},
+    {"vkDestroyPipelineCache", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipelineCache)},
+    {"vkGetPipelineCacheData", reinterpret_cast<PFN_vkVoidFunction>(GetPipelineCacheData)},
+    {"vkMergePipelineCaches", reinterpret_cast<PFN_vkVoidFunction>(MergePipelineCaches)},
+    {"vkCreateGraphicsPipelines", reinterpret_cast<PFN_vkVoidFunction>(CreateGraphicsPipelines)},
+    {"vkCreateComputePipelines", reinterpret_cast<PFN_vkVoidFunction>(CreateComputePipelines)},
+    {"vkCreateSampler", reinterpret_cast<PFN_vkVoidFunction>(CreateSampler)},
+    {"vkCreateDescriptorSetLayout", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorSetLayout)},
+    {"vkCreatePipelineLayout", reinterpret_cast<PFN_vkVoidFunction>(CreatePipelineLayout)},
+    {"vkCreateDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorPool)},
+    {"vkResetDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(ResetDescriptorPool)},
+    {"vkAllocateDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(AllocateDescriptorSets)},
+    {"vkFreeDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(FreeDescriptorSets)},
+    {"vkUpdateDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(UpdateDescriptorSets)},
+    {"vkCreateCommandPool", reinterpret_cast<PFN_vkVoidFunction>(CreateCommandPool)},
+    {"vkDestroyCommandPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyCommandPool)},
+    {"vkResetCommandPool", reinterpret_cast<PFN_vkVoidFunction>(ResetCommandPool)},
+    {"vkCreateQueryPool", reinterpret_cast<PFN_vkVoidFunction>(CreateQueryPool)},
+    {"vkAllocateCommandBuffers", reinterpret_cast<PFN_vkVoidFunction>(AllocateCommandBuffers)},
+    {"vkFreeCommandBuffers", reinterpret_cast<PFN_vkVoidFunction>(FreeCommandBuffers)},
+    {"vkBeginCommandBuffer", reinterpret_cast<PFN_vkVoidFunction>(BeginCommandBuffer)},
+    {"vkEndCommandBuffer", reinterpret_cast<PFN_vkVoidFunction>(EndCommandBuffer)},
+    {"vkResetCommandBuffer", reinterpret_cast<PFN_vkVoidFunction>(ResetCommandBuffer)},
+    {"vkCmdBindPipeline", reinterpret_cast<PFN_vkVoidFunction>(CmdBindPipeline)},
+    {"vkCmdSetViewport", reinterpret_cast<PFN_vkVoidFunction>(CmdSetViewport)},
+    {"vkCmdSetScissor", reinterpret_cast<PFN_vkVoidFunction>(CmdSetScissor)},
+    {"vkCmdSetLineWidth", reinterpret_cast<PFN_vkVoidFunction>(CmdSetLineWidth)},
+    {"vkCmdSetDepthBias", reinterpret_cast<PFN_vkVoidFunction>(CmdSetDepthBias)},
+    {"vkCmdSetBlendConstants", reinterpret_cast<PFN_vkVoidFunction>(CmdSetBlendConstants)},
+    {"vkCmdSetDepthBounds", reinterpret_cast<PFN_vkVoidFunction>(CmdSetDepthBounds)},
+    {"vkCmdSetStencilCompareMask", reinterpret_cast<PFN_vkVoidFunction>(CmdSetStencilCompareMask)},
+    {"vkCmdSetStencilWriteMask", reinterpret_cast<PFN_vkVoidFunction>(CmdSetStencilWriteMask)},
+    {"vkCmdSetStencilReference", reinterpret_cast<PFN_vkVoidFunction>(CmdSetStencilReference)},
+    {"vkCmdBindDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(CmdBindDescriptorSets)},
+    {"vkCmdBindVertexBuffers", reinterpret_cast<PFN_vkVoidFunction>(CmdBindVertexBuffers)},
+    {"vkCmdBindIndexBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdBindIndexBuffer)},
+    {"vkCmdDraw", reinterpret_cast<PFN_vkVoidFunction>(CmdDraw)},
+    {"vkCmdDrawIndexed", reinterpret_cast<PFN_vkVoidFunction>(CmdDrawIndexed)},
+    {"vkCmdDrawIndirect", reinterpret_cast<PFN_vkVoidFunction>(CmdDrawIndirect)},
+    {"vkCmdDrawIndexedIndirect", reinterpret_cast<PFN_vkVoidFunction>(CmdDrawIndexedIndirect)},
+    {"vkCmdDispatch", reinterpret_cast<PFN_vkVoidFunction>(CmdDispatch)},
+    {"vkCmdDispatchIndirect", reinterpret_cast<PFN_vkVoidFunction>(CmdDispatchIndirect)},
+    {"vkCmdCopyBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyBuffer)},
+    {"vkCmdCopyImage", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyImage)},
+    {"vkCmdBlitImage", reinterpret_cast<PFN_vkVoidFunction>(CmdBlitImage)},
+    {"vkCmdCopyBufferToImage", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyBufferToImage)},
+    {"vkCmdCopyImageToBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyImageToBuffer)},
+    {"vkCmdUpdateBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdUpdateBuffer)},
+    {"vkCmdFillBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdFillBuffer)},
+    {"vkCmdClearColorImage", reinterpret_cast<PFN_vkVoidFunction>(CmdClearColorImage)},
+    {"vkCmdClearDepthStencilImage", reinterpret_cast<PFN_vkVoidFunction>(CmdClearDepthStencilImage)},
+    {"vkCmdClearAttachments", reinterpret_cast<PFN_vkVoidFunction>(CmdClearAttachments)},
+    {"vkCmdResolveImage", reinterpret_cast<PFN_vkVoidFunction>(CmdResolveImage)},
+    {"vkCmdSetEvent", reinterpret_cast<PFN_vkVoidFunction>(CmdSetEvent)},
+    {"vkCmdResetEvent", reinterpret_cast<PFN_vkVoidFunction>(CmdResetEvent)},
+    {"vkCmdWaitEvents", reinterpret_cast<PFN_vkVoidFunction>(CmdWaitEvents)},
+    {"vkCmdPipelineBarrier", reinterpret_cast<PFN_vkVoidFunction>(CmdPipelineBarrier)},
+    {"vkCmdBeginQuery", reinterpret_cast<PFN_vkVoidFunction>(CmdBeginQuery)},
+    {"vkCmdEndQuery", reinterpret_cast<PFN_vkVoidFunction>(CmdEndQuery)},
+    {"vkCmdResetQueryPool", reinterpret_cast<PFN_vkVoidFunction>(CmdResetQueryPool)},
+    {"vkCmdCopyQueryPoolResults", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyQueryPoolResults)},
+    {"vkCmdPushConstants", reinterpret_cast<PFN_vkVoidFunction>(CmdPushConstants)},
+    {"vkCmdWriteTimestamp", reinterpret_cast<PFN_vkVoidFunction>(CmdWriteTimestamp)},
+    {"vkCreateFramebuffer", reinterpret_cast<PFN_vkVoidFunction>(CreateFramebuffer)},
+    {"vkCreateShaderModule", reinterpret_cast<PFN_vkVoidFunction>(CreateShaderModule)},
+    {"vkCreateRenderPass", reinterpret_cast<PFN_vkVoidFunction>(CreateRenderPass)},
+    {"vkCmdBeginRenderPass", reinterpret_cast<PFN_vkVoidFunction>(CmdBeginRenderPass)},
+    {"vkCmdNextSubpass", reinterpret_cast<PFN_vkVoidFunction>(CmdNextSubpass)},
+    {"vkCmdEndRenderPass", reinterpret_cast<PFN_vkVoidFunction>(CmdEndRenderPass)},
+    {"vkCmdExecuteCommands", reinterpret_cast<PFN_vkVoidFunction>(CmdExecuteCommands)},
+    {"vkSetEvent", reinterpret_cast<PFN_vkVoidFunction>(SetEvent)},
+    {"vkMapMemory", reinterpret_cast<PFN_vkVoidFunction>(MapMemory)},
+    {"vkUnmapMemory", reinterpret_cast<PFN_vkVoidFunction>(UnmapMemory)},
+    {"vkFlushMappedMemoryRanges", reinterpret_cast<PFN_vkVoidFunction>(FlushMappedMemoryRanges)},
+    {"vkInvalidateMappedMemoryRanges", reinterpret_cast<PFN_vkVoidFunction>(InvalidateMappedMemoryRanges)},
+    {"vkAllocateMemory", reinterpret_cast<PFN_vkVoidFunction>(AllocateMemory)},
+    {"vkFreeMemory", reinterpret_cast<PFN_vkVoidFunction>(FreeMemory)},
+    {"vkBindBufferMemory", reinterpret_cast<PFN_vkVoidFunction>(BindBufferMemory)},
+    {"vkGetBufferMemoryRequirements", reinterpret_cast<PFN_vkVoidFunction>(GetBufferMemoryRequirements)},
+    {"vkGetImageMemoryRequirements", reinterpret_cast<PFN_vkVoidFunction>(GetImageMemoryRequirements)},
+    {"vkGetQueryPoolResults", reinterpret_cast<PFN_vkVoidFunction>(GetQueryPoolResults)},
+    {"vkBindImageMemory", reinterpret_cast<PFN_vkVoidFunction>(BindImageMemory)},
+    {"vkQueueBindSparse", reinterpret_cast<PFN_vkVoidFunction>(QueueBindSparse)},
+    {"vkCreateSemaphore", reinterpret_cast<PFN_vkVoidFunction>(CreateSemaphore)},
+    {"vkCreateEvent", reinterpret_cast<PFN_vkVoidFunction>(CreateEvent)},
+};
 
 static PFN_vkVoidFunction
 intercept_core_device_command(const char *name) {
-    static const struct {
-        const char *name;
-        PFN_vkVoidFunction proc;
-    } core_device_commands[] = {
-        {"vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr)},
-        {"vkQueueSubmit", reinterpret_cast<PFN_vkVoidFunction>(QueueSubmit)},
-        {"vkWaitForFences", reinterpret_cast<PFN_vkVoidFunction>(WaitForFences)},
-        {"vkGetFenceStatus", reinterpret_cast<PFN_vkVoidFunction>(GetFenceStatus)},
-        {"vkQueueWaitIdle", reinterpret_cast<PFN_vkVoidFunction>(QueueWaitIdle)},
-        {"vkDeviceWaitIdle", reinterpret_cast<PFN_vkVoidFunction>(DeviceWaitIdle)},
-        {"vkGetDeviceQueue", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceQueue)},
-        {"vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance)},
-        {"vkDestroyDevice", reinterpret_cast<PFN_vkVoidFunction>(DestroyDevice)},
-        {"vkDestroyFence", reinterpret_cast<PFN_vkVoidFunction>(DestroyFence)},
-        {"vkResetFences", reinterpret_cast<PFN_vkVoidFunction>(ResetFences)},
-        {"vkDestroySemaphore", reinterpret_cast<PFN_vkVoidFunction>(DestroySemaphore)},
-        {"vkDestroyEvent", reinterpret_cast<PFN_vkVoidFunction>(DestroyEvent)},
-        {"vkDestroyQueryPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyQueryPool)},
-        {"vkDestroyBuffer", reinterpret_cast<PFN_vkVoidFunction>(DestroyBuffer)},
-        {"vkDestroyBufferView", reinterpret_cast<PFN_vkVoidFunction>(DestroyBufferView)},
-        {"vkDestroyImage", reinterpret_cast<PFN_vkVoidFunction>(DestroyImage)},
-        {"vkDestroyImageView", reinterpret_cast<PFN_vkVoidFunction>(DestroyImageView)},
-        {"vkDestroyShaderModule", reinterpret_cast<PFN_vkVoidFunction>(DestroyShaderModule)},
-        {"vkDestroyPipeline", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipeline)},
-        {"vkDestroyPipelineLayout", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipelineLayout)},
-        {"vkDestroySampler", reinterpret_cast<PFN_vkVoidFunction>(DestroySampler)},
-        {"vkDestroyDescriptorSetLayout", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorSetLayout)},
-        {"vkDestroyDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorPool)},
-        {"vkDestroyFramebuffer", reinterpret_cast<PFN_vkVoidFunction>(DestroyFramebuffer)},
-        {"vkDestroyRenderPass", reinterpret_cast<PFN_vkVoidFunction>(DestroyRenderPass)},
-        {"vkCreateBuffer", reinterpret_cast<PFN_vkVoidFunction>(CreateBuffer)},
-        {"vkCreateBufferView", reinterpret_cast<PFN_vkVoidFunction>(CreateBufferView)},
-        {"vkCreateImage", reinterpret_cast<PFN_vkVoidFunction>(CreateImage)},
-        {"vkCreateImageView", reinterpret_cast<PFN_vkVoidFunction>(CreateImageView)},
-        {"vkCreateFence", reinterpret_cast<PFN_vkVoidFunction>(CreateFence)},
-        {"vkCreatePipelineCache", reinterpret_cast<PFN_vkVoidFunction>(CreatePipelineCache)},
-        {"vkDestroyPipelineCache", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipelineCache)},
-        {"vkGetPipelineCacheData", reinterpret_cast<PFN_vkVoidFunction>(GetPipelineCacheData)},
-        {"vkMergePipelineCaches", reinterpret_cast<PFN_vkVoidFunction>(MergePipelineCaches)},
-        {"vkCreateGraphicsPipelines", reinterpret_cast<PFN_vkVoidFunction>(CreateGraphicsPipelines)},
-        {"vkCreateComputePipelines", reinterpret_cast<PFN_vkVoidFunction>(CreateComputePipelines)},
-        {"vkCreateSampler", reinterpret_cast<PFN_vkVoidFunction>(CreateSampler)},
-        {"vkCreateDescriptorSetLayout", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorSetLayout)},
-        {"vkCreatePipelineLayout", reinterpret_cast<PFN_vkVoidFunction>(CreatePipelineLayout)},
-        {"vkCreateDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorPool)},
-        {"vkResetDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(ResetDescriptorPool)},
-        {"vkAllocateDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(AllocateDescriptorSets)},
-        {"vkFreeDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(FreeDescriptorSets)},
-        {"vkUpdateDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(UpdateDescriptorSets)},
-        {"vkCreateCommandPool", reinterpret_cast<PFN_vkVoidFunction>(CreateCommandPool)},
-        {"vkDestroyCommandPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyCommandPool)},
-        {"vkResetCommandPool", reinterpret_cast<PFN_vkVoidFunction>(ResetCommandPool)},
-        {"vkCreateQueryPool", reinterpret_cast<PFN_vkVoidFunction>(CreateQueryPool)},
-        {"vkAllocateCommandBuffers", reinterpret_cast<PFN_vkVoidFunction>(AllocateCommandBuffers)},
-        {"vkFreeCommandBuffers", reinterpret_cast<PFN_vkVoidFunction>(FreeCommandBuffers)},
-        {"vkBeginCommandBuffer", reinterpret_cast<PFN_vkVoidFunction>(BeginCommandBuffer)},
-        {"vkEndCommandBuffer", reinterpret_cast<PFN_vkVoidFunction>(EndCommandBuffer)},
-        {"vkResetCommandBuffer", reinterpret_cast<PFN_vkVoidFunction>(ResetCommandBuffer)},
-        {"vkCmdBindPipeline", reinterpret_cast<PFN_vkVoidFunction>(CmdBindPipeline)},
-        {"vkCmdSetViewport", reinterpret_cast<PFN_vkVoidFunction>(CmdSetViewport)},
-        {"vkCmdSetScissor", reinterpret_cast<PFN_vkVoidFunction>(CmdSetScissor)},
-        {"vkCmdSetLineWidth", reinterpret_cast<PFN_vkVoidFunction>(CmdSetLineWidth)},
-        {"vkCmdSetDepthBias", reinterpret_cast<PFN_vkVoidFunction>(CmdSetDepthBias)},
-        {"vkCmdSetBlendConstants", reinterpret_cast<PFN_vkVoidFunction>(CmdSetBlendConstants)},
-        {"vkCmdSetDepthBounds", reinterpret_cast<PFN_vkVoidFunction>(CmdSetDepthBounds)},
-        {"vkCmdSetStencilCompareMask", reinterpret_cast<PFN_vkVoidFunction>(CmdSetStencilCompareMask)},
-        {"vkCmdSetStencilWriteMask", reinterpret_cast<PFN_vkVoidFunction>(CmdSetStencilWriteMask)},
-        {"vkCmdSetStencilReference", reinterpret_cast<PFN_vkVoidFunction>(CmdSetStencilReference)},
-        {"vkCmdBindDescriptorSets", reinterpret_cast<PFN_vkVoidFunction>(CmdBindDescriptorSets)},
-        {"vkCmdBindVertexBuffers", reinterpret_cast<PFN_vkVoidFunction>(CmdBindVertexBuffers)},
-        {"vkCmdBindIndexBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdBindIndexBuffer)},
-        {"vkCmdDraw", reinterpret_cast<PFN_vkVoidFunction>(CmdDraw)},
-        {"vkCmdDrawIndexed", reinterpret_cast<PFN_vkVoidFunction>(CmdDrawIndexed)},
-        {"vkCmdDrawIndirect", reinterpret_cast<PFN_vkVoidFunction>(CmdDrawIndirect)},
-        {"vkCmdDrawIndexedIndirect", reinterpret_cast<PFN_vkVoidFunction>(CmdDrawIndexedIndirect)},
-        {"vkCmdDispatch", reinterpret_cast<PFN_vkVoidFunction>(CmdDispatch)},
-        {"vkCmdDispatchIndirect", reinterpret_cast<PFN_vkVoidFunction>(CmdDispatchIndirect)},
-        {"vkCmdCopyBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyBuffer)},
-        {"vkCmdCopyImage", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyImage)},
-        {"vkCmdBlitImage", reinterpret_cast<PFN_vkVoidFunction>(CmdBlitImage)},
-        {"vkCmdCopyBufferToImage", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyBufferToImage)},
-        {"vkCmdCopyImageToBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyImageToBuffer)},
-        {"vkCmdUpdateBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdUpdateBuffer)},
-        {"vkCmdFillBuffer", reinterpret_cast<PFN_vkVoidFunction>(CmdFillBuffer)},
-        {"vkCmdClearColorImage", reinterpret_cast<PFN_vkVoidFunction>(CmdClearColorImage)},
-        {"vkCmdClearDepthStencilImage", reinterpret_cast<PFN_vkVoidFunction>(CmdClearDepthStencilImage)},
-        {"vkCmdClearAttachments", reinterpret_cast<PFN_vkVoidFunction>(CmdClearAttachments)},
-        {"vkCmdResolveImage", reinterpret_cast<PFN_vkVoidFunction>(CmdResolveImage)},
-        {"vkCmdSetEvent", reinterpret_cast<PFN_vkVoidFunction>(CmdSetEvent)},
-        {"vkCmdResetEvent", reinterpret_cast<PFN_vkVoidFunction>(CmdResetEvent)},
-        {"vkCmdWaitEvents", reinterpret_cast<PFN_vkVoidFunction>(CmdWaitEvents)},
-        {"vkCmdPipelineBarrier", reinterpret_cast<PFN_vkVoidFunction>(CmdPipelineBarrier)},
-        {"vkCmdBeginQuery", reinterpret_cast<PFN_vkVoidFunction>(CmdBeginQuery)},
-        {"vkCmdEndQuery", reinterpret_cast<PFN_vkVoidFunction>(CmdEndQuery)},
-        {"vkCmdResetQueryPool", reinterpret_cast<PFN_vkVoidFunction>(CmdResetQueryPool)},
-        {"vkCmdCopyQueryPoolResults", reinterpret_cast<PFN_vkVoidFunction>(CmdCopyQueryPoolResults)},
-        {"vkCmdPushConstants", reinterpret_cast<PFN_vkVoidFunction>(CmdPushConstants)},
-        {"vkCmdWriteTimestamp", reinterpret_cast<PFN_vkVoidFunction>(CmdWriteTimestamp)},
-        {"vkCreateFramebuffer", reinterpret_cast<PFN_vkVoidFunction>(CreateFramebuffer)},
-        {"vkCreateShaderModule", reinterpret_cast<PFN_vkVoidFunction>(CreateShaderModule)},
-        {"vkCreateRenderPass", reinterpret_cast<PFN_vkVoidFunction>(CreateRenderPass)},
-        {"vkCmdBeginRenderPass", reinterpret_cast<PFN_vkVoidFunction>(CmdBeginRenderPass)},
-        {"vkCmdNextSubpass", reinterpret_cast<PFN_vkVoidFunction>(CmdNextSubpass)},
-        {"vkCmdEndRenderPass", reinterpret_cast<PFN_vkVoidFunction>(CmdEndRenderPass)},
-        {"vkCmdExecuteCommands", reinterpret_cast<PFN_vkVoidFunction>(CmdExecuteCommands)},
-        {"vkSetEvent", reinterpret_cast<PFN_vkVoidFunction>(SetEvent)},
-        {"vkMapMemory", reinterpret_cast<PFN_vkVoidFunction>(MapMemory)},
-        {"vkUnmapMemory", reinterpret_cast<PFN_vkVoidFunction>(UnmapMemory)},
-        {"vkFlushMappedMemoryRanges", reinterpret_cast<PFN_vkVoidFunction>(FlushMappedMemoryRanges)},
-        {"vkInvalidateMappedMemoryRanges", reinterpret_cast<PFN_vkVoidFunction>(InvalidateMappedMemoryRanges)},
-        {"vkAllocateMemory", reinterpret_cast<PFN_vkVoidFunction>(AllocateMemory)},
-        {"vkFreeMemory", reinterpret_cast<PFN_vkVoidFunction>(FreeMemory)},
-        {"vkBindBufferMemory", reinterpret_cast<PFN_vkVoidFunction>(BindBufferMemory)},
-        {"vkGetBufferMemoryRequirements", reinterpret_cast<PFN_vkVoidFunction>(GetBufferMemoryRequirements)},
-        {"vkGetImageMemoryRequirements", reinterpret_cast<PFN_vkVoidFunction>(GetImageMemoryRequirements)},
-        {"vkGetQueryPoolResults", reinterpret_cast<PFN_vkVoidFunction>(GetQueryPoolResults)},
-        {"vkBindImageMemory", reinterpret_cast<PFN_vkVoidFunction>(BindImageMemory)},
-        {"vkQueueBindSparse", reinterpret_cast<PFN_vkVoidFunction>(QueueBindSparse)},
-        {"vkCreateSemaphore", reinterpret_cast<PFN_vkVoidFunction>(CreateSemaphore)},
-        {"vkCreateEvent", reinterpret_cast<PFN_vkVoidFunction>(CreateEvent)},
-    };
-
-    for (size_t i = 0; i < ARRAY_SIZE(core_device_commands); i++) {
-        if (!strcmp(core_device_commands[i].name, name))
-            return core_device_commands[i].proc;
-    }
-
-    return nullptr;
+    return core_device_commands.find(name);
 }
 
+static const layer_proc_table khr_swapchain_commands = {
+    { "vkCreateSwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSwapchainKHR) },
+    { "vkDestroySwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroySwapchainKHR) },
+    { "vkGetSwapchainImagesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetSwapchainImagesKHR) },
+    { "vkAcquireNextImageKHR", reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR) },
+    { "vkQueuePresentKHR", reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR) },
+};
+
 static PFN_vkVoidFunction
 intercept_khr_swapchain_command(const char *name, VkDevice dev) {
-    static const struct {
-        const char *name;
-        PFN_vkVoidFunction proc;
-    } khr_swapchain_commands[] = {
-        { "vkCreateSwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSwapchainKHR) },
-        { "vkDestroySwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroySwapchainKHR) },
-        { "vkGetSwapchainImagesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetSwapchainImagesKHR) },
-        { "vkAcquireNextImageKHR", reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR) },
-        { "vkQueuePresentKHR", reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR) },
-    };
-
     if (dev) {
         layer_data *dev_data = get_my_data_ptr(get_dispatch_key(dev), layer_data_map);
         if (!dev_data->device_extensions.wsi_enabled)
             return nullptr;
     }
 
-    for (size_t i = 0; i < ARRAY_SIZE(khr_swapchain_commands); i++) {
-        if (!strcmp(khr_swapchain_commands[i].name, name))
-            return khr_swapchain_commands[i].proc;
-    }
-
-    return nullptr;
+    return khr_swapchain_commands.find(name);
 }
 
 } // namespace core_validation
@@ -120,11 +120,6 @@ struct GENERIC_HEADER {
     const void *pNext;
 };
 
-struct IMAGE_LAYOUT_NODE {
-    VkImageLayout layout;
-    VkFormat format;
-};
-
 class PIPELINE_NODE : public BASE_NODE {
   public:
     VkPipeline pipeline;
@@ -248,10 +243,8 @@ class QUERY_POOL_NODE : public BASE_NODE {
     VkQueryPoolCreateInfo createInfo;
 };
 
-class FRAMEBUFFER_NODE : BASE_NODE {
+class FRAMEBUFFER_NODE : public BASE_NODE {
   public:
-    using BASE_NODE::in_use;
-    using BASE_NODE::cb_bindings;
     VkFramebuffer framebuffer;
     safe_VkFramebufferCreateInfo createInfo;
     safe_VkRenderPassCreateInfo renderPassCreateInfo;
@@ -273,6 +266,8 @@ struct COMMAND_POOL_NODE {
     uint32_t queueFamilyIndex;
     // TODO: why is this std::list?
     std::list<VkCommandBuffer> commandBuffers; // container of cmd buffers allocated from this pool
+    // Backs the tracking containers of the cmd buffers above; must outlive them
+    layer_arena arena;
 };
 
 // Stuff from Device Limits Layer
@@ -44,8 +44,14 @@
 #define NOEXCEPT
 #endif
 
+#include "vk_layer_arena.h"
+#include "vk_layer_guarded_mapping.h"
+#include "vk_layer_interval_tree.h"
+#include "vk_layer_range_map.h"
 #include "vulkan/vulkan.h"
+#include <algorithm>
 #include <atomic>
+#include <mutex>
 #include <string.h>
 #include <unordered_set>
 #include <unordered_map>
@@ -60,15 +66,35 @@ class DescriptorSet;
 
 struct GLOBAL_CB_NODE;
 
+// Hashed containers for per-command buffer state. These are emptied on every reset and
+//  refilled on every recording, so their nodes come from the owning command pool's arena
+template <typename T> using cb_unordered_set = std::unordered_set<T, std::hash<T>, std::equal_to<T>, arena_allocator<T>>;
+template <typename K, typename V>
+using cb_unordered_map = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, arena_allocator<std::pair<const K, V>>>;
+// Containers for descriptor set state, which all goes when its descriptor pool is reset, so their storage comes from the
+//  pool's monotonic arena (unless the pool allows sets to be freed individually)
+template <typename T> using pool_vector = std::vector<T, arena_allocator<T, monotonic_arena>>;
+template <typename T>
+using pool_unordered_set = std::unordered_set<T, std::hash<T>, std::equal_to<T>, arena_allocator<T, monotonic_arena>>;
+
+// Process-wide count of changes to objects that command buffers bind: every creation, update or
+//  destruction that could invalidate a command buffer moves it on. BASE_NODE::generation values are
+//  drawn from it, so they are never reused, even by an object that gets a recycled handle.
+inline std::atomic<uint64_t> &objectGenerationCounter() {
+    static std::atomic<uint64_t> counter(0);
+    return counter;
+}
+inline uint64_t newObjectGeneration() { return ++objectGenerationCounter(); }
+
 class BASE_NODE {
   public:
+    BASE_NODE() : generation(newObjectGeneration()) {}
     // Track when object is being used by an in-flight command buffer
     std::atomic_int in_use;
-    // Track command buffers that this object is bound to
-    //  binding initialized when cmd referencing object is bound to command buffer
-    //  binding removed when command buffer is reset or destroyed
-    // When an object is destroyed, any bound cbs are set to INVALID
-    std::unordered_set<GLOBAL_CB_NODE *> cb_bindings;
+    // Command buffers record the generation of each object they bind. Destroying the object, or
+    //  changing it in a way that invalidates bound command buffers (e.g. updating a descriptor set),
+    //  moves it on, and the command buffer finds the mismatch when it is next submitted.
+    uint64_t generation;
 };
 
 // Generic wrapper for vulkan objects
@@ -91,12 +117,19 @@ struct DESCRIPTOR_POOL_NODE {
     uint32_t availableSets; // Available descriptor sets in this pool
 
     VkDescriptorPoolCreateInfo createInfo;
-    std::unordered_set<cvdescriptorset::DescriptorSet *> sets; // Collection of all sets in this pool
+    // Storage for this pool's sets, released all at once when the pool is reset. Null if sets can be freed individually,
+    //  as an arena never reuses memory before a reset, so those pools' sets come from the heap.
+    std::unique_ptr<monotonic_arena> setArena;
+    pool_unordered_set<cvdescriptorset::DescriptorSet *> sets; // Collection of all sets in this pool
     std::vector<uint32_t> maxDescriptorTypeCount;              // Max # of descriptors of each type in this pool
     std::vector<uint32_t> availableDescriptorTypeCount;        // Available # of descriptors of each type in this pool
 
-    DESCRIPTOR_POOL_NODE(const VkDescriptorPool pool, const VkDescriptorPoolCreateInfo *pCreateInfo)
+    // arena_size is the initial size of setArena, if the pool has one
+    DESCRIPTOR_POOL_NODE(const VkDescriptorPool pool, const VkDescriptorPoolCreateInfo *pCreateInfo, size_t arena_size)
         : pool(pool), maxSets(pCreateInfo->maxSets), availableSets(pCreateInfo->maxSets), createInfo(*pCreateInfo),
+          setArena((pCreateInfo->flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT) ? nullptr
+                                                                                              : new monotonic_arena(arena_size)),
+          sets(arena_allocator<cvdescriptorset::DescriptorSet *, monotonic_arena>(setArena.get())),
           maxDescriptorTypeCount(VK_DESCRIPTOR_TYPE_RANGE_SIZE, 0), availableDescriptorTypeCount(VK_DESCRIPTOR_TYPE_RANGE_SIZE, 0) {
         if (createInfo.poolSizeCount) { // Shadow type struct from ptr into local struct
             size_t poolSizeCountSize = createInfo.poolSizeCount * sizeof(VkDescriptorPoolSize);
@@ -206,11 +239,18 @@ struct DEVICE_MEM_INFO {
     VkMemoryAllocateInfo allocInfo;
     std::unordered_set<MT_OBJ_HANDLE_TYPE> objBindings;        // objects bound to this memory
     std::unordered_set<VkCommandBuffer> commandBufferBindings; // cmd buffers referencing this memory
-    std::vector<MEMORY_RANGE> bufferRanges;
-    std::vector<MEMORY_RANGE> imageRanges;
+    // Recording cmd buffers whose reference to this memory is not in commandBufferBindings yet (see unmergedMemObjs).
+    //  Recording threads add to it under unmergedLock; everything else touches it with global_lock held exclusively.
+    std::mutex unmergedLock;
+    std::unordered_set<GLOBAL_CB_NODE *> unmergedCommandBuffers;
+    // Bound ranges indexed by object handle, so aliasing checks don't scan every binding
+    interval_tree<MEMORY_RANGE> bufferRanges;
+    interval_tree<MEMORY_RANGE> imageRanges;
     VkImage image; // If memory is bound to image, this will have VkImage handle, else VK_NULL_HANDLE
     MemRange memRange;
     void *pData, *pDriverData;
+    // Guard-page shadow of a non-coherent mapping; used in place of pData when set
+    std::unique_ptr<guarded_mapping> shadow;
     DEVICE_MEM_INFO(void *disp_object, const VkDeviceMemory in_mem, const VkMemoryAllocateInfo *p_alloc_info)
         : object(disp_object), valid(false), stencil_valid(false), mem(in_mem), allocInfo(*p_alloc_info),
           image(VK_NULL_HANDLE), memRange{}, pData(0), pDriverData(0){};
@@ -251,6 +291,10 @@ class IMAGE_CMD_BUF_LAYOUT_NODE {
     VkImageLayout layout;
 };
 
+inline bool operator==(const IMAGE_CMD_BUF_LAYOUT_NODE &a, const IMAGE_CMD_BUF_LAYOUT_NODE &b) {
+    return a.initialLayout == b.initialLayout && a.layout == b.layout;
+}
+
 struct MT_PASS_ATTACHMENT_INFO {
     uint32_t attachment;
     VkAttachmentLoadOp load_op;
@@ -406,34 +450,140 @@ template <> struct hash<QueryObject> {
 }
 struct DRAW_DATA { std::vector<VkBuffer> buffers; };
 
-struct ImageSubresourcePair {
-    VkImage image;
-    bool hasSubresource;
-    VkImageSubresource subresource;
+// Work a command buffer defers to submit time. Each record is an op tag plus the handles it
+// operates on, so recording a command only appends to a vector that keeps its capacity across
+// resets, and submit runs every record of a command buffer in one pass through a switch.
+enum CB_DEFERRED_OP {
+    CB_DEFERRED_VALIDATE_MEMORY,    // memory: report a read of memory that holds no valid data
+    CB_DEFERRED_SET_MEMORY_VALID,   // memory: memory is written by the command buffer
+    CB_DEFERRED_SET_MEMORY_INVALID, // memory: memory contents are undefined after the command buffer
+    CB_DEFERRED_SET_EVENT,          // event: vkCmdSetEvent / vkCmdResetEvent
+    CB_DEFERRED_WAIT_EVENTS,        // wait_events: vkCmdWaitEvents stage mask check
+    CB_DEFERRED_SET_QUERY,          // query: query becomes available / unavailable
+    CB_DEFERRED_VALIDATE_QUERY,     // query_range: vkCmdCopyQueryPoolResults reads valid queries
 };
 
-inline bool operator==(const ImageSubresourcePair &img1, const ImageSubresourcePair &img2) {
-    if (img1.image != img2.image || img1.hasSubresource != img2.hasSubresource)
-        return false;
-    return !img1.hasSubresource ||
-           (img1.subresource.aspectMask == img2.subresource.aspectMask && img1.subresource.mipLevel == img2.subresource.mipLevel &&
-            img1.subresource.arrayLayer == img2.subresource.arrayLayer);
-}
+struct CB_DEFERRED_CHECK {
+    CB_DEFERRED_OP op;
+    union {
+        struct {
+            VkDeviceMemory mem;
+            VkImage image; // swapchain images have no memory object; their validity is tracked per image
+            const char *func_name;
+        } memory;
+        struct {
+            VkCommandBuffer commandBuffer;
+            VkEvent event;
+            VkPipelineStageFlags stageMask;
+        } event;
+        struct {
+            size_t firstEventIndex; // into GLOBAL_CB_NODE::events
+            uint32_t eventCount;
+            VkPipelineStageFlags sourceStageMask;
+        } wait_events;
+        struct {
+            VkCommandBuffer commandBuffer;
+            QueryObject object;
+            bool available;
+        } query;
+        struct {
+            VkCommandBuffer commandBuffer;
+            VkQueryPool queryPool;
+            uint32_t firstQuery;
+            uint32_t queryCount;
+        } query_range;
+    };
+};
 
-namespace std {
-template <> struct hash<ImageSubresourcePair> {
-    size_t operator()(ImageSubresourcePair img) const throw() {
-        size_t hashVal = hash<uint64_t>()(reinterpret_cast<uint64_t &>(img.image));
-        hashVal ^= hash<bool>()(img.hasSubresource);
-        if (img.hasSubresource) {
-            hashVal ^= hash<uint32_t>()(reinterpret_cast<uint32_t &>(img.subresource.aspectMask));
-            hashVal ^= hash<uint32_t>()(img.subresource.mipLevel);
-            hashVal ^= hash<uint32_t>()(img.subresource.arrayLayer);
+// Submit-time work that depends only on what a command buffer recorded, derived the first time it
+// is submitted and reused by every re-submit until it is reset or re-recorded.
+struct CB_SUBMIT_CACHE {
+    // Distinct buffers used by the first drawDataCount entries of drawData
+    size_t drawDataCount;
+    std::vector<VkBuffer> drawBuffers;
+    // The first memoryCheckCount entries of memoryChecks reduced to one check per memory object read
+    // before the command buffer writes it, then the validity it leaves each written object in. Not
+    // reducible if the command buffer reads memory it has itself made undefined.
+    size_t memoryCheckCount;
+    bool memoryChecksReducible;
+    std::vector<CB_DEFERRED_CHECK> memoryChecks;
+    // Global layout version of each image in imageLayoutMap when the last submit found no layout
+    // mismatch and left the global layouts unchanged. Empty if there was no such submit.
+    std::vector<std::pair<VkImage, uint64_t>> imageLayoutVersions;
+
+    CB_SUBMIT_CACHE() : drawDataCount(0), memoryCheckCount(0), memoryChecksReducible(true) {}
+
+    void reset() {
+        drawDataCount = 0;
+        drawBuffers.clear();
+        memoryCheckCount = 0;
+        memoryChecksReducible = true;
+        memoryChecks.clear();
+        imageLayoutVersions.clear();
+    }
+};
+
+// Layout state of every subresource of one image, run-length encoded over a linear subresource
+// index: aspect-major (color, depth, stencil, metadata), then mip level, then array layer. A
+// barrier or attachment covering every layer of a mip range is a single run per aspect, however
+// many layers the image has, and an image whose subresources all share a layout is one run.
+template <typename LAYOUT_T> class IMAGE_LAYOUT_MAP {
+  public:
+    IMAGE_LAYOUT_MAP() : mipLevels(1), arrayLayers(1), version(0) {}
+    IMAGE_LAYOUT_MAP(uint32_t mip_levels, uint32_t array_layers)
+        : mipLevels(mip_levels ? mip_levels : 1), arrayLayers(array_layers ? array_layers : 1), version(0) {}
+
+    // Calls func(begin, end) for each contiguous index range covered by range, clipped to the image
+    template <typename FUNC_T> void forEachIndexRange(const VkImageSubresourceRange &range, FUNC_T func) const {
+        uint64_t mip_end = std::min<uint64_t>(uint64_t(range.baseMipLevel) + range.levelCount, mipLevels);
+        uint64_t layer_end = std::min<uint64_t>(uint64_t(range.baseArrayLayer) + range.layerCount, arrayLayers);
+        if (range.baseMipLevel >= mip_end || range.baseArrayLayer >= layer_end)
+            return;
+        const bool all_layers = (range.baseArrayLayer == 0 && layer_end == arrayLayers);
+        for (uint32_t aspect = 0; aspect < aspectCount; aspect++) {
+            if (!(range.aspectMask & (1 << aspect)))
+                continue;
+            if (all_layers) {
+                func(index(aspect, range.baseMipLevel, 0), index(aspect, uint32_t(mip_end - 1), 0) + arrayLayers);
+            } else {
+                for (uint32_t mip = range.baseMipLevel; mip < mip_end; mip++) {
+                    func(index(aspect, mip, range.baseArrayLayer), index(aspect, mip, 0) + layer_end);
+                }
+            }
         }
-        return hashVal;
+    }
+
+    void set(const VkImageSubresourceRange &range, const LAYOUT_T &layout) {
+        forEachIndexRange(range, [&](uint64_t begin, uint64_t end) { runs.set(begin, end, layout); });
+    }
+
+    // Replaces the layout of each run within range by func(layout), where layout is nullptr for
+    // subresources that have no layout yet
+    template <typename FUNC_T> void update(const VkImageSubresourceRange &range, FUNC_T func) {
+        forEachIndexRange(range, [&](uint64_t begin, uint64_t end) { runs.update(begin, end, func); });
+    }
+
+    VkImageSubresource subresource(uint64_t index) const {
+        const uint64_t aspect_size = uint64_t(mipLevels) * arrayLayers;
+        VkImageSubresource sub;
+        sub.aspectMask = VkImageAspectFlags(1) << (index / aspect_size);
+        sub.mipLevel = uint32_t((index % aspect_size) / arrayLayers);
+        sub.arrayLayer = uint32_t(index % arrayLayers);
+        return sub;
+    }
+
+    static const uint32_t aspectCount = 4;
+    range_map<LAYOUT_T> runs;
+    uint32_t mipLevels;
+    uint32_t arrayLayers;
+    // Changed by the owner of the map whenever runs changes, so others can tell it has not
+    uint64_t version;
+
+  private:
+    uint64_t index(uint32_t aspect, uint32_t mip, uint32_t layer) const {
+        return (uint64_t(aspect) * mipLevels + mip) * arrayLayers + layer;
     }
 };
-}
 
 // Store layouts and pushconstants for PipelineLayout
 struct PIPELINE_LAYOUT_NODE {
@@ -454,20 +604,33 @@ struct PIPELINE_LAYOUT_NODE {
 struct LAST_BOUND_STATE {
     VkPipeline pipeline;
     PIPELINE_LAYOUT_NODE pipeline_layout;
-    // Track each set that has been bound
-    // TODO : can unique be global per CB? (do we care about Gfx vs. Compute?)
-    std::unordered_set<cvdescriptorset::DescriptorSet *> uniqueBoundSets;
     // Ordered bound set tracking where index is set# that given set is bound to
     std::vector<cvdescriptorset::DescriptorSet *> boundDescriptorSets;
+    // Handle and allocation id of each set in boundDescriptorSets, to find sets freed since they were bound without
+    //  touching them, and the device's descriptorResourceEpoch when that was last done (see dropFreedBoundDescriptorSets)
+    std::vector<VkDescriptorSet> boundDescriptorSetHandles;
+    std::vector<uint64_t> boundDescriptorSetIds;
+    uint64_t boundSetsCheckedEpoch;
     // one dynamic offset per dynamic descriptor bound to this CB
     std::vector<std::vector<uint32_t>> dynamicOffsets;
+    // Memo of the last draw whose descriptor checks were all clean. descriptorsDirty is set whenever the pipeline, the
+    //  bound sets or their dynamic offsets change. validatedSetGenerations holds the generation of each bound set, and
+    //  validatedResourceEpoch the device's descriptorResourceEpoch, as of that draw.
+    bool descriptorsDirty;
+    std::vector<uint64_t> validatedSetGenerations;
+    uint64_t validatedResourceEpoch;
 
     void reset() {
         pipeline = VK_NULL_HANDLE;
         pipeline_layout.reset();
-        uniqueBoundSets.clear();
         boundDescriptorSets.clear();
+        boundDescriptorSetHandles.clear();
+        boundDescriptorSetIds.clear();
+        boundSetsCheckedEpoch = 0;
         dynamicOffsets.clear();
+        descriptorsDirty = true;
+        validatedSetGenerations.clear();
+        validatedResourceEpoch = 0;
     }
 };
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
@@ -496,38 +659,45 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     VkSubpassContents activeSubpassContents;
     uint32_t activeSubpass;
     VkFramebuffer activeFramebuffer;
-    std::unordered_set<VkFramebuffer> framebuffers;
-    // Unified data structs to track objects bound to this command buffer as well as object
-    //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    std::unordered_set<VK_OBJECT> object_bindings;
+    cb_unordered_set<VkFramebuffer> framebuffers;
+    // Unified data structs to track objects bound to this command buffer, with each object's generation
+    //  when first bound, as well as object dependencies that have been broken : either destroyed
+    //  objects, or updated descriptor sets
+    cb_unordered_map<VK_OBJECT, uint64_t> object_bindings;
     std::vector<VK_OBJECT> broken_bindings;
+    // objectGenerationCounter() when object_bindings were last compared against the bound objects
+    uint64_t bindingsCheckedGeneration;
 
-    std::unordered_set<VkEvent> waitedEvents;
+    cb_unordered_set<VkEvent> waitedEvents;
     std::vector<VkEvent> writeEventsBeforeWait;
     std::vector<VkEvent> events;
-    std::unordered_map<QueryObject, std::unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
-    std::unordered_map<QueryObject, bool> queryToStateMap; // 0 is unavailable, 1 is available
-    std::unordered_set<QueryObject> activeQueries;
-    std::unordered_set<QueryObject> startedQueries;
-    std::unordered_map<ImageSubresourcePair, IMAGE_CMD_BUF_LAYOUT_NODE> imageLayoutMap;
-    std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> imageSubresourceMap;
-    std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
+    cb_unordered_map<QueryObject, cb_unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
+    cb_unordered_map<QueryObject, bool> queryToStateMap; // 0 is unavailable, 1 is available
+    cb_unordered_set<QueryObject> activeQueries;
+    cb_unordered_set<QueryObject> startedQueries;
+    cb_unordered_map<VkImage, IMAGE_LAYOUT_MAP<IMAGE_CMD_BUF_LAYOUT_NODE>> imageLayoutMap;
+    cb_unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
     std::vector<DRAW_DATA> drawData;
     DRAW_DATA currentDrawData;
     VkCommandBuffer primaryCommandBuffer;
     // Track images and buffers that are updated by this CB at the point of a draw
-    std::unordered_set<VkImageView> updateImages;
-    std::unordered_set<VkBuffer> updateBuffers;
+    cb_unordered_set<VkImageView> updateImages;
+    cb_unordered_set<VkBuffer> updateBuffers;
     // If cmd buffer is primary, track secondary command buffers pending
     // execution
-    std::unordered_set<VkCommandBuffer> secondaryCommandBuffers;
+    cb_unordered_set<VkCommandBuffer> secondaryCommandBuffers;
     // MTMTODO : Scrub these data fields and merge active sets w/ lastBound as appropriate
-    std::vector<std::function<bool()>> validate_functions;
-    std::unordered_set<VkDeviceMemory> memObjs;
-    std::vector<std::function<bool(VkQueue)>> eventUpdates;
-    std::vector<std::function<bool(VkQueue)>> queryUpdates;
-
-    ~GLOBAL_CB_NODE();
+    std::vector<CB_DEFERRED_CHECK> memoryChecks;
+    cb_unordered_set<VkDeviceMemory> memObjs;
+    // memObjs entries whose DEVICE_MEM_INFO::commandBufferBindings do not list this CB yet (merged at vkEndCommandBuffer)
+    std::vector<VkDeviceMemory> unmergedMemObjs;
+    std::vector<CB_DEFERRED_CHECK> eventUpdates;
+    std::vector<CB_DEFERRED_CHECK> queryUpdates;
+    CB_SUBMIT_CACHE submitCache;
+    // Held (under a shared global_lock) while a vkCmd* call records into this CB
+    std::mutex recording_lock;
+
+    explicit GLOBAL_CB_NODE(layer_arena *arena);
 };
 
 struct CB_SUBMISSION {
@@ -552,7 +722,7 @@ SAMPLER_NODE *getSamplerNode(const layer_data *, VkSampler);
 VkImageViewCreateInfo *getImageViewData(const layer_data *, VkImageView);
 VkSwapchainKHR getSwapchainFromImage(const layer_data *, VkImage);
 SWAPCHAIN_NODE *getSwapchainNode(const layer_data *, VkSwapchainKHR);
-void invalidateCommandBuffers(std::unordered_set<GLOBAL_CB_NODE *>, VK_OBJECT);
+void invalidateCommandBuffers(BASE_NODE *);
 bool ValidateMemoryIsBoundToBuffer(const layer_data *, const BUFFER_NODE *, const char *);
 }
 
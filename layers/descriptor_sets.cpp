@@ -21,6 +21,7 @@
 #include "descriptor_sets.h"
 #include "vk_enum_string_helper.h"
 #include "vk_safe_struct.h"
+#include <algorithm>
 #include <sstream>
 
 // Construct DescriptorSetLayout instance from given create info
@@ -37,10 +38,13 @@ cvdescriptorset::DescriptorSetLayout::DescriptorSetLayout(debug_report_data *rep
                     "duplicated binding number in "
                     "VkDescriptorSetLayoutBinding");
         }
+        // An empty binding takes no global index: it starts where the next binding does, and its end index is its start
+        const uint32_t descriptor_count = p_create_info->pBindings[i].descriptorCount;
         binding_to_global_start_index_map_[p_create_info->pBindings[i].binding] = global_index;
-        global_index += p_create_info->pBindings[i].descriptorCount ? p_create_info->pBindings[i].descriptorCount - 1 : 0;
-        binding_to_global_end_index_map_[p_create_info->pBindings[i].binding] = global_index;
-        global_index++;
+        global_start_indices_.push_back(global_index);
+        binding_to_global_end_index_map_[p_create_info->pBindings[i].binding] =
+            descriptor_count ? global_index + descriptor_count - 1 : global_index;
+        global_index += descriptor_count;
         bindings_.push_back(safe_VkDescriptorSetLayoutBinding(&p_create_info->pBindings[i]));
         // In cases where we should ignore pImmutableSamplers make sure it's NULL
         if ((p_create_info->pBindings[i].pImmutableSamplers) &&
@@ -103,16 +107,30 @@ VkDescriptorType cvdescriptorset::DescriptorSetLayout::GetTypeFromIndex(const ui
     return bindings_[index].descriptorType;
 }
 // For the given global index, return descriptorType
-//  Currently just counting up through bindings_, may improve this in future
 VkDescriptorType cvdescriptorset::DescriptorSetLayout::GetTypeFromGlobalIndex(const uint32_t index) const {
-    uint32_t global_offset = 0;
-    for (auto binding : bindings_) {
-        global_offset += binding.descriptorCount;
-        if (index < global_offset)
-            return binding.descriptorType;
+    if (index >= descriptor_count_) {
+        assert(0); // requested global index is out of bounds
+        return VK_DESCRIPTOR_TYPE_MAX_ENUM;
     }
-    assert(0); // requested global index is out of bounds
-    return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    return bindings_[GetIndexFromGlobalIndex(index)].descriptorType;
+}
+// For the given binding, return index
+uint32_t cvdescriptorset::DescriptorSetLayout::GetIndexFromBinding(const uint32_t binding) const {
+    assert(binding_to_index_map_.count(binding));
+    const auto &bi_itr = binding_to_index_map_.find(binding);
+    if (bi_itr != binding_to_index_map_.end()) {
+        return bi_itr->second;
+    }
+    // In error case max uint32_t so index is out of bounds to break ASAP
+    return 0xFFFFFFFF;
+}
+// For the given global index, return the index of the binding holding it
+//  Global start indices ascend with index, so this is the last index starting at or before the global index.
+//  Any empty bindings sharing that start come before the binding that actually holds the descriptor.
+uint32_t cvdescriptorset::DescriptorSetLayout::GetIndexFromGlobalIndex(const uint32_t global_index) const {
+    assert(global_index < descriptor_count_);
+    auto next = std::upper_bound(global_start_indices_.begin(), global_start_indices_.end(), global_index);
+    return static_cast<uint32_t>(next - global_start_indices_.begin()) - 1;
 }
 // For the given binding, return stageFlags
 VkShaderStageFlags cvdescriptorset::DescriptorSetLayout::GetStageFlagsFromBinding(const uint32_t binding) const {
@@ -265,30 +283,68 @@ bool cvdescriptorset::DescriptorSetLayout::VerifyUpdateConsistency(uint32_t curr
 cvdescriptorset::AllocateDescriptorSetsData::AllocateDescriptorSetsData(uint32_t count)
     : required_descriptors_by_type{}, layout_nodes(count, nullptr) {}
 
+// Return the class of descriptor that stores descriptors of the given type
+static cvdescriptorset::DescriptorClass GetDescriptorClass(const VkDescriptorType type) {
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+        return cvdescriptorset::PlainSampler;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return cvdescriptorset::ImageSampler;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return cvdescriptorset::Image;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return cvdescriptorset::TexelBuffer;
+    default:
+        return cvdescriptorset::GeneralBuffer;
+    }
+}
+
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const DescriptorSetLayout *layout,
-                                              const core_validation::layer_data *dev_data)
-    : some_update_(false), set_(set), p_layout_(layout), device_data_(dev_data) {
+                                              const core_validation::layer_data *dev_data, monotonic_arena *arena)
+    : some_update_(false), set_(set), p_layout_(layout), samplers_(arena_allocator<char, monotonic_arena>(arena)),
+      image_samplers_(arena_allocator<char, monotonic_arena>(arena)), images_(arena_allocator<char, monotonic_arena>(arena)),
+      texel_buffers_(arena_allocator<char, monotonic_arena>(arena)), buffers_(arena_allocator<char, monotonic_arena>(arena)),
+      binding_offsets_(arena_allocator<char, monotonic_arena>(arena)),
+      updated_(layout->GetTotalDescriptorCount(), false, arena_allocator<char, monotonic_arena>(arena)), device_data_(dev_data),
+      allocation_id_(generation) {
+    // Size each class's array up front so that it is allocated once
+    uint32_t class_counts[GeneralBuffer + 1] = {};
+    for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
+        class_counts[GetDescriptorClass(p_layout_->GetTypeFromIndex(i))] += p_layout_->GetDescriptorCountFromIndex(i);
+    }
+    samplers_.reserve(class_counts[PlainSampler]);
+    image_samplers_.reserve(class_counts[ImageSampler]);
+    images_.reserve(class_counts[Image]);
+    texel_buffers_.reserve(class_counts[TexelBuffer]);
+    buffers_.reserve(class_counts[GeneralBuffer]);
+    binding_offsets_.reserve(p_layout_->GetBindingCount());
     // Foreach binding, create default descriptors of given type
     for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
         auto type = p_layout_->GetTypeFromIndex(i);
+        auto count = p_layout_->GetDescriptorCountFromIndex(i);
         switch (type) {
         case VK_DESCRIPTOR_TYPE_SAMPLER: {
+            binding_offsets_.push_back(static_cast<uint32_t>(samplers_.size()));
             auto immut_sampler = p_layout_->GetImmutableSamplerPtrFromIndex(i);
-            for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
+            for (uint32_t di = 0; di < count; ++di) {
                 if (immut_sampler)
-                    descriptors_.emplace_back(new SamplerDescriptor(immut_sampler + di));
+                    samplers_.emplace_back(immut_sampler + di);
                 else
-                    descriptors_.emplace_back(new SamplerDescriptor());
+                    samplers_.emplace_back();
             }
             break;
         }
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: {
+            binding_offsets_.push_back(static_cast<uint32_t>(image_samplers_.size()));
             auto immut = p_layout_->GetImmutableSamplerPtrFromIndex(i);
-            for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
+            for (uint32_t di = 0; di < count; ++di) {
                 if (immut)
-                    descriptors_.emplace_back(new ImageSamplerDescriptor(immut + di));
+                    image_samplers_.emplace_back(immut + di);
                 else
-                    descriptors_.emplace_back(new ImageSamplerDescriptor());
+                    image_samplers_.emplace_back();
             }
             break;
         }
@@ -296,37 +352,55 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const D
         case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-            for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                descriptors_.emplace_back(new ImageDescriptor(type));
+            binding_offsets_.push_back(static_cast<uint32_t>(images_.size()));
+            images_.resize(images_.size() + count, ImageDescriptor(type));
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-            for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                descriptors_.emplace_back(new TexelDescriptor(type));
+            binding_offsets_.push_back(static_cast<uint32_t>(texel_buffers_.size()));
+            texel_buffers_.resize(texel_buffers_.size() + count, TexelDescriptor(type));
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-            for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                descriptors_.emplace_back(new BufferDescriptor(type));
+            binding_offsets_.push_back(static_cast<uint32_t>(buffers_.size()));
+            buffers_.resize(buffers_.size() + count, BufferDescriptor(type));
             break;
         default:
             assert(0); // Bad descriptor type specified
+            binding_offsets_.push_back(0);
             break;
         }
+        // Immutable samplers are in place from the start so count them as updated
+        if (p_layout_->GetImmutableSamplerPtrFromIndex(i)) {
+            auto start_idx = p_layout_->GetGlobalStartIndexFromIndex(i);
+            std::fill(updated_.begin() + start_idx, updated_.begin() + start_idx + count, true);
+        }
     }
 }
-
-cvdescriptorset::DescriptorSet::~DescriptorSet() {
-    InvalidateBoundCmdBuffers();
-    // Remove link to any cmd buffers
-    for (auto cb : cb_bindings) {
-        for (uint32_t i=0; i<VK_PIPELINE_BIND_POINT_RANGE_SIZE; ++i) {
-            cb->lastBound[i].uniqueBoundSets.erase(this);
-        }
+// Descriptor at global index, found in the array for the class of the binding that holds it
+cvdescriptorset::Descriptor *cvdescriptorset::DescriptorSet::GetDescriptorFromGlobalIndex(const uint32_t global_index) {
+    auto index = p_layout_->GetIndexFromGlobalIndex(global_index);
+    auto offset = binding_offsets_[index] + global_index - p_layout_->GetGlobalStartIndexFromIndex(index);
+    switch (GetDescriptorClass(p_layout_->GetTypeFromIndex(index))) {
+    case PlainSampler:
+        return &samplers_[offset];
+    case ImageSampler:
+        return &image_samplers_[offset];
+    case Image:
+        return &images_[offset];
+    case TexelBuffer:
+        return &texel_buffers_[offset];
+    default:
+        return &buffers_[offset];
     }
 }
+const cvdescriptorset::Descriptor *cvdescriptorset::DescriptorSet::GetDescriptorFromGlobalIndex(const uint32_t global_index) const {
+    return const_cast<DescriptorSet *>(this)->GetDescriptorFromGlobalIndex(global_index);
+}
+
+cvdescriptorset::DescriptorSet::~DescriptorSet() { InvalidateBoundCmdBuffers(); }
 // Is this sets underlying layout compatible with passed in layout according to "Pipeline Layout Compatibility" in spec?
 bool cvdescriptorset::DescriptorSet::IsCompatible(const DescriptorSetLayout *layout, std::string *error) const {
     return layout->IsCompatible(p_layout_, error);
@@ -346,68 +420,70 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::unordered_set<
             *error = error_str.str();
             return false;
         }
-        auto start_idx = p_layout_->GetGlobalStartIndexFromBinding(binding);
-        if (descriptors_[start_idx]->IsImmutableSampler()) {
+        auto index = p_layout_->GetIndexFromBinding(binding);
+        if (p_layout_->GetImmutableSamplerPtrFromIndex(index)) {
             // Nothing to do for strictly immutable sampler
-        } else {
-            auto end_idx = p_layout_->GetGlobalEndIndexFromBinding(binding);
-            for (uint32_t i = start_idx; i <= end_idx; ++i) {
-                if (!descriptors_[i]->updated) {
+            continue;
+        }
+        auto start_idx = p_layout_->GetGlobalStartIndexFromIndex(index);
+        auto count = p_layout_->GetDescriptorCountFromIndex(index);
+        // Buffers are the only descriptors with state to check beyond being updated
+        const BufferDescriptor *buffer_descs = nullptr;
+        if (GeneralBuffer == GetDescriptorClass(p_layout_->GetTypeFromIndex(index)))
+            buffer_descs = buffers_.data() + binding_offsets_[index];
+        for (uint32_t di = 0; di < count; ++di) {
+            auto i = start_idx + di;
+            if (!updated_[i]) {
+                std::stringstream error_str;
+                error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
+                          << " is being used in draw but has not been updated.";
+                *error = error_str.str();
+                return false;
+            } else if (buffer_descs) {
+                // Verify that buffers are valid
+                auto buffer = buffer_descs[di].GetBuffer();
+                auto buffer_node = getBufferNode(device_data_, buffer);
+                if (!buffer_node) {
                     std::stringstream error_str;
                     error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                              << " is being used in draw but has not been updated.";
+                              << " references invalid buffer " << buffer << ".";
                     *error = error_str.str();
                     return false;
                 } else {
-                    if (GeneralBuffer == descriptors_[i]->GetClass()) {
-                        // Verify that buffers are valid
-                        auto buffer = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetBuffer();
-                        auto buffer_node = getBufferNode(device_data_, buffer);
-                        if (!buffer_node) {
+                    auto mem_entry = getMemObjInfo(device_data_, buffer_node->mem);
+                    if (!mem_entry) {
+                        std::stringstream error_str;
+                        error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
+                                  << " uses buffer " << buffer << " that references invalid memory " << buffer_node->mem << ".";
+                        *error = error_str.str();
+                        return false;
+                    }
+                }
+                if (buffer_descs[di].IsDynamic()) {
+                    // Validate that dynamic offsets are within the buffer
+                    auto buffer_size = buffer_node->createInfo.size;
+                    auto range = buffer_descs[di].GetRange();
+                    auto desc_offset = buffer_descs[di].GetOffset();
+                    auto dyn_offset = dynamic_offsets[dyn_offset_index++];
+                    if (VK_WHOLE_SIZE == range) {
+                        if ((dyn_offset + desc_offset) > buffer_size) {
                             std::stringstream error_str;
-                            error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                      << " references invalid buffer " << buffer << ".";
+                            error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
+                                      << " uses buffer " << buffer << " with update range of VK_WHOLE_SIZE has dynamic offset "
+                                      << dyn_offset << " combined with offset " << desc_offset
+                                      << " that oversteps the buffer size of " << buffer_size << ".";
                             *error = error_str.str();
                             return false;
-                        } else {
-                            auto mem_entry = getMemObjInfo(device_data_, buffer_node->mem);
-                            if (!mem_entry) {
-                                std::stringstream error_str;
-                                error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                          << " uses buffer " << buffer << " that references invalid memory " << buffer_node->mem
-                                          << ".";
-                                *error = error_str.str();
-                                return false;
-                            }
                         }
-                        if (descriptors_[i]->IsDynamic()) {
-                            // Validate that dynamic offsets are within the buffer
-                            auto buffer_size = buffer_node->createInfo.size;
-                            auto range = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetRange();
-                            auto desc_offset = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetOffset();
-                            auto dyn_offset = dynamic_offsets[dyn_offset_index++];
-                            if (VK_WHOLE_SIZE == range) {
-                                if ((dyn_offset + desc_offset) > buffer_size) {
-                                    std::stringstream error_str;
-                                    error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
-                                              << " uses buffer " << buffer
-                                              << " with update range of VK_WHOLE_SIZE has dynamic offset " << dyn_offset
-                                              << " combined with offset " << desc_offset << " that oversteps the buffer size of "
-                                              << buffer_size << ".";
-                                    *error = error_str.str();
-                                    return false;
-                                }
-                            } else {
-                                if ((dyn_offset + desc_offset + range) > buffer_size) {
-                                    std::stringstream error_str;
-                                    error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
-                                              << " uses buffer " << buffer << " with dynamic offset " << dyn_offset
-                                              << " combined with offset " << desc_offset << " and range " << range
-                                              << " that oversteps the buffer size of " << buffer_size << ".";
-                                    *error = error_str.str();
-                                    return false;
-                                }
-                            }
+                    } else {
+                        if ((dyn_offset + desc_offset + range) > buffer_size) {
+                            std::stringstream error_str;
+                            error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
+                                      << " uses buffer " << buffer << " with dynamic offset " << dyn_offset
+                                      << " combined with offset " << desc_offset << " and range " << range
+                                      << " that oversteps the buffer size of " << buffer_size << ".";
+                            *error = error_str.str();
+                            return false;
                         }
                     }
                 }
@@ -418,66 +494,70 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::unordered_set<
 }
 // For given bindings, place any update buffers or images into the passed-in unordered_sets
 uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::unordered_set<uint32_t> &bindings,
-                                                           std::unordered_set<VkBuffer> *buffer_set,
-                                                           std::unordered_set<VkImageView> *image_set) const {
+                                                           cb_unordered_set<VkBuffer> *buffer_set,
+                                                           cb_unordered_set<VkImageView> *image_set) const {
     auto num_updates = 0;
     for (auto binding : bindings) {
         // If a binding doesn't exist, skip it
         if (!p_layout_->HasBinding(binding)) {
             continue;
         }
-        auto start_idx = p_layout_->GetGlobalStartIndexFromBinding(binding);
-        if (descriptors_[start_idx]->IsStorage()) {
-            if (Image == descriptors_[start_idx]->descriptor_class) {
-                for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
-                    if (descriptors_[start_idx + i]->updated) {
-                        image_set->insert(static_cast<ImageDescriptor *>(descriptors_[start_idx + i].get())->GetImageView());
-                        num_updates++;
-                    }
-                }
-            } else if (TexelBuffer == descriptors_[start_idx]->descriptor_class) {
-                for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
-                    if (descriptors_[start_idx + i]->updated) {
-                        auto bufferview = static_cast<TexelDescriptor *>(descriptors_[start_idx + i].get())->GetBufferView();
-                        auto bv_info = getBufferViewInfo(device_data_, bufferview);
-                        if (bv_info) {
-                            buffer_set->insert(bv_info->buffer);
-                            num_updates++;
-                        }
-                    }
+        auto index = p_layout_->GetIndexFromBinding(binding);
+        auto start_idx = p_layout_->GetGlobalStartIndexFromIndex(index);
+        auto count = p_layout_->GetDescriptorCountFromIndex(index);
+        auto offset = binding_offsets_[index];
+        switch (p_layout_->GetTypeFromIndex(index)) {
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            for (uint32_t i = 0; i < count; ++i) {
+                if (updated_[start_idx + i]) {
+                    image_set->insert(images_[offset + i].GetImageView());
+                    num_updates++;
                 }
-            } else if (GeneralBuffer == descriptors_[start_idx]->descriptor_class) {
-                for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
-                    if (descriptors_[start_idx + i]->updated) {
-                        buffer_set->insert(static_cast<BufferDescriptor *>(descriptors_[start_idx + i].get())->GetBuffer());
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            for (uint32_t i = 0; i < count; ++i) {
+                if (updated_[start_idx + i]) {
+                    auto bv_info = getBufferViewInfo(device_data_, texel_buffers_[offset + i].GetBufferView());
+                    if (bv_info) {
+                        buffer_set->insert(bv_info->buffer);
                         num_updates++;
                     }
                 }
             }
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            for (uint32_t i = 0; i < count; ++i) {
+                if (updated_[start_idx + i]) {
+                    buffer_set->insert(buffers_[offset + i].GetBuffer());
+                    num_updates++;
+                }
+            }
+            break;
+        default:
+            break;
         }
     }
     return num_updates;
 }
 // Set is being deleted or updates so invalidate all bound cmd buffers
-void cvdescriptorset::DescriptorSet::InvalidateBoundCmdBuffers() {
-    core_validation::invalidateCommandBuffers(cb_bindings,
-                                              {reinterpret_cast<uint64_t &>(set_), VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT});
-}
+void cvdescriptorset::DescriptorSet::InvalidateBoundCmdBuffers() { core_validation::invalidateCommandBuffers(this); }
 // Perform write update in given update struct
 void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet *update) {
     auto start_idx = p_layout_->GetGlobalStartIndexFromBinding(update->dstBinding) + update->dstArrayElement;
     // perform update
     for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        descriptors_[start_idx + di]->WriteUpdate(update, di);
+        GetDescriptorFromGlobalIndex(start_idx + di)->WriteUpdate(update, di);
+        updated_[start_idx + di] = true;
     }
     if (update->descriptorCount)
         some_update_ = true;
-
-    InvalidateBoundCmdBuffers();
 }
 // Validate Copy update
 bool cvdescriptorset::DescriptorSet::ValidateCopyUpdate(const debug_report_data *report_data, const VkCopyDescriptorSet *update,
-                                                        const DescriptorSet *src_set, std::string *error) {
+                                                        const DescriptorSet *src_set, UpdateValidationCache *cache,
+                                                        std::string *error) {
     // Verify idle ds
     if (in_use.load()) {
         std::stringstream error_str;
@@ -540,18 +620,8 @@ bool cvdescriptorset::DescriptorSet::ValidateCopyUpdate(const debug_report_data
                                              set_, error))) {
         return false;
     }
-    // First make sure source descriptors are updated
-    for (uint32_t i = 0; i < update->descriptorCount; ++i) {
-        if (!src_set->descriptors_[src_start_idx + i]) {
-            std::stringstream error_str;
-            error_str << "Attempting copy update from descriptorSet " << src_set << " binding #" << update->srcBinding << " but descriptor at array offset "
-                      << update->srcArrayElement + i << " has not been updated.";
-            *error = error_str.str();
-            return false;
-        }
-    }
-    // Update parameters all look good and descriptor updated so verify update contents
-    if (!VerifyCopyUpdateContents(update, src_set, src_type, src_start_idx, error))
+    // Update parameters all look good so verify update contents
+    if (!VerifyCopyUpdateContents(update, src_set, src_type, src_start_idx, cache, error))
         return false;
 
     // All checks passed so update is good
@@ -563,26 +633,22 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
     auto dst_start_idx = p_layout_->GetGlobalStartIndexFromBinding(update->dstBinding) + update->dstArrayElement;
     // Update parameters all look good so perform update
     for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        descriptors_[dst_start_idx + di]->CopyUpdate(src_set->descriptors_[src_start_idx + di].get());
+        GetDescriptorFromGlobalIndex(dst_start_idx + di)->CopyUpdate(src_set->GetDescriptorFromGlobalIndex(src_start_idx + di));
+        updated_[dst_start_idx + di] = true;
     }
     if (update->descriptorCount)
         some_update_ = true;
-
-    InvalidateBoundCmdBuffers();
 }
 
-cvdescriptorset::SamplerDescriptor::SamplerDescriptor() : sampler_(VK_NULL_HANDLE), immutable_(false) {
-    updated = false;
+cvdescriptorset::SamplerDescriptor::SamplerDescriptor() : immutable_(false), sampler_(VK_NULL_HANDLE) {
     descriptor_class = PlainSampler;
 };
 
-cvdescriptorset::SamplerDescriptor::SamplerDescriptor(const VkSampler *immut) : sampler_(VK_NULL_HANDLE), immutable_(false) {
-    updated = false;
+cvdescriptorset::SamplerDescriptor::SamplerDescriptor(const VkSampler *immut) : immutable_(false), sampler_(VK_NULL_HANDLE) {
     descriptor_class = PlainSampler;
     if (immut) {
         sampler_ = *immut;
         immutable_ = true;
-        updated = true;
     }
 }
 // Validate given sampler. Currently this only checks to make sure it exists in the samplerMap
@@ -735,7 +801,6 @@ bool cvdescriptorset::ValidateImageUpdate(VkImageView image_view, VkImageLayout
 
 void cvdescriptorset::SamplerDescriptor::WriteUpdate(const VkWriteDescriptorSet *update, const uint32_t index) {
     sampler_ = update->pImageInfo[index].sampler;
-    updated = true;
 }
 
 void cvdescriptorset::SamplerDescriptor::CopyUpdate(const Descriptor *src) {
@@ -743,28 +808,23 @@ void cvdescriptorset::SamplerDescriptor::CopyUpdate(const Descriptor *src) {
         auto update_sampler = static_cast<const SamplerDescriptor *>(src)->sampler_;
         sampler_ = update_sampler;
     }
-    updated = true;
 }
 
 cvdescriptorset::ImageSamplerDescriptor::ImageSamplerDescriptor()
-    : sampler_(VK_NULL_HANDLE), immutable_(false), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
-    updated = false;
+    : immutable_(false), sampler_(VK_NULL_HANDLE), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
     descriptor_class = ImageSampler;
 }
 
 cvdescriptorset::ImageSamplerDescriptor::ImageSamplerDescriptor(const VkSampler *immut)
-    : sampler_(VK_NULL_HANDLE), immutable_(true), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
-    updated = false;
+    : immutable_(true), sampler_(VK_NULL_HANDLE), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
     descriptor_class = ImageSampler;
     if (immut) {
         sampler_ = *immut;
         immutable_ = true;
-        updated = true;
     }
 }
 
 void cvdescriptorset::ImageSamplerDescriptor::WriteUpdate(const VkWriteDescriptorSet *update, const uint32_t index) {
-    updated = true;
     const auto &image_info = update->pImageInfo[index];
     sampler_ = image_info.sampler;
     image_view_ = image_info.imageView;
@@ -778,21 +838,18 @@ void cvdescriptorset::ImageSamplerDescriptor::CopyUpdate(const Descriptor *src)
     }
     auto image_view = static_cast<const ImageSamplerDescriptor *>(src)->image_view_;
     auto image_layout = static_cast<const ImageSamplerDescriptor *>(src)->image_layout_;
-    updated = true;
     image_view_ = image_view;
     image_layout_ = image_layout;
 }
 
 cvdescriptorset::ImageDescriptor::ImageDescriptor(const VkDescriptorType type)
     : storage_(false), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
-    updated = false;
     descriptor_class = Image;
     if (VK_DESCRIPTOR_TYPE_STORAGE_IMAGE == type)
         storage_ = true;
 };
 
 void cvdescriptorset::ImageDescriptor::WriteUpdate(const VkWriteDescriptorSet *update, const uint32_t index) {
-    updated = true;
     const auto &image_info = update->pImageInfo[index];
     image_view_ = image_info.imageView;
     image_layout_ = image_info.imageLayout;
@@ -801,14 +858,12 @@ void cvdescriptorset::ImageDescriptor::WriteUpdate(const VkWriteDescriptorSet *u
 void cvdescriptorset::ImageDescriptor::CopyUpdate(const Descriptor *src) {
     auto image_view = static_cast<const ImageDescriptor *>(src)->image_view_;
     auto image_layout = static_cast<const ImageDescriptor *>(src)->image_layout_;
-    updated = true;
     image_view_ = image_view;
     image_layout_ = image_layout;
 }
 
 cvdescriptorset::BufferDescriptor::BufferDescriptor(const VkDescriptorType type)
     : storage_(false), dynamic_(false), buffer_(VK_NULL_HANDLE), offset_(0), range_(0) {
-    updated = false;
     descriptor_class = GeneralBuffer;
     if (VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC == type) {
         dynamic_ = true;
@@ -820,7 +875,6 @@ cvdescriptorset::BufferDescriptor::BufferDescriptor(const VkDescriptorType type)
     }
 }
 void cvdescriptorset::BufferDescriptor::WriteUpdate(const VkWriteDescriptorSet *update, const uint32_t index) {
-    updated = true;
     const auto &buffer_info = update->pBufferInfo[index];
     buffer_ = buffer_info.buffer;
     offset_ = buffer_info.offset;
@@ -829,26 +883,22 @@ void cvdescriptorset::BufferDescriptor::WriteUpdate(const VkWriteDescriptorSet *
 
 void cvdescriptorset::BufferDescriptor::CopyUpdate(const Descriptor *src) {
     auto buff_desc = static_cast<const BufferDescriptor *>(src);
-    updated = true;
     buffer_ = buff_desc->buffer_;
     offset_ = buff_desc->offset_;
     range_ = buff_desc->range_;
 }
 
-cvdescriptorset::TexelDescriptor::TexelDescriptor(const VkDescriptorType type) : buffer_view_(VK_NULL_HANDLE), storage_(false) {
-    updated = false;
+cvdescriptorset::TexelDescriptor::TexelDescriptor(const VkDescriptorType type) : storage_(false), buffer_view_(VK_NULL_HANDLE) {
     descriptor_class = TexelBuffer;
     if (VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER == type)
         storage_ = true;
 };
 
 void cvdescriptorset::TexelDescriptor::WriteUpdate(const VkWriteDescriptorSet *update, const uint32_t index) {
-    updated = true;
     buffer_view_ = update->pTexelBufferView[index];
 }
 
 void cvdescriptorset::TexelDescriptor::CopyUpdate(const Descriptor *src) {
-    updated = true;
     buffer_view_ = static_cast<const TexelDescriptor *>(src)->buffer_view_;
 }
 // This is a helper function that iterates over a set of Write and Copy updates, pulls the DescriptorSet* for updated
@@ -861,10 +911,16 @@ bool cvdescriptorset::ValidateUpdateDescriptorSets(const debug_report_data *repo
                                                    const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                                    const VkCopyDescriptorSet *p_cds) {
     bool skip_call = false;
+    UpdateValidationCache cache;
+    // Consecutive writes usually go to the same set, so only look the set up again when it changes
+    VkDescriptorSet dest_set = VK_NULL_HANDLE;
+    DescriptorSet *set_node = nullptr;
     // Validate Write updates
     for (uint32_t i = 0; i < write_count; i++) {
-        auto dest_set = p_wds[i].dstSet;
-        auto set_node = core_validation::getSetNode(dev_data, dest_set);
+        if (!set_node || dest_set != p_wds[i].dstSet) {
+            dest_set = p_wds[i].dstSet;
+            set_node = core_validation::getSetNode(dev_data, dest_set);
+        }
         if (!set_node) {
             skip_call |=
                 log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
@@ -873,7 +929,7 @@ bool cvdescriptorset::ValidateUpdateDescriptorSets(const debug_report_data *repo
                         reinterpret_cast<uint64_t &>(dest_set));
         } else {
             std::string error_str;
-            if (!set_node->ValidateWriteUpdate(report_data, &p_wds[i], &error_str)) {
+            if (!set_node->ValidateWriteUpdate(report_data, &p_wds[i], &cache, &error_str)) {
                 skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                                      reinterpret_cast<uint64_t &>(dest_set), __LINE__, DRAWSTATE_INVALID_WRITE_UPDATE, "DS",
                                      "vkUpdateDescriptorsSets() failed write update validation for Descriptor Set 0x%" PRIx64
@@ -902,7 +958,7 @@ bool cvdescriptorset::ValidateUpdateDescriptorSets(const debug_report_data *repo
                                  reinterpret_cast<uint64_t &>(dst_set));
         } else {
             std::string error_str;
-            if (!dst_node->ValidateCopyUpdate(report_data, &p_cds[i], src_node, &error_str)) {
+            if (!dst_node->ValidateCopyUpdate(report_data, &p_cds[i], src_node, &cache, &error_str)) {
                 skip_call |=
                     log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                             reinterpret_cast<uint64_t &>(dst_set), __LINE__, DRAWSTATE_INVALID_COPY_UPDATE, "DS",
@@ -916,6 +972,7 @@ bool cvdescriptorset::ValidateUpdateDescriptorSets(const debug_report_data *repo
 }
 // This is a helper function that iterates over a set of Write and Copy updates, pulls the DescriptorSet* for updated
 //  sets, and then calls their respective Perform[Write|Copy]Update functions.
+// Command buffers bound to each updated set are invalidated once, after all of the updates.
 // Prerequisite : ValidateUpdateDescriptorSets() should be called and return "false" prior to calling PerformUpdateDescriptorSets()
 //  with the same set of updates.
 // This is split from the validate code to allow validation prior to calling down the chain, and then update after
@@ -923,11 +980,18 @@ bool cvdescriptorset::ValidateUpdateDescriptorSets(const debug_report_data *repo
 void cvdescriptorset::PerformUpdateDescriptorSets(const core_validation::layer_data *dev_data, uint32_t write_count,
                                                   const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                                   const VkCopyDescriptorSet *p_cds) {
+    std::unordered_set<DescriptorSet *> updated_sets;
     // Write updates first
+    VkDescriptorSet dest_set = VK_NULL_HANDLE;
+    DescriptorSet *set_node = nullptr;
     uint32_t i = 0;
     for (i = 0; i < write_count; ++i) {
-        auto dest_set = p_wds[i].dstSet;
-        auto set_node = core_validation::getSetNode(dev_data, dest_set);
+        if (!set_node || dest_set != p_wds[i].dstSet) {
+            dest_set = p_wds[i].dstSet;
+            set_node = core_validation::getSetNode(dev_data, dest_set);
+            if (set_node)
+                updated_sets.insert(set_node);
+        }
         if (set_node) {
             set_node->PerformWriteUpdate(&p_wds[i]);
         }
@@ -940,13 +1004,17 @@ void cvdescriptorset::PerformUpdateDescriptorSets(const core_validation::layer_d
         auto dst_node = core_validation::getSetNode(dev_data, dst_set);
         if (src_node && dst_node) {
             dst_node->PerformCopyUpdate(&p_cds[i], src_node);
+            updated_sets.insert(dst_node);
         }
     }
+    for (auto updated_set : updated_sets) {
+        updated_set->InvalidateBoundCmdBuffers();
+    }
 }
 // Validate the state for a given write update but don't actually perform the update
 //  If an error would occur for this update, return false and fill in details in error_msg string
 bool cvdescriptorset::DescriptorSet::ValidateWriteUpdate(const debug_report_data *report_data, const VkWriteDescriptorSet *update,
-                                                         std::string *error_msg) {
+                                                         UpdateValidationCache *cache, std::string *error_msg) {
     // Verify idle ds
     if (in_use.load()) {
         std::stringstream error_str;
@@ -987,7 +1055,7 @@ bool cvdescriptorset::DescriptorSet::ValidateWriteUpdate(const debug_report_data
                                             set_, error_msg))
         return false;
     // Update is within bounds and consistent so last step is to validate update contents
-    if (!VerifyWriteUpdateContents(update, start_idx, error_msg)) {
+    if (!VerifyWriteUpdateContents(update, start_idx, cache, error_msg)) {
         std::stringstream error_str;
         error_str << "Write update to descriptor in set " << set_ << " binding #" << update->dstBinding
                   << " failed with error message: " << error_msg->c_str();
@@ -1040,6 +1108,25 @@ bool cvdescriptorset::DescriptorSet::ValidateBufferUsage(BUFFER_NODE const *buff
     }
     return true;
 }
+// Validate sampler for an update unless it has already passed in this vkUpdateDescriptorSets() call
+bool cvdescriptorset::DescriptorSet::ValidateSamplerUse(VkSampler sampler, UpdateValidationCache *cache) const {
+    if (cache->IsSamplerValid(sampler))
+        return true;
+    if (!ValidateSampler(sampler, device_data_))
+        return false;
+    cache->SetSamplerValid(sampler);
+    return true;
+}
+// Validate image view for an update with the given layout and type unless it has already passed in this call
+bool cvdescriptorset::DescriptorSet::ValidateImageUse(VkImageView image_view, VkImageLayout image_layout, VkDescriptorType type,
+                                                      UpdateValidationCache *cache, std::string *error) const {
+    if (cache->IsImageViewValid(image_view, image_layout, type))
+        return true;
+    if (!ValidateImageUpdate(image_view, image_layout, type, device_data_, error))
+        return false;
+    cache->SetImageViewValid(image_view, image_layout, type);
+    return true;
+}
 // For buffer descriptor updates, verify the buffer usage and VkDescriptorBufferInfo struct which includes:
 //  1. buffer is valid
 //  2. buffer was created with correct usage flags
@@ -1047,21 +1134,28 @@ bool cvdescriptorset::DescriptorSet::ValidateBufferUsage(BUFFER_NODE const *buff
 //  4. range is either VK_WHOLE_SIZE or falls in (0, (buffer size - offset)]
 // If there's an error, update the error string with details and return false, else return true
 bool cvdescriptorset::DescriptorSet::ValidateBufferUpdate(VkDescriptorBufferInfo const *buffer_info, VkDescriptorType type,
-                                                          std::string *error) const {
-    // First make sure that buffer is valid
-    auto buffer_node = getBufferNode(device_data_, buffer_info->buffer);
+                                                          UpdateValidationCache *cache, std::string *error) const {
+    // Checks of the buffer itself only need to be made the first time it's used for this type in this call
+    auto buffer_node = cache->GetValidBuffer(buffer_info->buffer, type);
     if (!buffer_node) {
-        std::stringstream error_str;
-        error_str << "Invalid VkBuffer: " << buffer_info->buffer;
-        *error = error_str.str();
-        return false;
-    }
-    if (ValidateMemoryIsBoundToBuffer(device_data_, buffer_node, "vkUpdateDescriptorSets()"))
-        return false;
-    // Verify usage bits
-    if (!ValidateBufferUsage(buffer_node, type, error)) {
-        // error will have been updated by ValidateBufferUsage()
-        return false;
+        // First make sure that buffer is valid
+        buffer_node = getBufferNode(device_data_, buffer_info->buffer);
+        if (!buffer_node) {
+            std::stringstream error_str;
+            error_str << "Invalid VkBuffer: " << buffer_info->buffer;
+            *error = error_str.str();
+            return false;
+        }
+        if (ValidateMemoryIsBoundToBuffer(device_data_, buffer_node, "vkUpdateDescriptorSets()"))
+            return false;
+        // Verify usage bits
+        if (!ValidateBufferUsage(buffer_node, type, error)) {
+            // error will have been updated by ValidateBufferUsage()
+            return false;
+        }
+        // A missing memory binding that was reported without skipping the call is reported again for each use
+        if (buffer_node->mem || (buffer_node->createInfo.flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT))
+            cache->SetBufferValid(buffer_info->buffer, type, buffer_node);
     }
     // offset must be less than buffer size
     if (buffer_info->offset > buffer_node->createInfo.size) {
@@ -1093,14 +1187,14 @@ bool cvdescriptorset::DescriptorSet::ValidateBufferUpdate(VkDescriptorBufferInfo
 
 // Verify that the contents of the update are ok, but don't perform actual update
 bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDescriptorSet *update, const uint32_t index,
-                                                               std::string *error) const {
+                                                               UpdateValidationCache *cache, std::string *error) const {
     switch (update->descriptorType) {
     case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
             // Validate image
             auto image_view = update->pImageInfo[di].imageView;
             auto image_layout = update->pImageInfo[di].imageLayout;
-            if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, device_data_, error)) {
+            if (!ValidateImageUse(image_view, image_layout, update->descriptorType, cache, error)) {
                 std::stringstream error_str;
                 error_str << "Attempted write update to combined image sampler descriptor failed due to: " << error->c_str();
                 *error = error_str.str();
@@ -1111,8 +1205,8 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
     }
     case VK_DESCRIPTOR_TYPE_SAMPLER: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            if (!descriptors_[index + di].get()->IsImmutableSampler()) {
-                if (!ValidateSampler(update->pImageInfo[di].sampler, device_data_)) {
+            if (!GetDescriptorFromGlobalIndex(index + di)->IsImmutableSampler()) {
+                if (!ValidateSamplerUse(update->pImageInfo[di].sampler, cache)) {
                     std::stringstream error_str;
                     error_str << "Attempted write update to sampler descriptor with invalid sampler: "
                               << update->pImageInfo[di].sampler << ".";
@@ -1131,7 +1225,7 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
             auto image_view = update->pImageInfo[di].imageView;
             auto image_layout = update->pImageInfo[di].imageLayout;
-            if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, device_data_, error)) {
+            if (!ValidateImageUse(image_view, image_layout, update->descriptorType, cache, error)) {
                 std::stringstream error_str;
                 error_str << "Attempted write update to image descriptor failed due to: " << error->c_str();
                 *error = error_str.str();
@@ -1144,6 +1238,8 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
     case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
             auto buffer_view = update->pTexelBufferView[di];
+            if (cache->IsBufferViewValid(buffer_view, update->descriptorType))
+                continue;
             auto bv_info = getBufferViewInfo(device_data_, buffer_view);
             if (!bv_info) {
                 std::stringstream error_str;
@@ -1158,6 +1254,7 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
                 *error = error_str.str();
                 return false;
             }
+            cache->SetBufferViewValid(buffer_view, update->descriptorType);
         }
         break;
     }
@@ -1166,7 +1263,7 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
     case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
     case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, error)) {
+            if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, cache, error)) {
                 std::stringstream error_str;
                 error_str << "Attempted write update to buffer descriptor failed due to: " << error->c_str();
                 *error = error_str.str();
@@ -1184,13 +1281,25 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
 }
 // Verify that the contents of the update are ok, but don't perform actual update
 bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, const DescriptorSet *src_set,
-                                                              VkDescriptorType type, uint32_t index, std::string *error) const {
-    switch (src_set->descriptors_[index]->descriptor_class) {
+                                                              VkDescriptorType type, uint32_t index, UpdateValidationCache *cache,
+                                                              std::string *error) const {
+    // First make sure source descriptors are updated
+    for (uint32_t di = 0; di < update->descriptorCount; ++di) {
+        if (!src_set->updated_[index + di]) {
+            std::stringstream error_str;
+            error_str << "Attempting copy update from descriptorSet " << src_set->GetSet() << " binding #" << update->srcBinding
+                      << " but descriptor at array offset " << update->srcArrayElement + di << " has not been updated.";
+            *error = error_str.str();
+            return false;
+        }
+    }
+    switch (src_set->GetDescriptorFromGlobalIndex(index)->GetClass()) {
     case PlainSampler: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            if (!src_set->descriptors_[index + di]->IsImmutableSampler()) {
-                auto update_sampler = static_cast<SamplerDescriptor *>(src_set->descriptors_[index + di].get())->GetSampler();
-                if (!ValidateSampler(update_sampler, device_data_)) {
+            auto samp_desc = static_cast<const SamplerDescriptor *>(src_set->GetDescriptorFromGlobalIndex(index + di));
+            if (!samp_desc->IsImmutableSampler()) {
+                auto update_sampler = samp_desc->GetSampler();
+                if (!ValidateSamplerUse(update_sampler, cache)) {
                     std::stringstream error_str;
                     error_str << "Attempted copy update to sampler descriptor with invalid sampler: " << update_sampler << ".";
                     *error = error_str.str();
@@ -1204,11 +1313,11 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
     }
     case ImageSampler: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            auto img_samp_desc = static_cast<const ImageSamplerDescriptor *>(src_set->descriptors_[index + di].get());
+            auto img_samp_desc = static_cast<const ImageSamplerDescriptor *>(src_set->GetDescriptorFromGlobalIndex(index + di));
             // First validate sampler
             if (!img_samp_desc->IsImmutableSampler()) {
                 auto update_sampler = img_samp_desc->GetSampler();
-                if (!ValidateSampler(update_sampler, device_data_)) {
+                if (!ValidateSamplerUse(update_sampler, cache)) {
                     std::stringstream error_str;
                     error_str << "Attempted copy update to sampler descriptor with invalid sampler: " << update_sampler << ".";
                     *error = error_str.str();
@@ -1220,20 +1329,21 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
             // Validate image
             auto image_view = img_samp_desc->GetImageView();
             auto image_layout = img_samp_desc->GetImageLayout();
-            if (!ValidateImageUpdate(image_view, image_layout, type, device_data_, error)) {
+            if (!ValidateImageUse(image_view, image_layout, type, cache, error)) {
                 std::stringstream error_str;
                 error_str << "Attempted copy update to combined image sampler descriptor failed due to: " << error->c_str();
                 *error = error_str.str();
                 return false;
             }
         }
+        break;
     }
     case Image: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            auto img_desc = static_cast<const ImageDescriptor *>(src_set->descriptors_[index + di].get());
+            auto img_desc = static_cast<const ImageDescriptor *>(src_set->GetDescriptorFromGlobalIndex(index + di));
             auto image_view = img_desc->GetImageView();
             auto image_layout = img_desc->GetImageLayout();
-            if (!ValidateImageUpdate(image_view, image_layout, type, device_data_, error)) {
+            if (!ValidateImageUse(image_view, image_layout, type, cache, error)) {
                 std::stringstream error_str;
                 error_str << "Attempted copy update to image descriptor failed due to: " << error->c_str();
                 *error = error_str.str();
@@ -1244,7 +1354,10 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
     }
     case TexelBuffer: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            auto buffer_view = static_cast<TexelDescriptor *>(src_set->descriptors_[index + di].get())->GetBufferView();
+            auto texel_desc = static_cast<const TexelDescriptor *>(src_set->GetDescriptorFromGlobalIndex(index + di));
+            auto buffer_view = texel_desc->GetBufferView();
+            if (cache->IsBufferViewValid(buffer_view, type))
+                continue;
             auto bv_info = getBufferViewInfo(device_data_, buffer_view);
             if (!bv_info) {
                 std::stringstream error_str;
@@ -1259,12 +1372,13 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
                 *error = error_str.str();
                 return false;
             }
+            cache->SetBufferViewValid(buffer_view, type);
         }
         break;
     }
     case GeneralBuffer: {
         for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-            auto buffer = static_cast<BufferDescriptor *>(src_set->descriptors_[index + di].get())->GetBuffer();
+            auto buffer = static_cast<const BufferDescriptor *>(src_set->GetDescriptorFromGlobalIndex(index + di))->GetBuffer();
             if (!ValidateBufferUsage(getBufferNode(device_data_, buffer), type, error)) {
                 std::stringstream error_str;
                 error_str << "Attempted copy update to buffer descriptor failed due to: " << error->c_str();
@@ -1281,6 +1395,37 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
     // All checks passed so update contents are good
     return true;
 }
+// Size the pool's set arena for maxSets sets holding all of the pool's descriptors, capped so that a large pool that is
+//  never filled costs little. A pool that turns out to need more grows its arena, and settles at that size after a reset.
+size_t cvdescriptorset::GetPoolArenaSize(const VkDescriptorPoolCreateInfo *p_create_info) {
+    // Set object, its node in the pool's set container, and rounding of its 7 arrays to the arena's granularity
+    const size_t per_set = sizeof(DescriptorSet) + 64 + 7 * 16;
+    const size_t max_size = 4 * 1024 * 1024;
+    size_t size = p_create_info->maxSets * per_set;
+    for (uint32_t i = 0; i < p_create_info->poolSizeCount; ++i) {
+        size_t descriptor_size = 0;
+        switch (GetDescriptorClass(p_create_info->pPoolSizes[i].type)) {
+        case PlainSampler:
+            descriptor_size = sizeof(SamplerDescriptor);
+            break;
+        case ImageSampler:
+            descriptor_size = sizeof(ImageSamplerDescriptor);
+            break;
+        case Image:
+            descriptor_size = sizeof(ImageDescriptor);
+            break;
+        case TexelBuffer:
+            descriptor_size = sizeof(TexelDescriptor);
+            break;
+        default:
+            descriptor_size = sizeof(BufferDescriptor);
+            break;
+        }
+        // Each descriptor may also be in a binding of its own
+        size += p_create_info->pPoolSizes[i].descriptorCount * (descriptor_size + sizeof(uint32_t));
+    }
+    return size < max_size ? size : max_size;
+}
 // Verify that the state at allocate time is correct, but don't actually allocate the sets yet
 bool cvdescriptorset::ValidateAllocateDescriptorSets(const debug_report_data *report_data,
                                                      const VkDescriptorSetAllocateInfo *p_alloc_info,
@@ -1345,8 +1490,15 @@ void cvdescriptorset::PerformAllocateDescriptorSets(const VkDescriptorSetAllocat
     /* Create tracking object for each descriptor set; insert into
      * global map and the pool's set.
      */
+    auto arena = pool_state->setArena.get();
     for (uint32_t i = 0; i < p_alloc_info->descriptorSetCount; i++) {
-        auto new_ds = new cvdescriptorset::DescriptorSet(descriptor_sets[i], ds_data->layout_nodes[i], dev_data);
+        cvdescriptorset::DescriptorSet *new_ds = nullptr;
+        if (arena) {
+            new_ds = new (arena->allocate(sizeof(cvdescriptorset::DescriptorSet)))
+                cvdescriptorset::DescriptorSet(descriptor_sets[i], ds_data->layout_nodes[i], dev_data, arena);
+        } else {
+            new_ds = new cvdescriptorset::DescriptorSet(descriptor_sets[i], ds_data->layout_nodes[i], dev_data, nullptr);
+        }
 
         pool_state->sets.insert(new_ds);
         new_ds->in_use.store(0);
@@ -111,6 +111,11 @@ class DescriptorSetLayout {
     VkDescriptorType GetTypeFromBinding(const uint32_t) const;
     VkDescriptorType GetTypeFromIndex(const uint32_t) const;
     VkDescriptorType GetTypeFromGlobalIndex(const uint32_t) const;
+    // Translate between binding#, index and global index
+    //  These calls should be guarded by a call to "HasBinding(binding)" or a bounds check on the index
+    uint32_t GetIndexFromBinding(const uint32_t) const;
+    uint32_t GetIndexFromGlobalIndex(const uint32_t) const;
+    uint32_t GetGlobalStartIndexFromIndex(const uint32_t index) const { return global_start_indices_[index]; };
     VkShaderStageFlags GetStageFlagsFromBinding(const uint32_t) const;
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t) const;
     VkSampler const *GetImmutableSamplerPtrFromIndex(const uint32_t) const;
@@ -127,6 +132,7 @@ class DescriptorSetLayout {
     std::unordered_map<uint32_t, uint32_t> binding_to_index_map_;
     std::unordered_map<uint32_t, uint32_t> binding_to_global_start_index_map_;
     std::unordered_map<uint32_t, uint32_t> binding_to_global_end_index_map_;
+    std::vector<uint32_t> global_start_indices_; // global start index for each index, in ascending order
     // VkDescriptorSetLayoutCreateFlags flags_;
     uint32_t binding_count_; // # of bindings in this layout
     std::vector<safe_VkDescriptorSetLayoutBinding> bindings_;
@@ -139,6 +145,8 @@ class DescriptorSetLayout {
  *  Descriptor is an abstract base class from which 5 separate descriptor types are derived.
  *   This allows the WriteUpdate() and CopyUpdate() operations to be specialized per
  *   descriptor type, but all descriptors in a set can be accessed via the common Descriptor*.
+ *  Descriptors are held by value in their DescriptorSet, which also tracks whether each one
+ *   has been updated.
  */
 
 // Slightly broader than type, each c++ "class" will has a corresponding "DescriptorClass"
@@ -156,7 +164,6 @@ class Descriptor {
     virtual bool IsDynamic() const { return false; };
     // Check for storage descriptor type
     virtual bool IsStorage() const { return false; };
-    bool updated; // Has descriptor been updated?
     DescriptorClass descriptor_class;
 };
 // Shared helper functions - These are useful because the shared sampler image descriptor type
@@ -175,8 +182,8 @@ class SamplerDescriptor : public Descriptor {
 
   private:
     // bool ValidateSampler(const VkSampler) const;
-    VkSampler sampler_;
     bool immutable_;
+    VkSampler sampler_;
 };
 
 class ImageSamplerDescriptor : public Descriptor {
@@ -191,8 +198,8 @@ class ImageSamplerDescriptor : public Descriptor {
     VkImageLayout GetImageLayout() const { return image_layout_; }
 
   private:
-    VkSampler sampler_;
     bool immutable_;
+    VkSampler sampler_;
     VkImageView image_view_;
     VkImageLayout image_layout_;
 };
@@ -221,8 +228,8 @@ class TexelDescriptor : public Descriptor {
     VkBufferView GetBufferView() const { return buffer_view_; }
 
   private:
-    VkBufferView buffer_view_;
     bool storage_;
+    VkBufferView buffer_view_;
 };
 
 class BufferDescriptor : public Descriptor {
@@ -249,6 +256,51 @@ struct AllocateDescriptorSetsData {
     std::vector<cvdescriptorset::DescriptorSetLayout const *> layout_nodes;
     AllocateDescriptorSetsData(uint32_t);
 };
+// Objects that have passed validation for use in descriptor updates during one vkUpdateDescriptorSets() call
+//  Object state can't change during the call, so each object only needs to be looked up and checked once for each
+//  way it's used (image layout and/or descriptor type), however many descriptors it's written to.
+class UpdateValidationCache {
+  public:
+    bool IsSamplerValid(VkSampler sampler) const { return samplers_.count(sampler) != 0; };
+    void SetSamplerValid(VkSampler sampler) { samplers_.insert(sampler); };
+    bool IsImageViewValid(VkImageView view, VkImageLayout layout, VkDescriptorType type) const {
+        return image_views_.count(Use(reinterpret_cast<uint64_t &>(view), (uint64_t(layout) << 32) | type)) != 0;
+    };
+    void SetImageViewValid(VkImageView view, VkImageLayout layout, VkDescriptorType type) {
+        image_views_.insert(Use(reinterpret_cast<uint64_t &>(view), (uint64_t(layout) << 32) | type));
+    };
+    bool IsBufferViewValid(VkBufferView view, VkDescriptorType type) const {
+        return buffer_views_.count(Use(reinterpret_cast<uint64_t &>(view), type)) != 0;
+    };
+    void SetBufferViewValid(VkBufferView view, VkDescriptorType type) {
+        buffer_views_.insert(Use(reinterpret_cast<uint64_t &>(view), type));
+    };
+    // Buffers keep their node as offset and range are still checked against its size for each descriptor
+    BUFFER_NODE const *GetValidBuffer(VkBuffer buffer, VkDescriptorType type) const {
+        auto itr = buffers_.find(Use(reinterpret_cast<uint64_t &>(buffer), type));
+        return itr == buffers_.end() ? nullptr : itr->second;
+    };
+    void SetBufferValid(VkBuffer buffer, VkDescriptorType type, BUFFER_NODE const *buffer_node) {
+        buffers_[Use(reinterpret_cast<uint64_t &>(buffer), type)] = buffer_node;
+    };
+
+  private:
+    struct Use {
+        Use(uint64_t handle, uint64_t detail) : handle(handle), detail(detail){};
+        bool operator==(const Use &rhs) const { return handle == rhs.handle && detail == rhs.detail; };
+        uint64_t handle;
+        uint64_t detail;
+    };
+    struct UseHash {
+        size_t operator()(const Use &use) const {
+            return std::hash<uint64_t>()(use.handle ^ (use.detail * 0x9E3779B97F4A7C15ull));
+        };
+    };
+    std::unordered_set<VkSampler> samplers_;
+    std::unordered_set<Use, UseHash> image_views_;
+    std::unordered_set<Use, UseHash> buffer_views_;
+    std::unordered_map<Use, BUFFER_NODE const *, UseHash> buffers_;
+};
 // Helper functions for descriptor set functions that cross multiple sets
 // "Validate" will make sure an update is ok without actually performing it
 bool ValidateUpdateDescriptorSets(const debug_report_data *, const core_validation::layer_data *, uint32_t,
@@ -256,10 +308,13 @@ bool ValidateUpdateDescriptorSets(const debug_report_data *, const core_validati
 // "Perform" does the update with the assumption that ValidateUpdateDescriptorSets() has passed for the given update
 void PerformUpdateDescriptorSets(const core_validation::layer_data *, uint32_t, const VkWriteDescriptorSet *, uint32_t,
                                  const VkCopyDescriptorSet *);
+// Initial size for the set arena of a descriptor pool with the given create info
+size_t GetPoolArenaSize(const VkDescriptorPoolCreateInfo *);
 // Validate that Allocation state is ok
 bool ValidateAllocateDescriptorSets(const debug_report_data *, const VkDescriptorSetAllocateInfo *,
                                     const core_validation::layer_data *, AllocateDescriptorSetsData *);
 // Update state based on allocating new descriptorsets
+//  Sets from a pool with a set arena are constructed in that arena, and must be destroyed without deleting them
 void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *, const VkDescriptorSet *, const AllocateDescriptorSetsData *,
                                    std::unordered_map<VkDescriptorPool, DESCRIPTOR_POOL_NODE *> *,
                                    std::unordered_map<VkDescriptorSet, cvdescriptorset::DescriptorSet *> *,
@@ -275,8 +330,13 @@ void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *, const Vk
  *   Please refer to the DescriptorSetLayout comment above for a description of
  *   index, binding, and global index.
  *
- * At construction a vector of Descriptor* is created with types corresponding to the
- *   layout. The primary operation performed on the descriptors is to update them
+ * At construction the descriptors are created with types corresponding to the layout.
+ *   They are stored by value, in one array per descriptor class, with the descriptors of
+ *   each binding forming a contiguous run within the array for its class. So a set costs
+ *   a fixed handful of allocations however many descriptors it holds, and validating a
+ *   binding walks consecutive descriptors rather than chasing a pointer to each one.
+ *   Which descriptors have been updated is tracked in a bitset indexed by global index.
+ *   The primary operation performed on the descriptors is to update them
  *   via write or copy updates, and validate that the update contents are correct.
  *   In order to validate update contents, the DescriptorSet stores a bunch of ptrs
  *   to data maps where various Vulkan objects can be looked up. The management of
@@ -286,8 +346,9 @@ void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *, const Vk
 class DescriptorSet : public BASE_NODE {
   public:
     using BASE_NODE::in_use;
-    using BASE_NODE::cb_bindings;
-    DescriptorSet(const VkDescriptorSet, const DescriptorSetLayout *, const core_validation::layer_data *);
+    using BASE_NODE::generation;
+    // Descriptor storage comes from the given arena, or from the heap if it is null
+    DescriptorSet(const VkDescriptorSet, const DescriptorSetLayout *, const core_validation::layer_data *, monotonic_arena *);
     ~DescriptorSet();
     // A number of common Get* functions that return data based on layout from which this set was created
     uint32_t GetTotalDescriptorCount() const { return p_layout_ ? p_layout_->GetTotalDescriptorCount() : 0; };
@@ -316,27 +377,26 @@ class DescriptorSet : public BASE_NODE {
     bool ValidateDrawState(const std::unordered_set<uint32_t> &, const std::vector<uint32_t> &, std::string *) const;
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
-    uint32_t GetStorageUpdates(const std::unordered_set<uint32_t> &, std::unordered_set<VkBuffer> *,
-                               std::unordered_set<VkImageView> *) const;
+    uint32_t GetStorageUpdates(const std::unordered_set<uint32_t> &, cb_unordered_set<VkBuffer> *,
+                               cb_unordered_set<VkImageView> *) const;
 
     // Descriptor Update functions. These functions validate state and perform update separately
     // Validate contents of a WriteUpdate
-    bool ValidateWriteUpdate(const debug_report_data *, const VkWriteDescriptorSet *, std::string *);
+    bool ValidateWriteUpdate(const debug_report_data *, const VkWriteDescriptorSet *, UpdateValidationCache *, std::string *);
     // Perform a WriteUpdate whose contents were just validated using ValidateWriteUpdate
+    //  The caller must then call InvalidateBoundCmdBuffers(), which it can do once for a batch of updates to this set
     void PerformWriteUpdate(const VkWriteDescriptorSet *);
     // Validate contents of a CopyUpdate
-    bool ValidateCopyUpdate(const debug_report_data *, const VkCopyDescriptorSet *, const DescriptorSet *, std::string *);
+    bool ValidateCopyUpdate(const debug_report_data *, const VkCopyDescriptorSet *, const DescriptorSet *, UpdateValidationCache *,
+                            std::string *);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
+    //  As with PerformWriteUpdate(), the caller must then call InvalidateBoundCmdBuffers()
     void PerformCopyUpdate(const VkCopyDescriptorSet *, const DescriptorSet *);
+    // Set all bound cmd buffers to INVALID state
+    void InvalidateBoundCmdBuffers();
 
     const DescriptorSetLayout *GetLayout() const { return p_layout_; };
     VkDescriptorSet GetSet() const { return set_; };
-    // Return unordered_set of all command buffers that this set is bound to
-    std::unordered_set<GLOBAL_CB_NODE *> GetBoundCmdBuffers() const { return cb_bindings; }
-    // Bind given cmd_buffer to this descriptor set
-    void BindCommandBuffer(GLOBAL_CB_NODE *cb_node) { cb_bindings.insert(cb_node); }
-    // If given cmd_buffer is in the cb_bindings set, remove it
-    void RemoveBoundCommandBuffer(GLOBAL_CB_NODE *cb_node) { cb_bindings.erase(cb_node); }
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t index) const {
         return p_layout_->GetImmutableSamplerPtrFromBinding(index);
     };
@@ -349,21 +409,38 @@ class DescriptorSet : public BASE_NODE {
     };
     // Return true if any part of set has ever been updated
     bool IsUpdated() const { return some_update_; };
+    // The generation the set was created with. Unlike generation, updates don't move it on, so it only tells this set apart
+    //  from another one that later gets the same handle or address.
+    uint64_t GetAllocationId() const { return allocation_id_; };
 
   private:
-    bool VerifyWriteUpdateContents(const VkWriteDescriptorSet *, const uint32_t, std::string *) const;
+    // Descriptor at the given global index
+    Descriptor *GetDescriptorFromGlobalIndex(const uint32_t);
+    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t) const;
+    bool VerifyWriteUpdateContents(const VkWriteDescriptorSet *, const uint32_t, UpdateValidationCache *, std::string *) const;
     bool VerifyCopyUpdateContents(const VkCopyDescriptorSet *, const DescriptorSet *, VkDescriptorType, uint32_t,
-                                  std::string *) const;
+                                  UpdateValidationCache *, std::string *) const;
+    // Validate a sampler or image view for an update, skipping any already validated in this call
+    bool ValidateSamplerUse(VkSampler, UpdateValidationCache *) const;
+    bool ValidateImageUse(VkImageView, VkImageLayout, VkDescriptorType, UpdateValidationCache *, std::string *) const;
     bool ValidateBufferUsage(BUFFER_NODE const *, VkDescriptorType, std::string *) const;
-    bool ValidateBufferUpdate(VkDescriptorBufferInfo const *, VkDescriptorType, std::string *) const;
-    // Private helper to set all bound cmd buffers to INVALID state
-    void InvalidateBoundCmdBuffers();
+    bool ValidateBufferUpdate(VkDescriptorBufferInfo const *, VkDescriptorType, UpdateValidationCache *, std::string *) const;
     bool some_update_; // has any part of the set ever been updated?
     VkDescriptorSet set_;
     const DescriptorSetLayout *p_layout_;
-    std::vector<std::unique_ptr<Descriptor>> descriptors_;
+    // Descriptor storage, one array per DescriptorClass
+    pool_vector<SamplerDescriptor> samplers_;
+    pool_vector<ImageSamplerDescriptor> image_samplers_;
+    pool_vector<ImageDescriptor> images_;
+    pool_vector<TexelDescriptor> texel_buffers_;
+    pool_vector<BufferDescriptor> buffers_;
+    // For each index, offset of that binding's first descriptor within the array for its class
+    pool_vector<uint32_t> binding_offsets_;
+    // For each global index, has the descriptor been updated?
+    pool_vector<bool> updated_;
     // Ptr to device data used for various data look-ups
     const core_validation::layer_data *device_data_;
+    const uint64_t allocation_id_;
 };
 }
 #endif // CORE_VALIDATION_DESCRIPTOR_SETS_H_
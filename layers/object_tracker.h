@@ -24,6 +24,8 @@
 
 #include "vk_enum_string_helper.h"
 #include "vk_layer_extension_utils.h"
+#include "vk_layer_handle_table.h"
+#include "vk_layer_rwlock.h"
 #include "vk_layer_table.h"
 #include "vk_layer_utils.h"
 #include "vulkan/vk_layer.h"
@@ -137,10 +139,10 @@ struct layer_data {
 
     std::vector<VkQueueFamilyProperties> queue_family_properties;
 
-    // Array of unordered_maps per object type to hold OBJTRACK_NODE info
-    std::unordered_map<uint64_t, OBJTRACK_NODE *> object_map[VK_DEBUG_REPORT_OBJECT_TYPE_RANGE_SIZE_EXT + 1];
+    // Array of handle tables per object type to hold OBJTRACK_NODE info
+    handle_table<OBJTRACK_NODE> object_map[VK_DEBUG_REPORT_OBJECT_TYPE_RANGE_SIZE_EXT + 1];
     // Special-case map for swapchain images
-    std::unordered_map<uint64_t, OBJTRACK_NODE *> swapchainImageMap;
+    handle_table<OBJTRACK_NODE> swapchainImageMap;
     // Map of queue information structures, one per queue
     std::unordered_map<VkQueue, OT_QUEUE_INFO *> queue_info_map;
     // Preinitialized array of name strings for object types
@@ -156,10 +158,12 @@ struct layer_data {
 
 
 static std::unordered_map<void *, struct instance_extension_enables> instanceExtMap;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static layer_data_table<layer_data> layer_data_map;
 static device_table_map ot_device_table_map;
 static instance_table_map ot_instance_table_map;
-static std::mutex global_lock;
+// Taken shared by calls that only validate handles and exclusively by calls that create or
+// destroy objects
+static rw_lock global_lock;
 static uint64_t object_track_index = 0;
 
 // Array of object name strings for OBJECT_TYPE enum conversion
@@ -36,6 +36,8 @@
 #include "vk_struct_string_helper_cpp.h"
 #include "vk_layer_data.h"
 #include "vk_layer_utils.h"
+#include "vk_layer_proc_table.h"
+#include "vk_entrypoint_hash.h"
 
 #include "thread_check.h"
 
@@ -101,8 +103,6 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     pTable->DestroyInstance(instance, pAllocator);
     if (threadChecks) {
         finishWriteObject(my_data, instance);
-    } else {
-        finishMultiThread();
     }
 
     // Disable and cleanup the temporary callback(s):
@@ -114,6 +114,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         my_data->num_tmp_callbacks = 0;
     }
 
+    // Deliver queued messages before the callbacks that would receive them are removed
+    layer_debug_report_disable_async(my_data->report_data);
+
     // Clean up logging callback, if any
     while (my_data->logging_callback.size() > 0) {
         VkDebugReportCallbackEXT callback = my_data->logging_callback.back();
@@ -167,8 +170,6 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->device_dispatch_table->DestroyDevice(device, pAllocator);
     if (threadChecks) {
         finishWriteObject(dev_data, device);
-    } else {
-        finishMultiThread();
     }
     layer_data_map.erase(key);
 }
@@ -182,13 +183,7 @@ static const VkLayerProperties layerProps = {
     1, "Google Validation Layer",
 };
 
-static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name))
-            return procmap[i].pFunc;
-    }
-    return NULL;
-}
+static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) { return procmap.find(name); }
 
 VKAPI_ATTR VkResult VKAPI_CALL
 EnumerateInstanceLayerProperties(uint32_t *pCount, VkLayerProperties *pProperties) {
@@ -223,26 +218,24 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevi
 }
 
 static inline PFN_vkVoidFunction layer_intercept_instance_proc(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k')
-        return NULL;
-
-    name += 2;
-    if (!strcmp(name, "CreateInstance"))
+    switch (vk_get_entrypoint_id(name)) {
+    case VK_ENTRYPOINT_CreateInstance:
         return (PFN_vkVoidFunction)CreateInstance;
-    if (!strcmp(name, "DestroyInstance"))
+    case VK_ENTRYPOINT_DestroyInstance:
         return (PFN_vkVoidFunction)DestroyInstance;
-    if (!strcmp(name, "EnumerateInstanceLayerProperties"))
+    case VK_ENTRYPOINT_EnumerateInstanceLayerProperties:
         return (PFN_vkVoidFunction)EnumerateInstanceLayerProperties;
-    if (!strcmp(name, "EnumerateInstanceExtensionProperties"))
+    case VK_ENTRYPOINT_EnumerateInstanceExtensionProperties:
         return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceLayerProperties:
         return (PFN_vkVoidFunction)EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "EnumerateDeviceExtensionProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceExtensionProperties:
         return (PFN_vkVoidFunction)EnumerateDeviceExtensionProperties;
-    if (!strcmp(name, "CreateDevice"))
+    case VK_ENTRYPOINT_CreateDevice:
         return (PFN_vkVoidFunction)CreateDevice;
-    if (!strcmp(name, "GetInstanceProcAddr"))
+    case VK_ENTRYPOINT_GetInstanceProcAddr:
         return (PFN_vkVoidFunction)GetInstanceProcAddr;
+    }
 
     return NULL;
 }
@@ -306,8 +299,6 @@ CreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCre
     }
     if (threadChecks) {
         finishReadObject(my_data, instance);
-    } else {
-        finishMultiThread();
     }
     return result;
 }
@@ -325,8 +316,6 @@ DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT call
     if (threadChecks) {
         finishReadObject(my_data, instance);
         finishWriteObject(my_data, callback);
-    } else {
-        finishMultiThread();
     }
 }
 
@@ -346,14 +335,13 @@ AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllo
     if (threadChecks) {
         finishReadObject(my_data, device);
         finishWriteObject(my_data, pAllocateInfo->commandPool);
-    } else {
-        finishMultiThread();
     }
 
-    // Record mapping from command buffer to command pool
+    // Record mapping from command buffer to command pool. This is done even while the single-thread bypass is on:
+    //  command buffers allocated before a second thread shows up still need their pool once tracking starts.
     if (VK_SUCCESS == result) {
+        std::lock_guard<std::mutex> lock(command_pool_lock);
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
-            std::lock_guard<std::mutex> lock(command_pool_lock);
             command_pool_map[pCommandBuffers[index]] = pAllocateInfo->commandPool;
         }
     }
@@ -374,21 +362,21 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
         for (uint32_t index = 0; index < commandBufferCount; index++) {
             startWriteObject(my_data, pCommandBuffers[index], lockCommandPool);
         }
-        // The driver may immediately reuse command buffers in another thread.
-        // These updates need to be done before calling down to the driver.
-        for (uint32_t index = 0; index < commandBufferCount; index++) {
+    }
+    // The driver may immediately reuse command buffers in another thread.
+    // These updates need to be done before calling down to the driver.
+    for (uint32_t index = 0; index < commandBufferCount; index++) {
+        if (threadChecks) {
             finishWriteObject(my_data, pCommandBuffers[index], lockCommandPool);
-            std::lock_guard<std::mutex> lock(command_pool_lock);
-            command_pool_map.erase(pCommandBuffers[index]);
         }
+        std::lock_guard<std::mutex> lock(command_pool_lock);
+        command_pool_map.erase(pCommandBuffers[index]);
     }
 
     pTable->FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     if (threadChecks) {
         finishReadObject(my_data, device);
         finishWriteObject(my_data, commandPool);
-    } else {
-        finishMultiThread();
     }
 }
 
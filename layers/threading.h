@@ -20,10 +20,12 @@
 
 #ifndef THREADING_H
 #define THREADING_H
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <vector>
 #include "vk_layer_config.h"
+#include "vk_layer_handle_table.h"
 #include "vk_layer_logging.h"
 
 #if defined(__LP64__) || defined(_WIN64) || defined(__x86_64__) || defined(_M_X64) || defined(__ia64) || defined(_M_IA64) ||       \
@@ -49,44 +51,65 @@ struct object_use_data {
 struct layer_data;
 
 namespace threading {
-volatile bool vulkan_in_use = false;
-volatile bool vulkan_multi_threaded = false;
-// starting check if an application is using vulkan from multiple threads.
+// Tracking is off while every Vulkan call through the layer has come from one thread. The first
+// call from a second thread turns it on for good; uses that were in progress at that moment were
+// never recorded, so at worst the first collision goes unreported.
+std::atomic<bool> vulkan_multi_threaded(false);
+std::atomic<bool> vulkan_first_thread_set(false);
+loader_platform_thread_id vulkan_first_thread;
+std::mutex vulkan_first_thread_lock;
+
+inline bool startMultiThreadSlow(loader_platform_thread_id tid) {
+    std::lock_guard<std::mutex> lock(vulkan_first_thread_lock);
+    if (!vulkan_first_thread_set.load(std::memory_order_relaxed)) {
+        vulkan_first_thread = tid;
+        vulkan_first_thread_set.store(true, std::memory_order_release);
+        return false;
+    }
+    if (vulkan_first_thread == tid) {
+        return false;
+    }
+    vulkan_multi_threaded.store(true);
+    return true;
+}
+
+// Returns whether the calling command must track its object uses, i.e. whether a second thread
+// has made Vulkan calls. Apart from the first call, a single-threaded application only pays for
+// two atomic loads and a thread id compare.
 inline bool startMultiThread() {
-    if (vulkan_multi_threaded) {
+    if (vulkan_multi_threaded.load(std::memory_order_relaxed)) {
         return true;
     }
-    if (vulkan_in_use) {
-        vulkan_multi_threaded = true;
-        return true;
+    loader_platform_thread_id tid = loader_platform_get_thread_id();
+    if (vulkan_first_thread_set.load(std::memory_order_acquire) && vulkan_first_thread == tid) {
+        return false;
     }
-    vulkan_in_use = true;
-    return false;
+    return startMultiThreadSlow(tid);
 }
-
-// finishing check if an application is using vulkan from multiple threads.
-inline void finishMultiThread() { vulkan_in_use = false; }
 } // namespace threading
 
+// Tracks which threads are using objects of one type. Uses are recorded in a number of stripes,
+// each with its own lock and its own table, picked by hashing the handle. Calls on different
+// objects therefore rarely meet on a lock, and a thread waiting for an object is only woken by
+// finishRead/finishWrite calls in its stripe. The tables are open addressed, so recording and
+// dropping a use does not allocate once they have grown to the number of objects in use at once.
 template <typename T> class counter {
   public:
     const char *typeName;
     VkDebugReportObjectTypeEXT objectType;
-    std::unordered_map<T, object_use_data> uses;
-    std::mutex counter_lock;
-    std::condition_variable counter_condition;
     void startWrite(debug_report_data *report_data, T object) {
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        stripe &s = stripe_of(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        struct object_use_data *use_data = s.uses.find(handle_of(object));
+        if (use_data == nullptr) {
             // There is no current use of the object.  Record writer thread.
-            struct object_use_data *use_data = &uses[object];
+            use_data = &s.uses[handle_of(object)];
             use_data->reader_count = 0;
             use_data->writer_count = 1;
             use_data->thread = tid;
         } else {
-            struct object_use_data *use_data = &uses[object];
             if (use_data->reader_count == 0) {
                 // There are no readers.  Two writers just collided.
                 if (use_data->thread != tid) {
@@ -96,11 +119,11 @@ template <typename T> class counter {
                                         typeName, use_data->thread, tid);
                     if (skipCall) {
                         // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
+                        while (s.uses.contains(handle_of(object))) {
+                            s.condition.wait(lock);
                         }
                         // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *use_data = &uses[object];
+                        use_data = &s.uses[handle_of(object)];
                         use_data->thread = tid;
                         use_data->reader_count = 0;
                         use_data->writer_count = 1;
@@ -123,11 +146,11 @@ template <typename T> class counter {
                                         typeName, use_data->thread, tid);
                     if (skipCall) {
                         // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
+                        while (s.uses.contains(handle_of(object))) {
+                            s.condition.wait(lock);
                         }
                         // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *use_data = &uses[object];
+                        use_data = &s.uses[handle_of(object)];
                         use_data->thread = tid;
                         use_data->reader_count = 0;
                         use_data->writer_count = 1;
@@ -147,64 +170,84 @@ template <typename T> class counter {
 
     void finishWrite(T object) {
         // Object is no longer in use
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].writer_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
+        stripe &s = stripe_of(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        struct object_use_data *use_data = &s.uses[handle_of(object)];
+        use_data->writer_count -= 1;
+        if ((use_data->reader_count == 0) && (use_data->writer_count == 0)) {
+            s.uses.erase(handle_of(object));
         }
         // Notify any waiting threads that this object may be safe to use
         lock.unlock();
-        counter_condition.notify_all();
+        s.condition.notify_all();
     }
 
     void startRead(debug_report_data *report_data, T object) {
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        stripe &s = stripe_of(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        struct object_use_data *use_data = s.uses.find(handle_of(object));
+        if (use_data == nullptr) {
             // There is no current use of the object.  Record reader count
-            struct object_use_data *use_data = &uses[object];
+            use_data = &s.uses[handle_of(object)];
             use_data->reader_count = 1;
             use_data->writer_count = 0;
             use_data->thread = tid;
-        } else if (uses[object].writer_count > 0 && uses[object].thread != tid) {
+        } else if (use_data->writer_count > 0 && use_data->thread != tid) {
             // There is a writer of the object.
             skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
                                 /*location*/ 0, THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
                                 "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld", typeName,
-                                uses[object].thread, tid);
+                                use_data->thread, tid);
             if (skipCall) {
                 // Wait for thread-safe access to object instead of skipping call.
-                while (uses.find(object) != uses.end()) {
-                    counter_condition.wait(lock);
+                while (s.uses.contains(handle_of(object))) {
+                    s.condition.wait(lock);
                 }
                 // There is no current use of the object.  Record reader count
-                struct object_use_data *use_data = &uses[object];
+                use_data = &s.uses[handle_of(object)];
                 use_data->reader_count = 1;
                 use_data->writer_count = 0;
                 use_data->thread = tid;
             } else {
-                uses[object].reader_count += 1;
+                use_data->reader_count += 1;
             }
         } else {
             // There are other readers of the object.  Increase reader count
-            uses[object].reader_count += 1;
+            use_data->reader_count += 1;
         }
     }
     void finishRead(T object) {
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].reader_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
+        stripe &s = stripe_of(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        struct object_use_data *use_data = &s.uses[handle_of(object)];
+        use_data->reader_count -= 1;
+        if ((use_data->reader_count == 0) && (use_data->writer_count == 0)) {
+            s.uses.erase(handle_of(object));
         }
         // Notify any waiting threads that this object may be safe to use
         lock.unlock();
-        counter_condition.notify_all();
+        s.condition.notify_all();
     }
     counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT) {
         typeName = name;
         objectType = type;
     }
+
+  private:
+    static const unsigned stripe_bits = 4;
+
+    struct stripe {
+        std::mutex lock;
+        std::condition_variable condition;
+        handle_table<object_use_data> uses;
+    };
+    stripe stripes[1 << stripe_bits];
+
+    static uint64_t handle_of(T object) { return (uint64_t)(object); }
+    // Fibonacci hashing: the top bits of the product depend on every bit of the handle
+    stripe &stripe_of(T object) { return stripes[(handle_of(object) * 0x9E3779B97F4A7C15ull) >> (64 - stripe_bits)]; }
 };
 
 struct layer_data {
@@ -320,7 +363,7 @@ WRAPPER(VkDebugReportCallbackEXT)
 WRAPPER(uint64_t)
 #endif // DISTINCT_NONDISPATCHABLE_HANDLES
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static layer_data_table<layer_data> layer_data_map;
 static std::mutex command_pool_lock;
 static std::unordered_map<VkCommandBuffer, VkCommandPool> command_pool_map;
 
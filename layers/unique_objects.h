@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 #include <mutex>
@@ -42,17 +43,111 @@
 
 namespace unique_objects {
 
-// All increments must be guarded by global_lock
-static uint64_t global_unique_id = 1;
+// Map from unique ID to actual object handle. The low 32 bits of a unique ID are a dense index into
+// an array that is allocated in fixed-size chunks and never moves, so translating an ID is a bounds
+// check and a few loads, with no hashing and no lock. Only insert() and erase() lock. The high 32
+// bits count how often the index has been handed out: indices of erased objects are reused, but
+// never with the same count, so a handle the application kept after destroying its object
+// translates to 0 instead of to whatever reused the index. Index 0 is never used, so
+// VK_NULL_HANDLE translates to VK_NULL_HANDLE.
+class unique_id_table {
+  public:
+    unique_id_table() : next_index_(1) {
+        for (size_t i = 0; i < max_chunks; i++)
+            chunks_[i].store(nullptr, std::memory_order_relaxed);
+    }
+    ~unique_id_table() {
+        for (size_t i = 0; i < max_chunks; i++)
+            delete[] chunks_[i].load(std::memory_order_relaxed);
+    }
+    unique_id_table(const unique_id_table &) = delete;
+    unique_id_table &operator=(const unique_id_table &) = delete;
+
+    // Returns the handle for id, or 0 if id is unknown
+    uint64_t operator[](uint64_t id) const {
+        const uint64_t index = id & index_mask;
+        if ((index >> chunk_bits) >= max_chunks)
+            return 0;
+        const entry *chunk = chunks_[index >> chunk_bits].load(std::memory_order_acquire);
+        if (!chunk)
+            return 0;
+        const entry &e = chunk[index & chunk_mask];
+        return e.id == id ? e.handle : 0;
+    }
+
+    // Returns a new unique ID for handle, or 0 if the table is full
+    uint64_t insert(uint64_t handle) {
+        std::lock_guard<std::mutex> lock(lock_);
+        uint64_t index;
+        uint64_t generation = 0;
+        if (!free_indices_.empty()) {
+            index = free_indices_.back();
+            free_indices_.pop_back();
+            generation = (chunks_[index >> chunk_bits].load(std::memory_order_relaxed)[index & chunk_mask].id >> index_bits) + 1;
+        } else {
+            if ((next_index_ >> chunk_bits) >= max_chunks)
+                return 0;
+            index = next_index_++;
+            if (!chunks_[index >> chunk_bits].load(std::memory_order_relaxed))
+                chunks_[index >> chunk_bits].store(new entry[chunk_size](), std::memory_order_release);
+        }
+        entry &e = chunks_[index >> chunk_bits].load(std::memory_order_relaxed)[index & chunk_mask];
+        e.handle = handle;
+        e.id = (generation << index_bits) | index;
+        return e.id;
+    }
+
+    // Forgets id and returns the handle it was mapped to, or 0 if id is unknown
+    uint64_t erase(uint64_t id) {
+        std::lock_guard<std::mutex> lock(lock_);
+        const uint64_t index = id & index_mask;
+        if (index == 0 || index >= next_index_)
+            return 0;
+        entry &e = chunks_[index >> chunk_bits].load(std::memory_order_relaxed)[index & chunk_mask];
+        if (e.id != id || !e.handle)
+            return 0;
+        uint64_t handle = e.handle;
+        e.handle = 0;
+        // Once its count is used up an index is retired rather than wrapped around to an old ID
+        if ((id >> index_bits) != max_generation)
+            free_indices_.push_back(index);
+        return handle;
+    }
+
+  private:
+    struct entry {
+        uint64_t id;
+        uint64_t handle;
+    };
+
+    static const unsigned index_bits = 32;
+    static const uint64_t index_mask = (uint64_t(1) << index_bits) - 1;
+    static const uint64_t max_generation = (uint64_t(1) << (64 - index_bits)) - 1;
+    static const unsigned chunk_bits = 12;
+    static const size_t chunk_size = size_t(1) << chunk_bits;
+    static const uint64_t chunk_mask = chunk_size - 1;
+    static const size_t max_chunks = size_t(1) << 14;
+
+    std::atomic<entry *> chunks_[max_chunks];
+    std::mutex lock_;
+    uint64_t next_index_;
+    std::vector<uint64_t> free_indices_;
+};
+
+// Unique IDs are shared by all instances and devices, so that an ID names one object process-wide
+static unique_id_table &unique_ids() {
+    static unique_id_table table;
+    return table;
+}
 
 struct layer_data {
     VkInstance instance;
 
     bool wsi_enabled;
-    std::unordered_map<uint64_t, uint64_t> unique_id_mapping; // Map uniqueID to actual object handle
+    unique_id_table &unique_id_mapping; // Map uniqueID to actual object handle
     VkPhysicalDevice gpu;
 
-    layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE){};
+    layer_data() : wsi_enabled(false), unique_id_mapping(unique_ids()), gpu(VK_NULL_HANDLE){};
 };
 
 struct instance_extension_enables {
@@ -67,10 +162,9 @@ struct instance_extension_enables {
 };
 
 static std::unordered_map<void *, struct instance_extension_enables> instanceExtMap;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static layer_data_table<layer_data> layer_data_map;
 static device_table_map unique_objects_device_table_map;
 static instance_table_map unique_objects_instance_table_map;
-static std::mutex global_lock; // Protect map accesses and unique_id increments
 
 struct GenericHeader {
     VkStructureType sType;
@@ -247,21 +341,16 @@ VkResult explicit_AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pA
                 safe_dedicated_allocate_info->initialize(
                     reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV *>(orig_pnext));
 
-                std::unique_lock<std::mutex> lock(global_lock);
-
                 if (safe_dedicated_allocate_info->buffer != VK_NULL_HANDLE) {
                     uint64_t local_buffer = reinterpret_cast<uint64_t &>(safe_dedicated_allocate_info->buffer);
-                    safe_dedicated_allocate_info->buffer =
-                        reinterpret_cast<VkBuffer &>(my_map_data->unique_id_mapping[local_buffer]);
+                    safe_dedicated_allocate_info->buffer = (VkBuffer)my_map_data->unique_id_mapping[local_buffer];
                 }
 
                 if (safe_dedicated_allocate_info->image != VK_NULL_HANDLE) {
                     uint64_t local_image = reinterpret_cast<uint64_t &>(safe_dedicated_allocate_info->image);
-                    safe_dedicated_allocate_info->image = reinterpret_cast<VkImage &>(my_map_data->unique_id_mapping[local_image]);
+                    safe_dedicated_allocate_info->image = (VkImage)my_map_data->unique_id_mapping[local_image];
                 }
 
-                lock.unlock();
-
                 input_pnext->pNext = reinterpret_cast<GenericHeader *>(safe_dedicated_allocate_info.get());
                 input_pnext = reinterpret_cast<GenericHeader *>(input_pnext->pNext);
             } else {
@@ -276,9 +365,7 @@ VkResult explicit_AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pA
                           ->AllocateMemory(device, input_allocate_info, pAllocator, pMemory);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        uint64_t unique_id = global_unique_id++;
-        my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*pMemory);
+        uint64_t unique_id = my_map_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(*pMemory));
         *pMemory = reinterpret_cast<VkDeviceMemory &>(unique_id);
     }
 
@@ -294,7 +381,6 @@ VkResult explicit_CreateComputePipelines(VkDevice device, VkPipelineCache pipeli
     layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     safe_VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
-        std::lock_guard<std::mutex> lock(global_lock);
         local_pCreateInfos = new safe_VkComputePipelineCreateInfo[createInfoCount];
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
@@ -316,7 +402,6 @@ VkResult explicit_CreateComputePipelines(VkDevice device, VkPipelineCache pipeli
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(global_lock);
         pipelineCache = (VkPipelineCache)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(pipelineCache)];
     }
 
@@ -326,10 +411,8 @@ VkResult explicit_CreateComputePipelines(VkDevice device, VkPipelineCache pipeli
     delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
         uint64_t unique_id = 0;
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t i = 0; i < createInfoCount; ++i) {
-            unique_id = global_unique_id++;
-            my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pPipelines[i]);
+            unique_id = my_device_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(pPipelines[i]));
             pPipelines[i] = reinterpret_cast<VkPipeline &>(unique_id);
         }
     }
@@ -346,7 +429,6 @@ VkResult explicit_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipel
     safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
         local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
             if (pCreateInfos[idx0].basePipelineHandle) {
@@ -376,7 +458,6 @@ VkResult explicit_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipel
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(global_lock);
         pipelineCache = (VkPipelineCache)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(pipelineCache)];
     }
 
@@ -387,10 +468,8 @@ VkResult explicit_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipel
     delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
         uint64_t unique_id = 0;
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t i = 0; i < createInfoCount; ++i) {
-            unique_id = global_unique_id++;
-            my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pPipelines[i]);
+            unique_id = my_device_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(pPipelines[i]));
             pPipelines[i] = reinterpret_cast<VkPipeline &>(unique_id);
         }
     }
@@ -403,7 +482,6 @@ VkResult explicit_CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInf
 
     safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
     if (pCreateInfo) {
-        std::lock_guard<std::mutex> lock(global_lock);
         local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
         local_pCreateInfo->oldSwapchain =
             (VkSwapchainKHR)my_map_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->oldSwapchain)];
@@ -418,9 +496,7 @@ VkResult explicit_CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInf
     if (local_pCreateInfo)
         delete local_pCreateInfo;
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        uint64_t unique_id =global_unique_id++;
-        my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*pSwapchain);
+        uint64_t unique_id = my_map_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(*pSwapchain));
         *pSwapchain = reinterpret_cast<VkSwapchainKHR &>(unique_id);
     }
     return result;
@@ -432,7 +508,6 @@ VkResult explicit_GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchai
     //  0 : swapchain,VkSwapchainKHR, pSwapchainImages,VkImage
     layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     if (VK_NULL_HANDLE != swapchain) {
-        std::lock_guard<std::mutex> lock(global_lock);
         swapchain = (VkSwapchainKHR)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(swapchain)];
     }
     VkResult result = get_dispatch_table(unique_objects_device_table_map, device)
@@ -441,10 +516,8 @@ VkResult explicit_GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchai
     if (VK_SUCCESS == result) {
         if ((*pSwapchainImageCount > 0) && pSwapchainImages) {
             uint64_t unique_id = 0;
-            std::lock_guard<std::mutex> lock(global_lock);
             for (uint32_t i = 0; i < *pSwapchainImageCount; ++i) {
-                unique_id = global_unique_id++;
-                my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pSwapchainImages[i]);
+                unique_id = my_device_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(pSwapchainImages[i]));
                 pSwapchainImages[i] = reinterpret_cast<VkImage &>(unique_id);
             }
         }
@@ -458,7 +531,6 @@ VkResult explicit_GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physica
     layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(physicalDevice), layer_data_map);
     safe_VkDisplayPropertiesKHR* local_pProperties = NULL;
     {
-        std::lock_guard<std::mutex> lock(global_lock);
         if (pProperties) {
             local_pProperties = new safe_VkDisplayPropertiesKHR[*pPropertyCount];
             for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
@@ -474,10 +546,7 @@ VkResult explicit_GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physica
     if (result == VK_SUCCESS && pProperties)
     {
         for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
-            std::lock_guard<std::mutex> lock(global_lock);
-
-            uint64_t unique_id = global_unique_id++;
-            my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(local_pProperties[idx0].display);
+            uint64_t unique_id = my_map_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(local_pProperties[idx0].display));
             pProperties[idx0].display = reinterpret_cast<VkDisplayKHR&>(unique_id);
             pProperties[idx0].displayName = local_pProperties[idx0].displayName;
             pProperties[idx0].physicalDimensions = local_pProperties[idx0].physicalDimensions;
@@ -498,11 +567,10 @@ VkResult explicit_GetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalD
     VkResult result = get_dispatch_table(unique_objects_instance_table_map, physicalDevice)->GetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     if (VK_SUCCESS == result) {
         if ((*pDisplayCount > 0) && pDisplays) {
-            std::lock_guard<std::mutex> lock(global_lock);
             for (uint32_t i = 0; i < *pDisplayCount; i++) {
-		    auto it = my_map_data->unique_id_mapping.find(reinterpret_cast<const uint64_t &> (pDisplays[i]));
-                assert (it !=  my_map_data->unique_id_mapping.end());
-                pDisplays[i] = reinterpret_cast<VkDisplayKHR&> (it->second);
+                uint64_t handle = my_map_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pDisplays[i])];
+                assert(handle != 0);
+                pDisplays[i] = reinterpret_cast<VkDisplayKHR &>(handle);
             }
         }
     }
@@ -515,7 +583,6 @@ VkResult explicit_GetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, V
     layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(physicalDevice), layer_data_map);
     safe_VkDisplayModePropertiesKHR* local_pProperties = NULL;
     {
-        std::lock_guard<std::mutex> lock(global_lock);
         display = (VkDisplayKHR)my_map_data->unique_id_mapping[reinterpret_cast<uint64_t &>(display)];
         if (pProperties) {
             local_pProperties = new safe_VkDisplayModePropertiesKHR[*pPropertyCount];
@@ -529,10 +596,7 @@ VkResult explicit_GetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, V
     if (result == VK_SUCCESS && pProperties)
     {
         for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
-            std::lock_guard<std::mutex> lock(global_lock);
-
-            uint64_t unique_id = global_unique_id++;
-            my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(local_pProperties[idx0].displayMode);
+            uint64_t unique_id = my_map_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(local_pProperties[idx0].displayMode));
             pProperties[idx0].displayMode = reinterpret_cast<VkDisplayModeKHR&>(unique_id);
             pProperties[idx0].parameters.visibleRegion.width = local_pProperties[idx0].parameters.visibleRegion.width;
             pProperties[idx0].parameters.visibleRegion.height = local_pProperties[idx0].parameters.visibleRegion.height;
@@ -0,0 +1,201 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_ARENA_H
+#define VK_LAYER_ARENA_H
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stddef.h>
+#include <vector>
+
+// Small-block arena for state that is torn down and rebuilt at a steady rate, such as the
+// per-command buffer tracking containers that are cleared on every reset and refilled on
+// every recording. Blocks up to max_block_size bytes are carved out of large chunks and
+// recycled through per-size free lists, so once an arena has warmed up, clearing and
+// refilling its containers does not touch the heap. Larger blocks go straight to the heap.
+// Chunks are only returned to the heap when the arena is destroyed.
+class layer_arena {
+  public:
+    layer_arena() : bump_(nullptr), bump_end_(nullptr) {
+        for (size_t i = 0; i < size_class_count; i++) {
+            free_lists_[i] = nullptr;
+        }
+    }
+    layer_arena(const layer_arena &) = delete;
+    layer_arena &operator=(const layer_arena &) = delete;
+
+    void *allocate(size_t bytes) {
+        if (bytes > max_block_size) {
+            return ::operator new(bytes);
+        }
+        size_t size_class = class_of(bytes);
+        std::lock_guard<std::mutex> lock(lock_);
+        free_block *block = free_lists_[size_class];
+        if (block) {
+            free_lists_[size_class] = block->next;
+            return block;
+        }
+        size_t block_size = (size_class + 1) * granularity;
+        if (static_cast<size_t>(bump_end_ - bump_) < block_size) {
+            chunks_.emplace_back(new char[chunk_size]);
+            bump_ = chunks_.back().get();
+            bump_end_ = bump_ + chunk_size;
+        }
+        void *result = bump_;
+        bump_ += block_size;
+        return result;
+    }
+
+    void deallocate(void *p, size_t bytes) {
+        if (bytes > max_block_size) {
+            ::operator delete(p);
+            return;
+        }
+        size_t size_class = class_of(bytes);
+        std::lock_guard<std::mutex> lock(lock_);
+        free_block *block = static_cast<free_block *>(p);
+        block->next = free_lists_[size_class];
+        free_lists_[size_class] = block;
+    }
+
+  private:
+    struct free_block {
+        free_block *next;
+    };
+    static const size_t granularity = 16;
+    static const size_t max_block_size = 512;
+    static const size_t size_class_count = max_block_size / granularity;
+    static const size_t chunk_size = 64 * 1024;
+
+    static size_t class_of(size_t bytes) { return bytes ? (bytes - 1) / granularity : 0; }
+
+    // Guards the free lists. Callers are normally already serialized (e.g. by the external
+    // synchronization Vulkan requires on command pools); this keeps an app that breaks that
+    // rule from corrupting layer state.
+    std::mutex lock_;
+    free_block *free_lists_[size_class_count];
+    char *bump_;
+    char *bump_end_;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
+// Arena for state that is all released together, such as the descriptor sets allocated from one
+// descriptor pool. Blocks are bumped out of chunks and are never freed one at a time: deallocate()
+// does nothing, and reset() releases every block at once. If reset() finds more than one chunk in
+// use, it replaces them with a single chunk as large as all of them, so an owner that allocates
+// about the same amount between resets settles on one chunk and no heap traffic at all.
+// Callers must serialize access.
+class monotonic_arena {
+  public:
+    // The first chunk is initial_size bytes, allocated on first use
+    explicit monotonic_arena(size_t initial_size)
+        : next_chunk_size_(initial_size < min_chunk_size ? min_chunk_size : initial_size), capacity_(0), bump_(nullptr),
+          bump_end_(nullptr) {}
+    monotonic_arena(const monotonic_arena &) = delete;
+    monotonic_arena &operator=(const monotonic_arena &) = delete;
+
+    void *allocate(size_t bytes) {
+        bytes = (bytes + granularity - 1) & ~(granularity - 1);
+        if (static_cast<size_t>(bump_end_ - bump_) < bytes) {
+            add_chunk(bytes);
+        }
+        void *result = bump_;
+        bump_ += bytes;
+        return result;
+    }
+
+    void deallocate(void *, size_t) {}
+
+    void reset() {
+        if (chunks_.size() > 1) {
+            chunks_.clear();
+            chunks_.emplace_back(new char[capacity_]);
+        }
+        bump_ = chunks_.empty() ? nullptr : chunks_.front().get();
+        bump_end_ = chunks_.empty() ? nullptr : bump_ + capacity_;
+    }
+
+  private:
+    static const size_t granularity = 16;
+    static const size_t min_chunk_size = 4 * 1024;
+
+    // Each chunk after the first is at least as large as all before it, so the number of chunks
+    // grows with the log of the amount allocated
+    void add_chunk(size_t bytes) {
+        size_t size = next_chunk_size_ < bytes ? bytes : next_chunk_size_;
+        chunks_.emplace_back(new char[size]);
+        bump_ = chunks_.back().get();
+        bump_end_ = bump_ + size;
+        capacity_ += size;
+        next_chunk_size_ = capacity_;
+    }
+
+    size_t next_chunk_size_;
+    size_t capacity_; // total size of chunks_
+    char *bump_;
+    char *bump_end_;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
+// STL allocator drawing from a layer_arena or monotonic_arena. A default-constructed allocator
+// has no arena and uses the heap, so containers using it can still be created before an arena
+// is known.
+template <typename T, typename ARENA_T = layer_arena> class arena_allocator {
+  public:
+    typedef T value_type;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    template <typename U> struct rebind { typedef arena_allocator<U, ARENA_T> other; };
+
+    arena_allocator() : arena_(nullptr) {}
+    explicit arena_allocator(ARENA_T *arena) : arena_(arena) {}
+    template <typename U> arena_allocator(const arena_allocator<U, ARENA_T> &other) : arena_(other.arena()) {}
+
+    T *allocate(size_t n) {
+        size_t bytes = n * sizeof(T);
+        return static_cast<T *>(arena_ ? arena_->allocate(bytes) : ::operator new(bytes));
+    }
+    void deallocate(T *p, size_t n) {
+        if (arena_) {
+            arena_->deallocate(p, n * sizeof(T));
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    ARENA_T *arena() const { return arena_; }
+
+  private:
+    ARENA_T *arena_;
+};
+
+template <typename T, typename U, typename ARENA_T>
+bool operator==(const arena_allocator<T, ARENA_T> &a, const arena_allocator<U, ARENA_T> &b) {
+    return a.arena() == b.arena();
+}
+template <typename T, typename U, typename ARENA_T>
+bool operator!=(const arena_allocator<T, ARENA_T> &a, const arena_allocator<U, ARENA_T> &b) {
+    return a.arena() != b.arena();
+}
+
+#endif // VK_LAYER_ARENA_H
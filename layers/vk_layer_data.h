@@ -20,23 +20,183 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
-#include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <vector>
 #include "vk_layer_table.h"
 
-template <typename DATA_T> DATA_T *get_my_data_ptr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    DATA_T *debug_data;
-    typename std::unordered_map<void *, DATA_T *>::const_iterator got;
+// Map from dispatch key to a layer's per-instance/per-device data.
+// Every intercepted call looks its data up here, so lookups are lock-free: an open-addressed
+// table probed with atomic loads. Inserts and erases serialize on a mutex. Each slot carries a
+// sequence count that writers bump around a change, so a slot can be reused for another key; a
+// lookup that races with a change returns nullptr and get_my_data_ptr retries under the mutex.
+// Because slots are reused, only growth replaces the table. It grows by doubling once live
+// entries pass a quarter of its capacity, and the old table is retired rather than freed so a
+// concurrent reader never touches freed memory. The retired tables hold fewer slots in total than
+// the current one, which is sized by the most instances/devices ever alive at once.
+template <typename DATA_T> class layer_data_table {
+  public:
+    layer_data_table() : live_(0) {
+        tables_.emplace_back(new table(initial_capacity));
+        current_.store(tables_.back().get(), std::memory_order_release);
+    }
+    layer_data_table(const layer_data_table &) = delete;
+    layer_data_table &operator=(const layer_data_table &) = delete;
+
+    // Return the data for key, or nullptr if key is absent or its slot was changing
+    DATA_T *find(void *key) const {
+        const table *t = current_.load(std::memory_order_acquire);
+        for (size_t i = t->home(key), probes = 0; probes < t->capacity; i = (i + 1) & t->mask, ++probes) {
+            const slot &s = t->slots[i];
+            uint32_t seq = s.seq.load(std::memory_order_acquire);
+            void *slot_key = s.key.load(std::memory_order_relaxed);
+            DATA_T *data = s.data.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if ((seq & 1) || s.seq.load(std::memory_order_relaxed) != seq)
+                return nullptr;
+            if (slot_key == key)
+                return data;
+            if (!slot_key)
+                break;
+        }
+        return nullptr;
+    }
+
+    // Return the data for key, creating it with new DATA_T if this is the first lookup
+    DATA_T *find_or_create(void *key) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        table *t = current_.load(std::memory_order_relaxed);
+        size_t free_slot;
+        size_t i = t->find_slot(key, &free_slot);
+        DATA_T *data = (i != t->capacity) ? t->slots[i].data.load(std::memory_order_relaxed) : nullptr;
+        if (!data) {
+            data = new DATA_T;
+            insert_locked(t, i, free_slot, key, data);
+        }
+        return data;
+    }
+
+    // Drop key from the table. The caller still owns (and deletes) the data.
+    void erase(void *key) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        table *t = current_.load(std::memory_order_relaxed);
+        size_t free_slot;
+        size_t i = t->find_slot(key, &free_slot);
+        if (i != t->capacity && t->slots[i].data.load(std::memory_order_relaxed)) {
+            // The key stays behind as a tombstone so probe chains through it are preserved
+            t->write(i, key, nullptr);
+            live_--;
+            // A run of tombstones that ends at an empty slot is on no other key's probe chain
+            while (!t->slots[(i + 1) & t->mask].key.load(std::memory_order_relaxed) &&
+                   !t->slots[i].data.load(std::memory_order_relaxed) && t->slots[i].key.load(std::memory_order_relaxed)) {
+                t->write(i, nullptr, nullptr);
+                i = (i - 1) & t->mask;
+            }
+        }
+    }
 
-    /* TODO: We probably should lock here, or have caller lock */
-    got = layer_data_map.find(data_key);
+  private:
+    static const size_t initial_capacity = 16;
 
-    if (got == layer_data_map.end()) {
-        debug_data = new DATA_T;
-        layer_data_map[(void *)data_key] = debug_data;
-    } else {
-        debug_data = got->second;
+    struct slot {
+        std::atomic<uint32_t> seq; // odd while a writer is changing the slot
+        std::atomic<void *> key;
+        std::atomic<DATA_T *> data;
+    };
+
+    struct table {
+        explicit table(size_t cap) : capacity(cap), mask(cap - 1), slots(new slot[cap]) {
+            for (size_t i = 0; i < capacity; i++) {
+                slots[i].seq.store(0, std::memory_order_relaxed);
+                slots[i].key.store(nullptr, std::memory_order_relaxed);
+                slots[i].data.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        // Dispatch keys are pointers to loader dispatch tables, so the low bits carry no information
+        size_t home(void *key) const {
+            return static_cast<size_t>((reinterpret_cast<uintptr_t>(key) * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & mask;
+        }
+        // Slot holding key, or capacity if key is not present. free_slot is set to the first tombstone
+        //  or empty slot on key's probe chain; while live entries fill at most half the table there is one.
+        size_t find_slot(void *key, size_t *free_slot) const {
+            *free_slot = capacity;
+            for (size_t i = home(key), probes = 0; probes < capacity; i = (i + 1) & mask, ++probes) {
+                void *slot_key = slots[i].key.load(std::memory_order_relaxed);
+                if (slot_key == key)
+                    return i;
+                if (*free_slot == capacity && !slots[i].data.load(std::memory_order_relaxed))
+                    *free_slot = i;
+                if (!slot_key)
+                    break;
+            }
+            return capacity;
+        }
+        // Change slot i with the write lock held. Publishes the data before the key, and both
+        //  before the sequence count readers check them against.
+        void write(size_t i, void *key, DATA_T *data) {
+            uint32_t seq = slots[i].seq.load(std::memory_order_relaxed);
+            slots[i].seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slots[i].data.store(data, std::memory_order_relaxed);
+            slots[i].key.store(key, std::memory_order_relaxed);
+            slots[i].seq.store(seq + 2, std::memory_order_release);
+        }
+
+        const size_t capacity;
+        const size_t mask;
+        std::unique_ptr<slot[]> slots;
+    };
+
+    // Store data for key, given find_slot's results for it in the current table t
+    void insert_locked(table *t, size_t i, size_t free_slot, void *key, DATA_T *data) {
+        if (i == t->capacity) {
+            if ((live_ + 1) * 4 > t->capacity) {
+                t = grow_locked(t);
+                i = t->find_slot(key, &free_slot);
+            }
+            i = free_slot;
+        }
+        t->write(i, key, data);
+        live_++;
     }
 
+    table *grow_locked(table *old_table) {
+        size_t capacity = old_table->capacity;
+        while ((live_ + 1) * 4 > capacity) {
+            capacity *= 2;
+        }
+        // Not yet visible to readers, so the slots are filled without going through write()
+        table *t = new table(capacity);
+        for (size_t j = 0; j < old_table->capacity; j++) {
+            DATA_T *data = old_table->slots[j].data.load(std::memory_order_relaxed);
+            if (data) {
+                void *key = old_table->slots[j].key.load(std::memory_order_relaxed);
+                size_t i = t->home(key);
+                while (t->slots[i].key.load(std::memory_order_relaxed)) {
+                    i = (i + 1) & t->mask;
+                }
+                t->slots[i].key.store(key, std::memory_order_relaxed);
+                t->slots[i].data.store(data, std::memory_order_relaxed);
+            }
+        }
+        tables_.emplace_back(t);
+        current_.store(t, std::memory_order_release);
+        return t;
+    }
+
+    std::atomic<table *> current_;
+    std::vector<std::unique_ptr<table>> tables_; // current table plus retired ones, freed at unload
+    std::mutex write_lock_;
+    size_t live_;
+};
+
+template <typename DATA_T> DATA_T *get_my_data_ptr(void *data_key, layer_data_table<DATA_T> &layer_data_map) {
+    DATA_T *debug_data = layer_data_map.find(data_key);
+    if (!debug_data) {
+        debug_data = layer_data_map.find_or_create(data_key);
+    }
     return debug_data;
 }
 
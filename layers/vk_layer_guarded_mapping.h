@@ -0,0 +1,285 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_GUARDED_MAPPING_H
+#define VK_LAYER_GUARDED_MAPPING_H
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <mutex>
+#include <signal.h>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+// Host-side shadow of a mapped range of non-coherent device memory that the application writes in
+// place of the driver's mapping. The shadow is anonymous mmap'd memory laid out as
+//   [guard pages][data pages][guard pages]
+// with the mapped range ending as close to the trailing guard pages as its alignment allows.
+//  - Guard pages are PROT_NONE. An access to one faults; the fault is recorded as an overflow and
+//    the page opened up so the access completes harmlessly, and flush() reports it.
+//  - Data pages are ordinary read/write memory, so the kernel can write into them too (read(),
+//    recv(), fread() straight into the mapping). Like the guard-banded copy, they do not start
+//    out holding the driver's contents; they start out zero and are not committed until written.
+//  - A 64-bit hash is kept per data page, of its contents when it was last copied to the driver.
+//    flush() rehashes the pages in the flushed range and copies only those whose hash changed.
+//    Pages that were never written still map the kernel's shared zero page, so hashing them
+//    commits nothing and reads the same cache-resident page over and over.
+// Faults anywhere else are passed on to the SIGSEGV handler that was installed before the first
+// shadow was created. Not available on Windows, where create() always fails.
+class guarded_mapping {
+  public:
+    guarded_mapping(const guarded_mapping &) = delete;
+    guarded_mapping &operator=(const guarded_mapping &) = delete;
+
+#if !defined(_WIN32)
+    // Returns nullptr if the shadow could not be set up, e.g. because too many are live at once
+    static std::unique_ptr<guarded_mapping> create(void *driver_data, size_t size, size_t alignment) {
+        if (!size || !install_handler())
+            return nullptr;
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        if (alignment < 1)
+            alignment = 1;
+        // Leave room to pull the start of the range down to alignment without leaving the data pages
+        const size_t data_pages = (size + alignment - 1 + page - 1) / page;
+        const size_t total = (2 * guard_pages + data_pages) * page;
+        void *base = mmap(nullptr, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+            return nullptr;
+        std::unique_ptr<guarded_mapping> mapping(new guarded_mapping(static_cast<char *>(base), total, page, data_pages,
+                                                                     static_cast<char *>(driver_data), size, alignment));
+        if (mprotect(mapping->data_pages_, data_pages * page, PROT_READ | PROT_WRITE) != 0 || !mapping->register_mapping())
+            return nullptr;
+        return mapping;
+    }
+
+    ~guarded_mapping() {
+        if (slot_ != no_slot) {
+            registry()[slot_].store(nullptr);
+            // A fault handler that loaded this shadow before the store may still be using it
+            while (active_handlers().load())
+                std::this_thread::yield();
+        }
+        munmap(base_, total_);
+    }
+
+    void *data() const { return data_; }
+    size_t size() const { return size_; }
+
+    // Copies what was written to [offset, offset + size) of the mapped range since it was last
+    // flushed to the driver's mapping. size may run past the end of the range (e.g. VK_WHOLE_SIZE).
+    // Pages only partly inside the flushed range are copied if changed but keep their old hash, so
+    // a later flush of the rest of the page still sees it as changed.
+    // Returns true if the application has accessed memory outside the mapped range.
+    bool flush(uint64_t offset, uint64_t size) {
+        bool overflow = overflow_.load() || slack_written();
+        if (offset >= size_ || !size)
+            return overflow;
+        const size_t begin = static_cast<size_t>(offset);
+        const size_t end = (size > size_ - offset) ? size_ : static_cast<size_t>(offset + size);
+        for (size_t i = page_of(data_ + begin); i <= page_of(data_ + end - 1); i++) {
+            char *page_begin = data_pages_ + i * page_;
+            const uint64_t hash = hash_page(page_begin);
+            if (hash == hashes_[i])
+                continue;
+            const size_t page_data_begin = static_cast<size_t>(std::max(page_begin, data_) - data_);
+            const size_t page_data_end = static_cast<size_t>(std::min(page_begin + page_, data_ + size_) - data_);
+            const size_t copy_begin = std::max(page_data_begin, begin);
+            const size_t copy_end = std::min(page_data_end, end);
+            memcpy(driver_data_ + copy_begin, data_ + copy_begin, copy_end - copy_begin);
+            if (copy_begin == page_data_begin && copy_end == page_data_end)
+                hashes_[i] = hash;
+        }
+        return overflow;
+    }
+
+  private:
+    static const size_t guard_pages = 16;
+    static const size_t max_mappings = 1024;
+    static const size_t no_slot = SIZE_MAX;
+
+    guarded_mapping(char *base, size_t total, size_t page, size_t data_pages, char *driver_data, size_t size, size_t alignment)
+        : base_(base), total_(total), page_(page), data_pages_(base + guard_pages * page), data_page_count_(data_pages),
+          data_(nullptr), size_(size), driver_data_(driver_data), hashes_(new uint64_t[data_pages]), overflow_(false),
+          slot_(no_slot) {
+        uintptr_t data_end = reinterpret_cast<uintptr_t>(data_pages_ + data_pages * page);
+        data_ = reinterpret_cast<char *>((data_end - size) / alignment * alignment);
+        std::fill(hashes_.get(), hashes_.get() + data_pages, zero_page_hash(page));
+    }
+
+    size_t page_of(const char *addr) const { return static_cast<size_t>(addr - data_pages_) / page_; }
+
+    // Eight independent multiply-add lanes over 8-byte words, mixed together at the end; the page
+    // size is a multiple of 64 bytes on every platform with mmap
+    static uint64_t hash_words(const uint64_t *words, size_t count) {
+        const uint64_t k = 0x9e3779b97f4a7c15ull;
+        uint64_t h[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+        for (size_t i = 0; i < count; i += 8) {
+            for (size_t j = 0; j < 8; j++)
+                h[j] = (h[j] + words[i + j]) * k;
+        }
+        uint64_t hash = 0;
+        for (size_t j = 0; j < 8; j++) {
+            hash = (hash ^ h[j]) * k;
+            hash ^= hash >> 29;
+        }
+        return hash;
+    }
+
+    uint64_t hash_page(const char *page_begin) const {
+        return hash_words(reinterpret_cast<const uint64_t *>(page_begin), page_ / sizeof(uint64_t));
+    }
+
+    static uint64_t zero_page_hash(size_t page) {
+        std::unique_ptr<uint64_t[]> zeros(new uint64_t[page / sizeof(uint64_t)]());
+        return hash_words(zeros.get(), page / sizeof(uint64_t));
+    }
+
+    // Bytes of the data pages either side of the mapped range start out zero, and only change if the
+    // application writes just outside the range without reaching a guard page
+    bool slack_written() const {
+        const char *data_end = data_ + size_;
+        const char *pages_end = data_pages_ + data_page_count_ * page_;
+        for (const char *p = data_pages_; p < data_; p++) {
+            if (*p)
+                return true;
+        }
+        for (const char *p = data_end; p < pages_end; p++) {
+            if (*p)
+                return true;
+        }
+        return false;
+    }
+
+    // Called from the fault handler; returns false if addr is not in this shadow. Only the guard
+    // pages are protected, so any fault here is an overflow.
+    bool handle_fault(char *addr) {
+        if (addr < base_ || addr >= base_ + total_)
+            return false;
+        char *page_begin = base_ + static_cast<size_t>(addr - base_) / page_ * page_;
+        overflow_.store(true);
+        mprotect(page_begin, page_, PROT_READ | PROT_WRITE);
+        return true;
+    }
+
+    bool register_mapping() {
+        for (size_t i = 0; i < max_mappings; i++) {
+            guarded_mapping *expected = nullptr;
+            if (registry()[i].compare_exchange_strong(expected, this)) {
+                slot_ = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Live shadows, scanned by the fault handler. A fixed array of atomics, so the handler neither
+    // locks nor allocates. Slots are published and retired with sequentially consistent operations,
+    // paired with active_handlers(): either a handler sees a retired slot as empty, or the
+    // destructor sees the handler and waits for it before unmapping.
+    static std::atomic<guarded_mapping *> *registry() {
+        static std::atomic<guarded_mapping *> mappings[max_mappings];
+        return mappings;
+    }
+
+    static std::atomic<unsigned> &active_handlers() {
+        static std::atomic<unsigned> count(0);
+        return count;
+    }
+
+    static struct sigaction &previous_action() {
+        static struct sigaction action;
+        return action;
+    }
+
+    static bool find_and_handle_fault(char *addr) {
+        std::atomic<guarded_mapping *> *mappings = registry();
+        for (size_t i = 0; i < max_mappings; i++) {
+            guarded_mapping *mapping = mappings[i].load();
+            if (mapping && mapping->handle_fault(addr))
+                return true;
+        }
+        return false;
+    }
+
+    static void on_fault(int sig, siginfo_t *info, void *context) {
+        active_handlers().fetch_add(1);
+        bool handled = find_and_handle_fault(static_cast<char *>(info->si_addr));
+        active_handlers().fetch_sub(1);
+        if (handled)
+            return;
+        // Not ours: call whatever was installed before, leaving this handler in place. SIG_DFL and
+        // SIG_IGN cannot be called; for a fault both end the process (the kernel does not let a
+        // faulting thread ignore SIGSEGV), so raise the signal again. It is delivered with the
+        // default action as soon as this handler returns, before the access is retried, and the
+        // process ends whether or not the access would fault again.
+        const struct sigaction &previous = previous_action();
+        if (previous.sa_flags & SA_SIGINFO) {
+            previous.sa_sigaction(sig, info, context);
+        } else if (previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN) {
+            previous.sa_handler(sig);
+        } else {
+            signal(SIGSEGV, SIG_DFL);
+            raise(SIGSEGV);
+        }
+    }
+
+    static bool install_handler() {
+        static std::mutex lock;
+        static bool installed = false;
+        std::lock_guard<std::mutex> guard(lock);
+        if (!installed) {
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_sigaction = on_fault;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            installed = (sigaction(SIGSEGV, &action, &previous_action()) == 0);
+        }
+        return installed;
+    }
+
+    char *base_;
+    size_t total_;
+    size_t page_;
+    char *data_pages_;
+    size_t data_page_count_;
+    char *data_;
+    size_t size_;
+    char *driver_data_;
+    std::unique_ptr<uint64_t[]> hashes_;
+    std::atomic<bool> overflow_;
+    size_t slot_;
+#else
+    static std::unique_ptr<guarded_mapping> create(void *, size_t, size_t) { return nullptr; }
+    void *data() const { return nullptr; }
+    size_t size() const { return 0; }
+    bool flush(uint64_t, uint64_t) { return false; }
+
+  private:
+    guarded_mapping() {}
+#endif
+};
+
+#endif // VK_LAYER_GUARDED_MAPPING_H
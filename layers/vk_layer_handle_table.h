@@ -0,0 +1,142 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_HANDLE_TABLE_H
+#define VK_LAYER_HANDLE_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Map from 64-bit object handle to a small value, stored inline in one flat array.
+// Open addressing with linear probing keeps a lookup to one or two cache lines and an
+// insert to no allocation at all once the table has grown to the application's working
+// set. The table doubles when it is three quarters full and keeps its capacity across
+// clear(), so it settles at the size the observed object count needs.
+// Pointers returned by find() and operator[] are invalidated by the next insert or erase.
+template <typename VALUE_T> class handle_table {
+  public:
+    handle_table() : size_(0), mask_(0) {}
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    VALUE_T *find(uint64_t handle) {
+        if (size_ == 0)
+            return nullptr;
+        for (size_t i = hash(handle) & mask_;; i = (i + 1) & mask_) {
+            slot &s = slots_[i];
+            if (!s.used)
+                return nullptr;
+            if (s.handle == handle)
+                return &s.value;
+        }
+    }
+    const VALUE_T *find(uint64_t handle) const { return const_cast<handle_table *>(this)->find(handle); }
+    bool contains(uint64_t handle) const { return find(handle) != nullptr; }
+
+    // Returns the value for handle, inserting a value-initialized one if there is none
+    VALUE_T &operator[](uint64_t handle) {
+        if ((size_ + 1) * 4 > slots_.size() * 3)
+            rehash(slots_.empty() ? min_capacity : slots_.size() * 2);
+        size_t i = hash(handle) & mask_;
+        while (slots_[i].used) {
+            if (slots_[i].handle == handle)
+                return slots_[i].value;
+            i = (i + 1) & mask_;
+        }
+        slots_[i].used = true;
+        slots_[i].handle = handle;
+        slots_[i].value = VALUE_T();
+        size_++;
+        return slots_[i].value;
+    }
+
+    bool erase(uint64_t handle) {
+        if (size_ == 0)
+            return false;
+        size_t i = hash(handle) & mask_;
+        while (slots_[i].handle != handle || !slots_[i].used) {
+            if (!slots_[i].used)
+                return false;
+            i = (i + 1) & mask_;
+        }
+        // Backward-shift deletion: pull later members of the probe run into the hole so that
+        // lookups never need tombstones.
+        for (size_t j = (i + 1) & mask_; slots_[j].used; j = (j + 1) & mask_) {
+            size_t home = hash(slots_[j].handle) & mask_;
+            if (((j - home) & mask_) >= ((j - i) & mask_)) {
+                slots_[i] = slots_[j];
+                i = j;
+            }
+        }
+        slots_[i].used = false;
+        size_--;
+        return true;
+    }
+
+    void clear() {
+        for (auto &s : slots_)
+            s.used = false;
+        size_ = 0;
+    }
+
+    // Calls func(handle, value) for every entry. func must not insert or erase.
+    template <typename FUNC_T> void for_each(FUNC_T func) {
+        for (auto &s : slots_) {
+            if (s.used)
+                func(s.handle, s.value);
+        }
+    }
+
+  private:
+    struct slot {
+        slot() : handle(0), used(false), value() {}
+        uint64_t handle;
+        bool used;
+        VALUE_T value;
+    };
+    static const size_t min_capacity = 16;
+
+    // Handles are often pointers or small counters; spread them over the whole table
+    static size_t hash(uint64_t handle) {
+        handle ^= handle >> 33;
+        handle *= 0xff51afd7ed558ccdull;
+        handle ^= handle >> 33;
+        return static_cast<size_t>(handle);
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<slot> old(capacity);
+        old.swap(slots_);
+        mask_ = capacity - 1;
+        for (auto &s : old) {
+            if (s.used) {
+                size_t i = hash(s.handle) & mask_;
+                while (slots_[i].used)
+                    i = (i + 1) & mask_;
+                slots_[i] = s;
+            }
+        }
+    }
+
+    std::vector<slot> slots_;
+    size_t size_;
+    size_t mask_;
+};
+
+#endif // VK_LAYER_HANDLE_TABLE_H
@@ -0,0 +1,187 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_INTERVAL_TREE_H
+#define VK_LAYER_INTERVAL_TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+
+// Set of closed [start, end] ranges, each tagged with a 64-bit id and a value, that answers
+// "which ranges intersect [lo, hi]" in O(log n + k). Ranges may overlap each other.
+// Implemented as a treap ordered by start, with every node caching the largest end in its
+// subtree so that queries can skip whole subtrees. Removal is by id.
+template <typename VALUE_T> class interval_tree {
+  public:
+    interval_tree() : root_(nullptr), next_seq_(0) {}
+    interval_tree(const interval_tree &) = delete;
+    interval_tree &operator=(const interval_tree &) = delete;
+    ~interval_tree() { destroy(root_); }
+
+    size_t size() const { return ids_.size(); }
+    bool empty() const { return ids_.empty(); }
+
+    void insert(uint64_t id, uint64_t start, uint64_t end, const VALUE_T &value) {
+        node *n = new node(start, end, next_seq_++, value);
+        root_ = insert(root_, n);
+        ids_.insert(std::make_pair(id, n));
+    }
+
+    // Removes one range that was inserted with id. Returns false if there is none.
+    bool erase(uint64_t id) {
+        auto it = ids_.find(id);
+        if (it == ids_.end())
+            return false;
+        node *n = it->second;
+        ids_.erase(it);
+        root_ = erase(root_, n);
+        delete n;
+        return true;
+    }
+
+    void clear() {
+        destroy(root_);
+        root_ = nullptr;
+        ids_.clear();
+    }
+
+    // Calls func(value) for every stored range intersecting [lo, hi]
+    template <typename FUNC_T> void for_each_overlap(uint64_t lo, uint64_t hi, FUNC_T func) const {
+        for_each_overlap(root_, lo, hi, func);
+    }
+
+  private:
+    struct node {
+        uint64_t start;
+        uint64_t end;
+        uint64_t max_end; // largest end in this subtree
+        uint64_t seq;     // insertion order; breaks ties between equal starts
+        uint64_t priority;
+        VALUE_T value;
+        node *left;
+        node *right;
+        node(uint64_t start, uint64_t end, uint64_t seq, const VALUE_T &value)
+            : start(start), end(end), max_end(end), seq(seq), priority(mix(seq)), value(value), left(nullptr), right(nullptr) {}
+    };
+
+    // splitmix64 finalizer, gives well-spread heap priorities from the sequence number
+    static uint64_t mix(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    static bool less(const node *a, const node *b) { return a->start < b->start || (a->start == b->start && a->seq < b->seq); }
+
+    static void update(node *n) {
+        n->max_end = n->end;
+        if (n->left && n->left->max_end > n->max_end)
+            n->max_end = n->left->max_end;
+        if (n->right && n->right->max_end > n->max_end)
+            n->max_end = n->right->max_end;
+    }
+
+    static node *rotate_right(node *n) {
+        node *l = n->left;
+        n->left = l->right;
+        l->right = n;
+        update(n);
+        update(l);
+        return l;
+    }
+
+    static node *rotate_left(node *n) {
+        node *r = n->right;
+        n->right = r->left;
+        r->left = n;
+        update(n);
+        update(r);
+        return r;
+    }
+
+    static node *insert(node *root, node *n) {
+        if (!root)
+            return n;
+        if (less(n, root)) {
+            root->left = insert(root->left, n);
+            if (root->left->priority > root->priority)
+                return rotate_right(root);
+        } else {
+            root->right = insert(root->right, n);
+            if (root->right->priority > root->priority)
+                return rotate_left(root);
+        }
+        update(root);
+        return root;
+    }
+
+    // Detaches n from the subtree at root; n must be present
+    static node *erase(node *root, node *n) {
+        if (root == n)
+            return merge(n->left, n->right);
+        if (less(n, root))
+            root->left = erase(root->left, n);
+        else
+            root->right = erase(root->right, n);
+        update(root);
+        return root;
+    }
+
+    // Joins two treaps where every key in a precedes every key in b
+    static node *merge(node *a, node *b) {
+        if (!a)
+            return b;
+        if (!b)
+            return a;
+        if (a->priority > b->priority) {
+            a->right = merge(a->right, b);
+            update(a);
+            return a;
+        }
+        b->left = merge(a, b->left);
+        update(b);
+        return b;
+    }
+
+    template <typename FUNC_T> static void for_each_overlap(const node *n, uint64_t lo, uint64_t hi, FUNC_T &func) {
+        while (n && n->max_end >= lo) {
+            for_each_overlap(n->left, lo, hi, func);
+            if (n->start > hi)
+                return; // everything to the right starts later still
+            if (n->end >= lo)
+                func(n->value);
+            n = n->right;
+        }
+    }
+
+    static void destroy(node *n) {
+        while (n) {
+            destroy(n->left);
+            node *right = n->right;
+            delete n;
+            n = right;
+        }
+    }
+
+    node *root_;
+    uint64_t next_seq_;
+    std::unordered_multimap<uint64_t, node *> ids_;
+};
+
+#endif // VK_LAYER_INTERVAL_TREE_H
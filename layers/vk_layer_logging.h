@@ -28,28 +28,228 @@
 #include "vk_layer_table.h"
 #include "vk_loader_platform.h"
 #include "vulkan/vk_layer.h"
+#include <atomic>
+#include <chrono>
 #include <cinttypes>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+struct debug_report_async;
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list;
     VkLayerDbgFunctionNode *default_debug_callback_list;
     VkFlags active_flags;
     bool g_DEBUG_REPORT;
+    debug_report_async *async; // Non-NULL when messages are delivered from a worker thread
 } debug_report_data;
 
+// A formatted message waiting for asynchronous delivery
+struct debug_report_queued_msg {
+    VkFlags msgFlags;
+    VkDebugReportObjectTypeEXT objectType;
+    uint64_t srcObject;
+    size_t location;
+    int32_t msgCode;
+    std::string layerPrefix;
+    char *pMsg; // From vasprintf, freed after delivery
+};
+
+// Per-(msgCode, object) delivery count used to rate-limit repeated messages
+struct debug_report_dup_count {
+    uint32_t delivered;
+    uint32_t suppressed;
+    VkFlags msgFlags;
+    VkDebugReportObjectTypeEXT objectType;
+    size_t location;
+    std::string layerPrefix;
+};
+
+// State for asynchronous message delivery. Threads logging a message only format it and push it
+// onto a bounded lock-free ring; a worker thread drains the ring in batches and invokes the
+// callbacks. Every pop happens under delivery_lock, so the ring has a single consumer at a time
+// and the callback lists can be changed safely by taking the same lock.
+struct debug_report_async {
+    static const size_t ring_size = 4096; // Power of two
+    struct cell {
+        std::atomic<size_t> sequence;
+        debug_report_queued_msg *msg;
+    };
+    cell ring[ring_size];
+    std::atomic<size_t> enqueue_pos;
+    std::atomic<size_t> dequeue_pos;
+
+    uint32_t duplicate_limit; // Deliveries allowed per (msgCode, object), 0 for no limit
+    std::map<std::pair<int32_t, uint64_t>, debug_report_dup_count> duplicates;
+
+    std::mutex delivery_lock;
+    std::mutex wake_lock;
+    std::condition_variable wake;
+    bool stop;
+    std::atomic<bool> idle; // Worker is waiting for the ring to become non-empty
+    std::thread worker;
+
+    debug_report_async(uint32_t duplicate_limit)
+        : enqueue_pos(0), dequeue_pos(0), duplicate_limit(duplicate_limit), stop(false), idle(false) {
+        for (size_t i = 0; i < ring_size; i++) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+            ring[i].msg = nullptr;
+        }
+    }
+
+    // Any number of producers
+    bool push(debug_report_queued_msg *msg) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        cell *c;
+        for (;;) {
+            c = &ring[pos & (ring_size - 1)];
+            size_t seq = c->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        c->msg = msg;
+        c->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Single consumer; caller holds delivery_lock
+    debug_report_queued_msg *pop() {
+        size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        cell *c = &ring[pos & (ring_size - 1)];
+        if (c->sequence.load(std::memory_order_acquire) != pos + 1)
+            return nullptr;
+        debug_report_queued_msg *msg = c->msg;
+        c->sequence.store(pos + ring_size, std::memory_order_release);
+        dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        return msg;
+    }
+
+    size_t pending() const { return enqueue_pos.load(std::memory_order_relaxed) - dequeue_pos.load(std::memory_order_relaxed); }
+};
+
 template debug_report_data *get_my_data_ptr<debug_report_data>(void *data_key,
-                                                               std::unordered_map<void *, debug_report_data *> &data_map);
+                                                               layer_data_table<debug_report_data> &data_map);
 
 // Forward Declarations
 static inline bool debug_report_log_msg(const debug_report_data *debug_data, VkFlags msgFlags,
                                         VkDebugReportObjectTypeEXT objectType, uint64_t srcObject, size_t location, int32_t msgCode,
                                         const char *pLayerPrefix, const char *pMsg);
 
+// Delivers every queued message on the calling thread. Caller holds async->delivery_lock.
+static inline void debug_report_drain_queue(const debug_report_data *debug_data) {
+    debug_report_async *async = debug_data->async;
+    debug_report_queued_msg *msg;
+    while ((msg = async->pop()) != nullptr) {
+        bool deliver = true;
+        if (async->duplicate_limit) {
+            auto &dup = async->duplicates[std::make_pair(msg->msgCode, msg->srcObject)];
+            if (dup.delivered < async->duplicate_limit) {
+                dup.delivered++;
+            } else {
+                if (!dup.suppressed) {
+                    dup.msgFlags = msg->msgFlags;
+                    dup.objectType = msg->objectType;
+                    dup.location = msg->location;
+                    dup.layerPrefix = msg->layerPrefix;
+                }
+                dup.suppressed++;
+                deliver = false;
+            }
+        }
+        if (deliver) {
+            debug_report_log_msg(debug_data, msg->msgFlags, msg->objectType, msg->srcObject, msg->location, msg->msgCode,
+                                 msg->layerPrefix.c_str(), msg->pMsg ? msg->pMsg : "Allocation failure");
+        }
+        free(msg->pMsg);
+        delete msg;
+    }
+}
+
+static inline void debug_report_async_worker(const debug_report_data *debug_data) {
+    debug_report_async *async = debug_data->async;
+    bool stop = false;
+    while (!stop) {
+        {
+            // Sleep until a producer pushes onto an empty ring. idle is set before the ring is checked
+            // and read by producers after they push, so one of the two always sees the other.
+            std::unique_lock<std::mutex> lock(async->wake_lock);
+            async->idle.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            async->wake.wait(lock, [async] { return async->stop || async->pending(); });
+            async->idle.store(false);
+            // Then let the rest of a burst arrive, so it goes out as one batch; producers signal
+            // again if the ring fills up before then
+            async->wake.wait_for(lock, std::chrono::milliseconds(5),
+                                 [async] { return async->stop || async->pending() >= debug_report_async::ring_size / 2; });
+            stop = async->stop;
+        }
+        std::lock_guard<std::mutex> lock(async->delivery_lock);
+        debug_report_drain_queue(debug_data);
+    }
+    // Report what the rate limit held back
+    std::lock_guard<std::mutex> lock(async->delivery_lock);
+    for (auto &entry : async->duplicates) {
+        const debug_report_dup_count &dup = entry.second;
+        if (dup.suppressed) {
+            char str[128];
+            snprintf(str, sizeof(str), "%u further occurrences of this message were suppressed (duplicate limit %u)",
+                     dup.suppressed, async->duplicate_limit);
+            debug_report_log_msg(debug_data, dup.msgFlags, dup.objectType, entry.first.second, dup.location, entry.first.first,
+                                 dup.layerPrefix.c_str(), str);
+        }
+    }
+    async->duplicates.clear();
+}
+
+// Switches debug_data to asynchronous delivery; see the async_delivery setting in vk_layer_settings.txt
+static inline void layer_debug_report_enable_async(debug_report_data *debug_data, uint32_t duplicate_limit) {
+    if (!debug_data || debug_data->async)
+        return;
+    debug_data->async = new debug_report_async(duplicate_limit);
+    debug_data->async->worker = std::thread(debug_report_async_worker, debug_data);
+}
+
+// Delivers all queued messages and the duplicate summary, then stops the worker thread. Call it
+// before removing the layer's own callbacks at DestroyInstance, or what it delivers goes nowhere.
+static inline void layer_debug_report_disable_async(debug_report_data *debug_data) {
+    debug_report_async *async = debug_data ? debug_data->async : nullptr;
+    if (!async)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(async->wake_lock);
+        async->stop = true;
+    }
+    async->wake.notify_one();
+    async->worker.join();
+    debug_data->async = nullptr;
+    delete async;
+}
+
+// Excludes the worker thread while a callback list is changed. Messages queued so far are
+// delivered first, to the callbacks that were registered when they were logged.
+static inline std::unique_lock<std::mutex> debug_report_lock_callbacks(debug_report_data *debug_data) {
+    if (!debug_data->async)
+        return std::unique_lock<std::mutex>();
+    std::unique_lock<std::mutex> lock(debug_data->async->delivery_lock);
+    debug_report_drain_queue(debug_data);
+    return lock;
+}
+
 // Add a debug message callback node structure to the specified callback linked list
 static inline void AddDebugMessageCallback(debug_report_data *debug_data, VkLayerDbgFunctionNode **list_head,
                                            VkLayerDbgFunctionNode *new_node) {
@@ -149,6 +349,7 @@ debug_report_create_instance(VkLayerInstanceDispatchTable *table, VkInstance ins
 
 static inline void layer_debug_report_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        layer_debug_report_disable_async(debug_data);
         RemoveAllMessageCallbacks(debug_data, &debug_data->default_debug_callback_list);
         RemoveAllMessageCallbacks(debug_data, &debug_data->debug_callback_list);
         free(debug_data);
@@ -167,6 +368,7 @@ static inline void layer_debug_report_destroy_device(VkDevice device) {
 
 static inline void layer_destroy_msg_callback(debug_report_data *debug_data, VkDebugReportCallbackEXT callback,
                                               const VkAllocationCallbacks *pAllocator) {
+    auto lock = debug_report_lock_callbacks(debug_data);
     RemoveDebugMessageCallback(debug_data, &debug_data->debug_callback_list, callback);
     RemoveDebugMessageCallback(debug_data, &debug_data->default_debug_callback_list, callback);
 }
@@ -186,6 +388,7 @@ static inline VkResult layer_create_msg_callback(debug_report_data *debug_data,
     pNewDbgFuncNode->msgFlags = pCreateInfo->flags;
     pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
 
+    auto lock = debug_report_lock_callbacks(debug_data);
     if (default_callback) {
         AddDebugMessageCallback(debug_data, &debug_data->default_debug_callback_list, pNewDbgFuncNode);
     } else {
@@ -349,6 +552,23 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags
         str = nullptr;
     }
     va_end(argptr);
+    if (debug_data->async) {
+        // Callbacks run later on the worker thread, so their return value cannot abort this call
+        debug_report_async *async = debug_data->async;
+        debug_report_queued_msg *msg = new debug_report_queued_msg{msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, str};
+        while (!async->push(msg)) {
+            // Ring is full: rather than lose messages, help the worker empty it
+            std::lock_guard<std::mutex> lock(async->delivery_lock);
+            debug_report_drain_queue(debug_data);
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (async->idle.load() || async->pending() >= debug_report_async::ring_size / 2) {
+            // Notify under the lock so the wakeup cannot fall between the worker's check and its wait
+            std::lock_guard<std::mutex> lock(async->wake_lock);
+            async->wake.notify_one();
+        }
+        return false;
+    }
     bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
                                        str ? str : "Allocation failure");
     free(str);
@@ -0,0 +1,66 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_PROC_TABLE_H
+#define VK_LAYER_PROC_TABLE_H
+
+#include <initializer_list>
+#include <string.h>
+#include <vector>
+#include "vulkan/vulkan.h"
+#include "vk_entrypoint_hash.h"
+
+// A layer's intercepted commands, indexed by vk_entrypoint_id so that find() costs one hash of
+// the name rather than a strcmp() against every entry. Names the generated hash does not know
+// are kept aside and searched linearly.
+// The index is filled in by the constructor, so define tables at namespace scope, where they are
+// built when the layer is loaded; function-local statics are not initialized thread-safely by
+// every compiler the layers support.
+class layer_proc_table {
+  public:
+    struct entry {
+        const char *name;
+        PFN_vkVoidFunction proc;
+    };
+
+    layer_proc_table(std::initializer_list<entry> entries) : procs_() {
+        for (const auto &e : entries) {
+            int id = vk_get_entrypoint_id(e.name);
+            if (id == VK_ENTRYPOINT_UNKNOWN)
+                others_.push_back(e);
+            else if (!procs_[id])
+                procs_[id] = e.proc;
+        }
+    }
+
+    PFN_vkVoidFunction find(const char *name) const {
+        int id = vk_get_entrypoint_id(name);
+        if (id != VK_ENTRYPOINT_UNKNOWN)
+            return procs_[id];
+        for (const auto &e : others_) {
+            if (name && !strcmp(e.name, name))
+                return e.proc;
+        }
+        return nullptr;
+    }
+
+  private:
+    PFN_vkVoidFunction procs_[VK_ENTRYPOINT_COUNT];
+    std::vector<entry> others_;
+};
+
+#endif // VK_LAYER_PROC_TABLE_H
@@ -0,0 +1,186 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_RANGE_MAP_H
+#define VK_LAYER_RANGE_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Map from 64-bit index to value, stored as sorted, non-overlapping half-open runs
+// [begin, end) of equal values. Adjacent runs with equal values are always merged, so
+// state that is mostly uniform (e.g. every subresource of an image in one layout) costs a
+// single run however large the index space is. Indices that were never set are gaps.
+// VALUE_T must be default constructible, copyable and comparable with ==.
+template <typename VALUE_T> class range_map {
+  public:
+    size_t size() const { return runs_.size(); }
+    bool empty() const { return runs_.empty(); }
+    void clear() { runs_.clear(); }
+
+    // True if every index in [begin, end) is covered by one run; value is then set to it
+    bool uniform(uint64_t begin, uint64_t end, VALUE_T *value) const {
+        size_t i = first_ending_after(begin);
+        if (i == runs_.size() || runs_[i].begin > begin || runs_[i].end < end)
+            return false;
+        *value = runs_[i].value;
+        return true;
+    }
+
+    const VALUE_T *find(uint64_t index) const {
+        size_t i = first_ending_after(index);
+        if (i == runs_.size() || runs_[i].begin > index)
+            return nullptr;
+        return &runs_[i].value;
+    }
+
+    void set(uint64_t begin, uint64_t end, const VALUE_T &value) {
+        if (begin >= end)
+            return;
+        size_t first = first_ending_after(begin);
+        size_t last = first;
+        while (last < runs_.size() && runs_[last].begin < end)
+            last++;
+        // Runs [first, last) overlap [begin, end); keep the parts that stick out either side
+        run mid(begin, end, value);
+        run left, right;
+        bool has_left = false, has_right = false;
+        if (first < last && runs_[first].begin < begin) {
+            if (runs_[first].value == value) {
+                mid.begin = runs_[first].begin;
+            } else {
+                left = run(runs_[first].begin, begin, runs_[first].value);
+                has_left = true;
+            }
+        }
+        if (first < last && runs_[last - 1].end > end) {
+            if (runs_[last - 1].value == value) {
+                mid.end = runs_[last - 1].end;
+            } else {
+                right = run(end, runs_[last - 1].end, runs_[last - 1].value);
+                has_right = true;
+            }
+        }
+        // Merge with untouched neighbours that continue the new run
+        if (!has_left && first > 0 && runs_[first - 1].end == mid.begin && runs_[first - 1].value == value) {
+            first--;
+            mid.begin = runs_[first].begin;
+        }
+        if (!has_right && last < runs_.size() && runs_[last].begin == mid.end && runs_[last].value == value) {
+            mid.end = runs_[last].end;
+            last++;
+        }
+        size_t count = 1 + (has_left ? 1 : 0) + (has_right ? 1 : 0);
+        if (last - first < count) {
+            runs_.insert(runs_.begin() + last, count - (last - first), run());
+        } else if (last - first > count) {
+            runs_.erase(runs_.begin() + first + count, runs_.begin() + last);
+        }
+        if (has_left)
+            runs_[first++] = left;
+        runs_[first++] = mid;
+        if (has_right)
+            runs_[first] = right;
+    }
+
+    // Calls func(begin, end, value) for each piece of [begin, end), in order. value points at
+    // the run covering the piece, or is nullptr for a gap.
+    template <typename FUNC_T> void for_each(uint64_t begin, uint64_t end, FUNC_T func) const {
+        uint64_t pos = begin;
+        for (size_t i = first_ending_after(begin); i < runs_.size() && runs_[i].begin < end; i++) {
+            const run &r = runs_[i];
+            if (r.begin > pos)
+                func(pos, r.begin, static_cast<const VALUE_T *>(nullptr));
+            pos = r.begin > pos ? r.begin : pos;
+            uint64_t piece_end = r.end < end ? r.end : end;
+            func(pos, piece_end, &r.value);
+            pos = piece_end;
+        }
+        if (pos < end)
+            func(pos, end, static_cast<const VALUE_T *>(nullptr));
+    }
+
+    // Calls func(begin, end, value) for every run
+    template <typename FUNC_T> void for_each(FUNC_T func) const {
+        for (const auto &r : runs_)
+            func(r.begin, r.end, r.value);
+    }
+
+    // Replaces each piece of [begin, end) by func(value), with value as for for_each()
+    template <typename FUNC_T> void update(uint64_t begin, uint64_t end, FUNC_T func) {
+        if (begin >= end)
+            return;
+        VALUE_T value;
+        if (uniform(begin, end, &value)) {
+            set(begin, end, func(&value));
+            return;
+        }
+        // Rebuild the run list in one pass rather than splicing each piece in separately
+        std::vector<run> result;
+        result.reserve(runs_.size() + 2);
+        size_t first = first_ending_after(begin);
+        size_t last = first;
+        while (last < runs_.size() && runs_[last].begin < end)
+            last++;
+        for (size_t i = 0; i < first; i++)
+            append(result, runs_[i]);
+        if (first < last && runs_[first].begin < begin)
+            append(result, run(runs_[first].begin, begin, runs_[first].value));
+        for_each(begin, end, [&](uint64_t piece_begin, uint64_t piece_end, const VALUE_T *piece_value) {
+            append(result, run(piece_begin, piece_end, func(piece_value)));
+        });
+        if (first < last && runs_[last - 1].end > end)
+            append(result, run(end, runs_[last - 1].end, runs_[last - 1].value));
+        for (size_t i = last; i < runs_.size(); i++)
+            append(result, runs_[i]);
+        runs_.swap(result);
+    }
+
+  private:
+    struct run {
+        run() : begin(0), end(0), value() {}
+        run(uint64_t begin, uint64_t end, const VALUE_T &value) : begin(begin), end(end), value(value) {}
+        uint64_t begin;
+        uint64_t end;
+        VALUE_T value;
+    };
+
+    static void append(std::vector<run> &runs, const run &r) {
+        if (!runs.empty() && runs.back().end == r.begin && runs.back().value == r.value)
+            runs.back().end = r.end;
+        else
+            runs.push_back(r);
+    }
+
+    // Index of the first run with end > index
+    size_t first_ending_after(uint64_t index) const {
+        size_t lo = 0, hi = runs_.size();
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (runs_[mid].end > index)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return lo;
+    }
+
+    std::vector<run> runs_;
+};
+
+#endif // VK_LAYER_RANGE_MAP_H
@@ -0,0 +1,137 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_RWLOCK_H
+#define VK_LAYER_RWLOCK_H
+
+#include <atomic>
+#include <condition_variable>
+#include <stdint.h>
+#include <mutex>
+
+// Reader/writer lock for layer state (std::shared_timed_mutex needs C++14).
+// Any number of readers may hold the lock at once. A waiting writer blocks new
+// readers so that create/destroy calls are not starved by command recording.
+// lock()/unlock() take the lock exclusively, so std::unique_lock and
+// std::lock_guard work unchanged for writers.
+// Readers only touch one atomic word unless a writer holds or wants the lock,
+// so threads recording command buffers in parallel do not queue up on a mutex.
+class rw_lock {
+  public:
+    rw_lock() : state_(0), waiting_writers_(0), writer_(false) {}
+    rw_lock(const rw_lock &) = delete;
+    rw_lock &operator=(const rw_lock &) = delete;
+
+    void lock() {
+        std::unique_lock<std::mutex> guard(mutex_);
+        waiting_writers_++;
+        writer_cv_.wait(guard, [this] { return !writer_; });
+        waiting_writers_--;
+        writer_ = true;
+        // Stop new readers, then wait for the ones already in to leave
+        state_.fetch_or(writer_bit);
+        writer_cv_.wait(guard, [this] { return state_.load() == writer_bit; });
+    }
+
+    bool try_lock() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        uint32_t expected = 0;
+        if (writer_ || !state_.compare_exchange_strong(expected, writer_bit))
+            return false;
+        writer_ = true;
+        return true;
+    }
+
+    void unlock() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            writer_ = false;
+            // Keep readers out if another writer is queued behind this one
+            if (waiting_writers_ == 0)
+                state_.fetch_and(~writer_bit);
+        }
+        writer_cv_.notify_all();
+        reader_cv_.notify_all();
+    }
+
+    void lock_shared() {
+        if (try_add_reader())
+            return;
+        std::unique_lock<std::mutex> guard(mutex_);
+        reader_cv_.wait(guard, [this] { return try_add_reader(); });
+    }
+
+    void unlock_shared() {
+        uint32_t previous = state_.fetch_sub(1);
+        if (previous == (writer_bit | 1)) {
+            // Last reader out while a writer drains; take the mutex so the wakeup cannot slip in
+            // between the writer checking the count and going to sleep
+            std::lock_guard<std::mutex> guard(mutex_);
+            writer_cv_.notify_all();
+        }
+    }
+
+  private:
+    static const uint32_t writer_bit = 0x80000000u;
+
+    bool try_add_reader() {
+        uint32_t state = state_.load();
+        while (!(state & writer_bit)) {
+            if (state_.compare_exchange_weak(state, state + 1))
+                return true;
+        }
+        return false;
+    }
+
+    // Reader count, plus writer_bit while a writer holds the lock or is waiting for readers to leave
+    std::atomic<uint32_t> state_;
+    std::mutex mutex_;
+    std::condition_variable reader_cv_;
+    std::condition_variable writer_cv_;
+    uint32_t waiting_writers_;
+    bool writer_;
+};
+
+// Scoped shared ownership of an rw_lock. Mirrors the subset of std::unique_lock
+// the layers use (lock/unlock/owns_lock) so call sites can drop the lock around
+// calls down the chain and re-take it afterwards.
+class shared_lock {
+  public:
+    explicit shared_lock(rw_lock &rw) : rw_(rw), owns_(true) { rw_.lock_shared(); }
+    ~shared_lock() {
+        if (owns_)
+            rw_.unlock_shared();
+    }
+    shared_lock(const shared_lock &) = delete;
+    shared_lock &operator=(const shared_lock &) = delete;
+
+    void lock() {
+        rw_.lock_shared();
+        owns_ = true;
+    }
+    void unlock() {
+        rw_.unlock_shared();
+        owns_ = false;
+    }
+    bool owns_lock() const { return owns_; }
+
+  private:
+    rw_lock &rw_;
+    bool owns_;
+};
+
+#endif // VK_LAYER_RWLOCK_H
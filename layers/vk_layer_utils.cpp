@@ -623,9 +623,13 @@ void layer_debug_actions(debug_report_data *report_data, std::vector<VkDebugRepo
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string async_delivery_key = layer_identifier;
+    std::string duplicate_limit_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    async_delivery_key.append(".async_delivery");
+    duplicate_limit_key.append(".duplicate_limit");
 
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
@@ -633,6 +637,12 @@ void layer_debug_actions(debug_report_data *report_data, std::vector<VkDebugRepo
     // Flag as default if these settings are not from a vk_layer_settings.txt file
     bool default_layer_callback = (debug_action & VK_DBG_LAYER_ACTION_DEFAULT) ? true : false;
 
+    const char *async_delivery = getLayerOption(async_delivery_key.c_str());
+    if (!strcmp(async_delivery, "TRUE") || !strcmp(async_delivery, "true")) {
+        uint32_t duplicate_limit = static_cast<uint32_t>(strtoul(getLayerOption(duplicate_limit_key.c_str()), NULL, 10));
+        layer_debug_report_enable_async(report_data, duplicate_limit);
+    }
+
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
@@ -18,12 +18,17 @@
  * Author: Jon Ashburn <jon@lunarg.com>
  */
 
+#define _GNU_SOURCE
 #include "vk_loader_platform.h"
 #include "loader.h"
 #if defined(__linux__)
 #pragma GCC optimize(3) // force gcc to use tail-calls
 #endif
 
+#if MAX_NUM_DEV_EXTS != 1024
+#error "dev_ext_trampoline.c must be regenerated for MAX_NUM_DEV_EXTS"
+#endif
+
 VKAPI_ATTR void VKAPI_CALL vkDevExt0(VkDevice device) {
     const struct loader_dev_dispatch_table *disp;
     disp = loader_get_dev_dispatch(device);
@@ -1524,6 +1529,4650 @@ VKAPI_ATTR void VKAPI_CALL vkDevExt249(VkDevice device) {
     disp->ext_dispatch.DevExt[249](device);
 }
 
+VKAPI_ATTR void VKAPI_CALL vkDevExt250(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[250](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt251(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[251](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt252(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[252](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt253(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[253](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt254(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[254](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt255(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[255](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt256(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[256](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt257(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[257](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt258(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[258](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt259(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[259](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt260(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[260](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt261(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[261](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt262(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[262](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt263(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[263](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt264(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[264](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt265(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[265](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt266(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[266](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt267(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[267](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt268(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[268](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt269(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[269](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt270(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[270](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt271(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[271](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt272(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[272](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt273(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[273](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt274(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[274](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt275(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[275](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt276(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[276](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt277(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[277](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt278(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[278](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt279(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[279](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt280(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[280](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt281(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[281](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt282(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[282](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt283(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[283](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt284(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[284](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt285(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[285](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt286(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[286](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt287(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[287](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt288(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[288](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt289(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[289](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt290(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[290](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt291(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[291](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt292(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[292](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt293(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[293](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt294(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[294](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt295(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[295](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt296(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[296](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt297(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[297](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt298(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[298](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt299(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[299](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt300(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[300](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt301(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[301](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt302(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[302](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt303(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[303](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt304(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[304](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt305(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[305](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt306(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[306](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt307(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[307](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt308(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[308](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt309(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[309](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt310(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[310](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt311(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[311](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt312(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[312](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt313(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[313](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt314(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[314](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt315(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[315](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt316(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[316](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt317(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[317](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt318(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[318](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt319(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[319](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt320(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[320](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt321(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[321](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt322(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[322](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt323(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[323](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt324(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[324](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt325(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[325](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt326(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[326](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt327(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[327](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt328(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[328](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt329(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[329](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt330(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[330](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt331(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[331](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt332(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[332](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt333(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[333](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt334(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[334](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt335(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[335](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt336(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[336](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt337(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[337](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt338(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[338](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt339(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[339](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt340(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[340](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt341(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[341](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt342(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[342](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt343(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[343](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt344(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[344](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt345(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[345](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt346(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[346](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt347(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[347](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt348(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[348](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt349(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[349](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt350(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[350](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt351(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[351](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt352(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[352](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt353(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[353](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt354(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[354](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt355(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[355](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt356(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[356](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt357(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[357](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt358(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[358](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt359(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[359](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt360(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[360](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt361(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[361](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt362(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[362](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt363(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[363](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt364(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[364](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt365(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[365](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt366(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[366](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt367(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[367](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt368(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[368](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt369(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[369](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt370(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[370](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt371(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[371](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt372(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[372](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt373(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[373](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt374(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[374](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt375(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[375](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt376(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[376](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt377(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[377](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt378(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[378](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt379(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[379](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt380(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[380](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt381(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[381](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt382(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[382](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt383(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[383](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt384(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[384](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt385(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[385](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt386(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[386](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt387(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[387](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt388(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[388](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt389(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[389](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt390(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[390](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt391(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[391](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt392(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[392](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt393(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[393](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt394(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[394](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt395(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[395](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt396(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[396](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt397(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[397](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt398(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[398](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt399(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[399](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt400(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[400](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt401(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[401](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt402(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[402](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt403(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[403](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt404(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[404](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt405(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[405](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt406(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[406](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt407(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[407](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt408(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[408](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt409(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[409](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt410(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[410](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt411(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[411](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt412(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[412](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt413(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[413](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt414(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[414](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt415(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[415](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt416(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[416](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt417(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[417](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt418(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[418](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt419(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[419](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt420(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[420](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt421(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[421](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt422(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[422](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt423(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[423](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt424(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[424](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt425(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[425](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt426(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[426](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt427(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[427](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt428(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[428](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt429(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[429](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt430(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[430](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt431(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[431](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt432(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[432](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt433(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[433](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt434(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[434](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt435(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[435](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt436(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[436](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt437(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[437](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt438(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[438](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt439(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[439](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt440(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[440](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt441(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[441](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt442(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[442](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt443(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[443](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt444(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[444](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt445(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[445](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt446(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[446](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt447(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[447](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt448(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[448](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt449(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[449](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt450(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[450](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt451(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[451](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt452(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[452](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt453(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[453](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt454(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[454](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt455(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[455](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt456(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[456](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt457(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[457](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt458(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[458](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt459(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[459](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt460(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[460](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt461(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[461](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt462(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[462](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt463(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[463](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt464(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[464](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt465(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[465](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt466(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[466](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt467(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[467](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt468(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[468](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt469(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[469](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt470(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[470](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt471(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[471](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt472(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[472](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt473(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[473](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt474(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[474](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt475(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[475](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt476(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[476](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt477(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[477](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt478(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[478](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt479(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[479](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt480(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[480](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt481(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[481](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt482(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[482](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt483(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[483](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt484(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[484](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt485(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[485](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt486(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[486](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt487(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[487](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt488(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[488](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt489(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[489](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt490(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[490](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt491(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[491](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt492(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[492](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt493(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[493](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt494(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[494](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt495(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[495](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt496(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[496](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt497(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[497](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt498(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[498](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt499(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[499](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt500(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[500](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt501(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[501](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt502(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[502](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt503(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[503](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt504(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[504](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt505(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[505](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt506(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[506](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt507(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[507](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt508(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[508](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt509(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[509](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt510(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[510](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt511(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[511](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt512(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[512](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt513(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[513](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt514(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[514](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt515(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[515](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt516(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[516](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt517(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[517](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt518(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[518](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt519(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[519](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt520(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[520](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt521(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[521](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt522(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[522](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt523(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[523](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt524(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[524](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt525(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[525](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt526(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[526](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt527(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[527](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt528(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[528](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt529(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[529](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt530(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[530](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt531(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[531](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt532(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[532](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt533(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[533](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt534(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[534](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt535(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[535](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt536(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[536](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt537(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[537](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt538(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[538](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt539(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[539](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt540(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[540](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt541(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[541](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt542(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[542](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt543(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[543](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt544(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[544](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt545(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[545](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt546(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[546](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt547(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[547](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt548(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[548](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt549(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[549](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt550(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[550](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt551(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[551](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt552(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[552](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt553(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[553](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt554(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[554](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt555(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[555](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt556(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[556](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt557(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[557](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt558(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[558](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt559(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[559](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt560(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[560](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt561(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[561](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt562(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[562](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt563(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[563](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt564(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[564](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt565(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[565](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt566(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[566](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt567(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[567](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt568(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[568](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt569(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[569](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt570(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[570](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt571(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[571](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt572(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[572](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt573(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[573](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt574(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[574](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt575(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[575](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt576(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[576](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt577(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[577](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt578(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[578](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt579(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[579](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt580(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[580](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt581(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[581](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt582(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[582](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt583(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[583](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt584(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[584](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt585(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[585](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt586(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[586](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt587(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[587](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt588(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[588](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt589(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[589](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt590(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[590](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt591(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[591](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt592(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[592](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt593(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[593](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt594(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[594](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt595(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[595](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt596(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[596](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt597(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[597](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt598(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[598](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt599(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[599](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt600(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[600](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt601(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[601](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt602(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[602](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt603(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[603](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt604(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[604](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt605(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[605](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt606(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[606](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt607(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[607](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt608(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[608](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt609(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[609](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt610(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[610](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt611(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[611](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt612(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[612](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt613(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[613](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt614(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[614](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt615(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[615](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt616(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[616](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt617(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[617](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt618(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[618](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt619(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[619](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt620(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[620](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt621(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[621](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt622(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[622](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt623(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[623](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt624(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[624](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt625(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[625](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt626(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[626](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt627(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[627](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt628(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[628](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt629(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[629](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt630(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[630](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt631(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[631](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt632(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[632](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt633(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[633](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt634(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[634](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt635(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[635](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt636(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[636](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt637(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[637](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt638(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[638](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt639(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[639](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt640(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[640](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt641(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[641](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt642(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[642](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt643(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[643](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt644(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[644](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt645(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[645](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt646(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[646](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt647(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[647](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt648(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[648](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt649(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[649](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt650(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[650](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt651(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[651](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt652(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[652](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt653(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[653](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt654(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[654](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt655(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[655](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt656(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[656](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt657(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[657](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt658(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[658](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt659(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[659](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt660(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[660](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt661(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[661](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt662(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[662](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt663(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[663](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt664(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[664](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt665(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[665](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt666(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[666](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt667(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[667](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt668(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[668](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt669(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[669](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt670(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[670](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt671(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[671](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt672(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[672](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt673(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[673](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt674(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[674](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt675(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[675](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt676(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[676](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt677(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[677](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt678(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[678](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt679(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[679](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt680(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[680](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt681(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[681](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt682(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[682](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt683(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[683](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt684(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[684](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt685(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[685](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt686(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[686](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt687(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[687](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt688(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[688](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt689(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[689](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt690(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[690](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt691(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[691](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt692(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[692](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt693(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[693](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt694(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[694](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt695(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[695](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt696(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[696](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt697(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[697](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt698(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[698](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt699(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[699](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt700(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[700](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt701(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[701](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt702(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[702](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt703(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[703](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt704(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[704](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt705(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[705](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt706(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[706](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt707(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[707](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt708(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[708](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt709(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[709](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt710(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[710](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt711(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[711](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt712(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[712](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt713(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[713](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt714(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[714](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt715(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[715](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt716(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[716](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt717(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[717](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt718(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[718](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt719(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[719](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt720(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[720](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt721(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[721](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt722(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[722](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt723(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[723](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt724(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[724](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt725(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[725](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt726(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[726](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt727(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[727](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt728(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[728](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt729(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[729](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt730(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[730](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt731(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[731](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt732(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[732](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt733(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[733](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt734(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[734](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt735(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[735](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt736(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[736](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt737(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[737](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt738(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[738](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt739(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[739](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt740(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[740](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt741(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[741](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt742(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[742](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt743(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[743](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt744(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[744](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt745(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[745](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt746(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[746](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt747(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[747](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt748(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[748](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt749(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[749](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt750(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[750](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt751(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[751](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt752(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[752](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt753(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[753](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt754(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[754](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt755(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[755](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt756(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[756](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt757(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[757](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt758(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[758](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt759(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[759](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt760(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[760](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt761(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[761](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt762(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[762](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt763(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[763](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt764(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[764](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt765(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[765](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt766(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[766](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt767(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[767](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt768(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[768](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt769(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[769](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt770(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[770](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt771(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[771](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt772(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[772](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt773(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[773](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt774(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[774](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt775(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[775](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt776(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[776](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt777(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[777](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt778(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[778](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt779(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[779](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt780(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[780](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt781(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[781](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt782(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[782](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt783(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[783](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt784(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[784](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt785(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[785](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt786(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[786](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt787(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[787](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt788(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[788](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt789(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[789](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt790(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[790](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt791(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[791](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt792(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[792](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt793(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[793](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt794(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[794](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt795(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[795](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt796(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[796](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt797(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[797](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt798(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[798](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt799(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[799](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt800(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[800](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt801(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[801](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt802(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[802](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt803(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[803](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt804(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[804](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt805(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[805](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt806(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[806](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt807(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[807](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt808(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[808](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt809(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[809](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt810(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[810](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt811(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[811](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt812(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[812](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt813(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[813](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt814(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[814](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt815(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[815](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt816(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[816](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt817(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[817](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt818(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[818](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt819(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[819](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt820(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[820](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt821(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[821](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt822(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[822](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt823(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[823](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt824(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[824](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt825(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[825](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt826(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[826](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt827(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[827](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt828(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[828](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt829(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[829](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt830(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[830](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt831(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[831](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt832(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[832](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt833(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[833](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt834(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[834](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt835(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[835](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt836(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[836](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt837(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[837](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt838(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[838](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt839(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[839](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt840(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[840](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt841(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[841](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt842(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[842](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt843(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[843](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt844(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[844](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt845(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[845](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt846(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[846](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt847(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[847](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt848(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[848](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt849(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[849](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt850(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[850](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt851(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[851](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt852(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[852](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt853(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[853](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt854(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[854](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt855(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[855](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt856(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[856](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt857(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[857](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt858(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[858](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt859(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[859](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt860(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[860](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt861(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[861](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt862(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[862](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt863(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[863](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt864(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[864](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt865(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[865](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt866(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[866](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt867(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[867](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt868(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[868](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt869(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[869](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt870(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[870](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt871(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[871](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt872(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[872](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt873(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[873](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt874(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[874](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt875(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[875](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt876(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[876](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt877(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[877](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt878(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[878](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt879(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[879](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt880(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[880](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt881(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[881](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt882(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[882](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt883(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[883](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt884(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[884](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt885(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[885](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt886(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[886](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt887(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[887](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt888(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[888](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt889(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[889](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt890(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[890](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt891(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[891](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt892(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[892](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt893(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[893](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt894(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[894](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt895(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[895](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt896(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[896](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt897(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[897](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt898(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[898](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt899(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[899](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt900(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[900](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt901(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[901](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt902(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[902](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt903(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[903](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt904(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[904](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt905(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[905](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt906(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[906](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt907(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[907](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt908(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[908](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt909(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[909](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt910(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[910](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt911(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[911](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt912(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[912](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt913(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[913](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt914(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[914](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt915(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[915](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt916(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[916](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt917(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[917](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt918(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[918](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt919(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[919](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt920(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[920](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt921(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[921](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt922(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[922](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt923(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[923](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt924(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[924](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt925(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[925](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt926(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[926](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt927(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[927](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt928(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[928](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt929(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[929](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt930(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[930](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt931(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[931](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt932(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[932](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt933(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[933](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt934(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[934](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt935(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[935](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt936(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[936](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt937(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[937](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt938(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[938](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt939(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[939](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt940(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[940](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt941(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[941](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt942(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[942](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt943(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[943](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt944(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[944](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt945(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[945](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt946(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[946](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt947(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[947](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt948(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[948](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt949(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[949](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt950(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[950](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt951(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[951](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt952(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[952](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt953(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[953](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt954(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[954](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt955(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[955](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt956(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[956](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt957(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[957](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt958(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[958](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt959(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[959](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt960(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[960](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt961(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[961](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt962(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[962](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt963(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[963](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt964(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[964](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt965(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[965](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt966(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[966](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt967(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[967](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt968(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[968](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt969(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[969](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt970(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[970](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt971(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[971](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt972(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[972](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt973(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[973](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt974(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[974](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt975(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[975](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt976(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[976](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt977(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[977](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt978(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[978](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt979(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[979](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt980(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[980](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt981(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[981](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt982(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[982](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt983(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[983](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt984(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[984](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt985(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[985](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt986(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[986](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt987(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[987](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt988(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[988](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt989(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[989](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt990(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[990](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt991(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[991](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt992(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[992](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt993(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[993](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt994(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[994](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt995(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[995](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt996(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[996](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt997(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[997](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt998(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[998](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt999(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[999](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1000(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1000](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1001(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1001](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1002(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1002](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1003(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1003](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1004(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1004](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1005(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1005](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1006(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1006](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1007(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1007](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1008(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1008](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1009(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1009](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1010(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1010](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1011(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1011](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1012(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1012](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1013(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1013](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1014(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1014](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1015(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1015](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1016(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1016](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1017(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1017](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1018(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1018](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1019(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1019](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1020(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1020](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1021(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1021](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1022(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1022](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1023(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1023](device);
+}
+
 void *loader_get_dev_ext_trampoline(uint32_t index) {
     switch (index) {
     case 0:
@@ -2026,6 +6675,1554 @@ void *loader_get_dev_ext_trampoline(uint32_t index) {
         return vkDevExt248;
     case 249:
         return vkDevExt249;
+    case 250:
+        return vkDevExt250;
+    case 251:
+        return vkDevExt251;
+    case 252:
+        return vkDevExt252;
+    case 253:
+        return vkDevExt253;
+    case 254:
+        return vkDevExt254;
+    case 255:
+        return vkDevExt255;
+    case 256:
+        return vkDevExt256;
+    case 257:
+        return vkDevExt257;
+    case 258:
+        return vkDevExt258;
+    case 259:
+        return vkDevExt259;
+    case 260:
+        return vkDevExt260;
+    case 261:
+        return vkDevExt261;
+    case 262:
+        return vkDevExt262;
+    case 263:
+        return vkDevExt263;
+    case 264:
+        return vkDevExt264;
+    case 265:
+        return vkDevExt265;
+    case 266:
+        return vkDevExt266;
+    case 267:
+        return vkDevExt267;
+    case 268:
+        return vkDevExt268;
+    case 269:
+        return vkDevExt269;
+    case 270:
+        return vkDevExt270;
+    case 271:
+        return vkDevExt271;
+    case 272:
+        return vkDevExt272;
+    case 273:
+        return vkDevExt273;
+    case 274:
+        return vkDevExt274;
+    case 275:
+        return vkDevExt275;
+    case 276:
+        return vkDevExt276;
+    case 277:
+        return vkDevExt277;
+    case 278:
+        return vkDevExt278;
+    case 279:
+        return vkDevExt279;
+    case 280:
+        return vkDevExt280;
+    case 281:
+        return vkDevExt281;
+    case 282:
+        return vkDevExt282;
+    case 283:
+        return vkDevExt283;
+    case 284:
+        return vkDevExt284;
+    case 285:
+        return vkDevExt285;
+    case 286:
+        return vkDevExt286;
+    case 287:
+        return vkDevExt287;
+    case 288:
+        return vkDevExt288;
+    case 289:
+        return vkDevExt289;
+    case 290:
+        return vkDevExt290;
+    case 291:
+        return vkDevExt291;
+    case 292:
+        return vkDevExt292;
+    case 293:
+        return vkDevExt293;
+    case 294:
+        return vkDevExt294;
+    case 295:
+        return vkDevExt295;
+    case 296:
+        return vkDevExt296;
+    case 297:
+        return vkDevExt297;
+    case 298:
+        return vkDevExt298;
+    case 299:
+        return vkDevExt299;
+    case 300:
+        return vkDevExt300;
+    case 301:
+        return vkDevExt301;
+    case 302:
+        return vkDevExt302;
+    case 303:
+        return vkDevExt303;
+    case 304:
+        return vkDevExt304;
+    case 305:
+        return vkDevExt305;
+    case 306:
+        return vkDevExt306;
+    case 307:
+        return vkDevExt307;
+    case 308:
+        return vkDevExt308;
+    case 309:
+        return vkDevExt309;
+    case 310:
+        return vkDevExt310;
+    case 311:
+        return vkDevExt311;
+    case 312:
+        return vkDevExt312;
+    case 313:
+        return vkDevExt313;
+    case 314:
+        return vkDevExt314;
+    case 315:
+        return vkDevExt315;
+    case 316:
+        return vkDevExt316;
+    case 317:
+        return vkDevExt317;
+    case 318:
+        return vkDevExt318;
+    case 319:
+        return vkDevExt319;
+    case 320:
+        return vkDevExt320;
+    case 321:
+        return vkDevExt321;
+    case 322:
+        return vkDevExt322;
+    case 323:
+        return vkDevExt323;
+    case 324:
+        return vkDevExt324;
+    case 325:
+        return vkDevExt325;
+    case 326:
+        return vkDevExt326;
+    case 327:
+        return vkDevExt327;
+    case 328:
+        return vkDevExt328;
+    case 329:
+        return vkDevExt329;
+    case 330:
+        return vkDevExt330;
+    case 331:
+        return vkDevExt331;
+    case 332:
+        return vkDevExt332;
+    case 333:
+        return vkDevExt333;
+    case 334:
+        return vkDevExt334;
+    case 335:
+        return vkDevExt335;
+    case 336:
+        return vkDevExt336;
+    case 337:
+        return vkDevExt337;
+    case 338:
+        return vkDevExt338;
+    case 339:
+        return vkDevExt339;
+    case 340:
+        return vkDevExt340;
+    case 341:
+        return vkDevExt341;
+    case 342:
+        return vkDevExt342;
+    case 343:
+        return vkDevExt343;
+    case 344:
+        return vkDevExt344;
+    case 345:
+        return vkDevExt345;
+    case 346:
+        return vkDevExt346;
+    case 347:
+        return vkDevExt347;
+    case 348:
+        return vkDevExt348;
+    case 349:
+        return vkDevExt349;
+    case 350:
+        return vkDevExt350;
+    case 351:
+        return vkDevExt351;
+    case 352:
+        return vkDevExt352;
+    case 353:
+        return vkDevExt353;
+    case 354:
+        return vkDevExt354;
+    case 355:
+        return vkDevExt355;
+    case 356:
+        return vkDevExt356;
+    case 357:
+        return vkDevExt357;
+    case 358:
+        return vkDevExt358;
+    case 359:
+        return vkDevExt359;
+    case 360:
+        return vkDevExt360;
+    case 361:
+        return vkDevExt361;
+    case 362:
+        return vkDevExt362;
+    case 363:
+        return vkDevExt363;
+    case 364:
+        return vkDevExt364;
+    case 365:
+        return vkDevExt365;
+    case 366:
+        return vkDevExt366;
+    case 367:
+        return vkDevExt367;
+    case 368:
+        return vkDevExt368;
+    case 369:
+        return vkDevExt369;
+    case 370:
+        return vkDevExt370;
+    case 371:
+        return vkDevExt371;
+    case 372:
+        return vkDevExt372;
+    case 373:
+        return vkDevExt373;
+    case 374:
+        return vkDevExt374;
+    case 375:
+        return vkDevExt375;
+    case 376:
+        return vkDevExt376;
+    case 377:
+        return vkDevExt377;
+    case 378:
+        return vkDevExt378;
+    case 379:
+        return vkDevExt379;
+    case 380:
+        return vkDevExt380;
+    case 381:
+        return vkDevExt381;
+    case 382:
+        return vkDevExt382;
+    case 383:
+        return vkDevExt383;
+    case 384:
+        return vkDevExt384;
+    case 385:
+        return vkDevExt385;
+    case 386:
+        return vkDevExt386;
+    case 387:
+        return vkDevExt387;
+    case 388:
+        return vkDevExt388;
+    case 389:
+        return vkDevExt389;
+    case 390:
+        return vkDevExt390;
+    case 391:
+        return vkDevExt391;
+    case 392:
+        return vkDevExt392;
+    case 393:
+        return vkDevExt393;
+    case 394:
+        return vkDevExt394;
+    case 395:
+        return vkDevExt395;
+    case 396:
+        return vkDevExt396;
+    case 397:
+        return vkDevExt397;
+    case 398:
+        return vkDevExt398;
+    case 399:
+        return vkDevExt399;
+    case 400:
+        return vkDevExt400;
+    case 401:
+        return vkDevExt401;
+    case 402:
+        return vkDevExt402;
+    case 403:
+        return vkDevExt403;
+    case 404:
+        return vkDevExt404;
+    case 405:
+        return vkDevExt405;
+    case 406:
+        return vkDevExt406;
+    case 407:
+        return vkDevExt407;
+    case 408:
+        return vkDevExt408;
+    case 409:
+        return vkDevExt409;
+    case 410:
+        return vkDevExt410;
+    case 411:
+        return vkDevExt411;
+    case 412:
+        return vkDevExt412;
+    case 413:
+        return vkDevExt413;
+    case 414:
+        return vkDevExt414;
+    case 415:
+        return vkDevExt415;
+    case 416:
+        return vkDevExt416;
+    case 417:
+        return vkDevExt417;
+    case 418:
+        return vkDevExt418;
+    case 419:
+        return vkDevExt419;
+    case 420:
+        return vkDevExt420;
+    case 421:
+        return vkDevExt421;
+    case 422:
+        return vkDevExt422;
+    case 423:
+        return vkDevExt423;
+    case 424:
+        return vkDevExt424;
+    case 425:
+        return vkDevExt425;
+    case 426:
+        return vkDevExt426;
+    case 427:
+        return vkDevExt427;
+    case 428:
+        return vkDevExt428;
+    case 429:
+        return vkDevExt429;
+    case 430:
+        return vkDevExt430;
+    case 431:
+        return vkDevExt431;
+    case 432:
+        return vkDevExt432;
+    case 433:
+        return vkDevExt433;
+    case 434:
+        return vkDevExt434;
+    case 435:
+        return vkDevExt435;
+    case 436:
+        return vkDevExt436;
+    case 437:
+        return vkDevExt437;
+    case 438:
+        return vkDevExt438;
+    case 439:
+        return vkDevExt439;
+    case 440:
+        return vkDevExt440;
+    case 441:
+        return vkDevExt441;
+    case 442:
+        return vkDevExt442;
+    case 443:
+        return vkDevExt443;
+    case 444:
+        return vkDevExt444;
+    case 445:
+        return vkDevExt445;
+    case 446:
+        return vkDevExt446;
+    case 447:
+        return vkDevExt447;
+    case 448:
+        return vkDevExt448;
+    case 449:
+        return vkDevExt449;
+    case 450:
+        return vkDevExt450;
+    case 451:
+        return vkDevExt451;
+    case 452:
+        return vkDevExt452;
+    case 453:
+        return vkDevExt453;
+    case 454:
+        return vkDevExt454;
+    case 455:
+        return vkDevExt455;
+    case 456:
+        return vkDevExt456;
+    case 457:
+        return vkDevExt457;
+    case 458:
+        return vkDevExt458;
+    case 459:
+        return vkDevExt459;
+    case 460:
+        return vkDevExt460;
+    case 461:
+        return vkDevExt461;
+    case 462:
+        return vkDevExt462;
+    case 463:
+        return vkDevExt463;
+    case 464:
+        return vkDevExt464;
+    case 465:
+        return vkDevExt465;
+    case 466:
+        return vkDevExt466;
+    case 467:
+        return vkDevExt467;
+    case 468:
+        return vkDevExt468;
+    case 469:
+        return vkDevExt469;
+    case 470:
+        return vkDevExt470;
+    case 471:
+        return vkDevExt471;
+    case 472:
+        return vkDevExt472;
+    case 473:
+        return vkDevExt473;
+    case 474:
+        return vkDevExt474;
+    case 475:
+        return vkDevExt475;
+    case 476:
+        return vkDevExt476;
+    case 477:
+        return vkDevExt477;
+    case 478:
+        return vkDevExt478;
+    case 479:
+        return vkDevExt479;
+    case 480:
+        return vkDevExt480;
+    case 481:
+        return vkDevExt481;
+    case 482:
+        return vkDevExt482;
+    case 483:
+        return vkDevExt483;
+    case 484:
+        return vkDevExt484;
+    case 485:
+        return vkDevExt485;
+    case 486:
+        return vkDevExt486;
+    case 487:
+        return vkDevExt487;
+    case 488:
+        return vkDevExt488;
+    case 489:
+        return vkDevExt489;
+    case 490:
+        return vkDevExt490;
+    case 491:
+        return vkDevExt491;
+    case 492:
+        return vkDevExt492;
+    case 493:
+        return vkDevExt493;
+    case 494:
+        return vkDevExt494;
+    case 495:
+        return vkDevExt495;
+    case 496:
+        return vkDevExt496;
+    case 497:
+        return vkDevExt497;
+    case 498:
+        return vkDevExt498;
+    case 499:
+        return vkDevExt499;
+    case 500:
+        return vkDevExt500;
+    case 501:
+        return vkDevExt501;
+    case 502:
+        return vkDevExt502;
+    case 503:
+        return vkDevExt503;
+    case 504:
+        return vkDevExt504;
+    case 505:
+        return vkDevExt505;
+    case 506:
+        return vkDevExt506;
+    case 507:
+        return vkDevExt507;
+    case 508:
+        return vkDevExt508;
+    case 509:
+        return vkDevExt509;
+    case 510:
+        return vkDevExt510;
+    case 511:
+        return vkDevExt511;
+    case 512:
+        return vkDevExt512;
+    case 513:
+        return vkDevExt513;
+    case 514:
+        return vkDevExt514;
+    case 515:
+        return vkDevExt515;
+    case 516:
+        return vkDevExt516;
+    case 517:
+        return vkDevExt517;
+    case 518:
+        return vkDevExt518;
+    case 519:
+        return vkDevExt519;
+    case 520:
+        return vkDevExt520;
+    case 521:
+        return vkDevExt521;
+    case 522:
+        return vkDevExt522;
+    case 523:
+        return vkDevExt523;
+    case 524:
+        return vkDevExt524;
+    case 525:
+        return vkDevExt525;
+    case 526:
+        return vkDevExt526;
+    case 527:
+        return vkDevExt527;
+    case 528:
+        return vkDevExt528;
+    case 529:
+        return vkDevExt529;
+    case 530:
+        return vkDevExt530;
+    case 531:
+        return vkDevExt531;
+    case 532:
+        return vkDevExt532;
+    case 533:
+        return vkDevExt533;
+    case 534:
+        return vkDevExt534;
+    case 535:
+        return vkDevExt535;
+    case 536:
+        return vkDevExt536;
+    case 537:
+        return vkDevExt537;
+    case 538:
+        return vkDevExt538;
+    case 539:
+        return vkDevExt539;
+    case 540:
+        return vkDevExt540;
+    case 541:
+        return vkDevExt541;
+    case 542:
+        return vkDevExt542;
+    case 543:
+        return vkDevExt543;
+    case 544:
+        return vkDevExt544;
+    case 545:
+        return vkDevExt545;
+    case 546:
+        return vkDevExt546;
+    case 547:
+        return vkDevExt547;
+    case 548:
+        return vkDevExt548;
+    case 549:
+        return vkDevExt549;
+    case 550:
+        return vkDevExt550;
+    case 551:
+        return vkDevExt551;
+    case 552:
+        return vkDevExt552;
+    case 553:
+        return vkDevExt553;
+    case 554:
+        return vkDevExt554;
+    case 555:
+        return vkDevExt555;
+    case 556:
+        return vkDevExt556;
+    case 557:
+        return vkDevExt557;
+    case 558:
+        return vkDevExt558;
+    case 559:
+        return vkDevExt559;
+    case 560:
+        return vkDevExt560;
+    case 561:
+        return vkDevExt561;
+    case 562:
+        return vkDevExt562;
+    case 563:
+        return vkDevExt563;
+    case 564:
+        return vkDevExt564;
+    case 565:
+        return vkDevExt565;
+    case 566:
+        return vkDevExt566;
+    case 567:
+        return vkDevExt567;
+    case 568:
+        return vkDevExt568;
+    case 569:
+        return vkDevExt569;
+    case 570:
+        return vkDevExt570;
+    case 571:
+        return vkDevExt571;
+    case 572:
+        return vkDevExt572;
+    case 573:
+        return vkDevExt573;
+    case 574:
+        return vkDevExt574;
+    case 575:
+        return vkDevExt575;
+    case 576:
+        return vkDevExt576;
+    case 577:
+        return vkDevExt577;
+    case 578:
+        return vkDevExt578;
+    case 579:
+        return vkDevExt579;
+    case 580:
+        return vkDevExt580;
+    case 581:
+        return vkDevExt581;
+    case 582:
+        return vkDevExt582;
+    case 583:
+        return vkDevExt583;
+    case 584:
+        return vkDevExt584;
+    case 585:
+        return vkDevExt585;
+    case 586:
+        return vkDevExt586;
+    case 587:
+        return vkDevExt587;
+    case 588:
+        return vkDevExt588;
+    case 589:
+        return vkDevExt589;
+    case 590:
+        return vkDevExt590;
+    case 591:
+        return vkDevExt591;
+    case 592:
+        return vkDevExt592;
+    case 593:
+        return vkDevExt593;
+    case 594:
+        return vkDevExt594;
+    case 595:
+        return vkDevExt595;
+    case 596:
+        return vkDevExt596;
+    case 597:
+        return vkDevExt597;
+    case 598:
+        return vkDevExt598;
+    case 599:
+        return vkDevExt599;
+    case 600:
+        return vkDevExt600;
+    case 601:
+        return vkDevExt601;
+    case 602:
+        return vkDevExt602;
+    case 603:
+        return vkDevExt603;
+    case 604:
+        return vkDevExt604;
+    case 605:
+        return vkDevExt605;
+    case 606:
+        return vkDevExt606;
+    case 607:
+        return vkDevExt607;
+    case 608:
+        return vkDevExt608;
+    case 609:
+        return vkDevExt609;
+    case 610:
+        return vkDevExt610;
+    case 611:
+        return vkDevExt611;
+    case 612:
+        return vkDevExt612;
+    case 613:
+        return vkDevExt613;
+    case 614:
+        return vkDevExt614;
+    case 615:
+        return vkDevExt615;
+    case 616:
+        return vkDevExt616;
+    case 617:
+        return vkDevExt617;
+    case 618:
+        return vkDevExt618;
+    case 619:
+        return vkDevExt619;
+    case 620:
+        return vkDevExt620;
+    case 621:
+        return vkDevExt621;
+    case 622:
+        return vkDevExt622;
+    case 623:
+        return vkDevExt623;
+    case 624:
+        return vkDevExt624;
+    case 625:
+        return vkDevExt625;
+    case 626:
+        return vkDevExt626;
+    case 627:
+        return vkDevExt627;
+    case 628:
+        return vkDevExt628;
+    case 629:
+        return vkDevExt629;
+    case 630:
+        return vkDevExt630;
+    case 631:
+        return vkDevExt631;
+    case 632:
+        return vkDevExt632;
+    case 633:
+        return vkDevExt633;
+    case 634:
+        return vkDevExt634;
+    case 635:
+        return vkDevExt635;
+    case 636:
+        return vkDevExt636;
+    case 637:
+        return vkDevExt637;
+    case 638:
+        return vkDevExt638;
+    case 639:
+        return vkDevExt639;
+    case 640:
+        return vkDevExt640;
+    case 641:
+        return vkDevExt641;
+    case 642:
+        return vkDevExt642;
+    case 643:
+        return vkDevExt643;
+    case 644:
+        return vkDevExt644;
+    case 645:
+        return vkDevExt645;
+    case 646:
+        return vkDevExt646;
+    case 647:
+        return vkDevExt647;
+    case 648:
+        return vkDevExt648;
+    case 649:
+        return vkDevExt649;
+    case 650:
+        return vkDevExt650;
+    case 651:
+        return vkDevExt651;
+    case 652:
+        return vkDevExt652;
+    case 653:
+        return vkDevExt653;
+    case 654:
+        return vkDevExt654;
+    case 655:
+        return vkDevExt655;
+    case 656:
+        return vkDevExt656;
+    case 657:
+        return vkDevExt657;
+    case 658:
+        return vkDevExt658;
+    case 659:
+        return vkDevExt659;
+    case 660:
+        return vkDevExt660;
+    case 661:
+        return vkDevExt661;
+    case 662:
+        return vkDevExt662;
+    case 663:
+        return vkDevExt663;
+    case 664:
+        return vkDevExt664;
+    case 665:
+        return vkDevExt665;
+    case 666:
+        return vkDevExt666;
+    case 667:
+        return vkDevExt667;
+    case 668:
+        return vkDevExt668;
+    case 669:
+        return vkDevExt669;
+    case 670:
+        return vkDevExt670;
+    case 671:
+        return vkDevExt671;
+    case 672:
+        return vkDevExt672;
+    case 673:
+        return vkDevExt673;
+    case 674:
+        return vkDevExt674;
+    case 675:
+        return vkDevExt675;
+    case 676:
+        return vkDevExt676;
+    case 677:
+        return vkDevExt677;
+    case 678:
+        return vkDevExt678;
+    case 679:
+        return vkDevExt679;
+    case 680:
+        return vkDevExt680;
+    case 681:
+        return vkDevExt681;
+    case 682:
+        return vkDevExt682;
+    case 683:
+        return vkDevExt683;
+    case 684:
+        return vkDevExt684;
+    case 685:
+        return vkDevExt685;
+    case 686:
+        return vkDevExt686;
+    case 687:
+        return vkDevExt687;
+    case 688:
+        return vkDevExt688;
+    case 689:
+        return vkDevExt689;
+    case 690:
+        return vkDevExt690;
+    case 691:
+        return vkDevExt691;
+    case 692:
+        return vkDevExt692;
+    case 693:
+        return vkDevExt693;
+    case 694:
+        return vkDevExt694;
+    case 695:
+        return vkDevExt695;
+    case 696:
+        return vkDevExt696;
+    case 697:
+        return vkDevExt697;
+    case 698:
+        return vkDevExt698;
+    case 699:
+        return vkDevExt699;
+    case 700:
+        return vkDevExt700;
+    case 701:
+        return vkDevExt701;
+    case 702:
+        return vkDevExt702;
+    case 703:
+        return vkDevExt703;
+    case 704:
+        return vkDevExt704;
+    case 705:
+        return vkDevExt705;
+    case 706:
+        return vkDevExt706;
+    case 707:
+        return vkDevExt707;
+    case 708:
+        return vkDevExt708;
+    case 709:
+        return vkDevExt709;
+    case 710:
+        return vkDevExt710;
+    case 711:
+        return vkDevExt711;
+    case 712:
+        return vkDevExt712;
+    case 713:
+        return vkDevExt713;
+    case 714:
+        return vkDevExt714;
+    case 715:
+        return vkDevExt715;
+    case 716:
+        return vkDevExt716;
+    case 717:
+        return vkDevExt717;
+    case 718:
+        return vkDevExt718;
+    case 719:
+        return vkDevExt719;
+    case 720:
+        return vkDevExt720;
+    case 721:
+        return vkDevExt721;
+    case 722:
+        return vkDevExt722;
+    case 723:
+        return vkDevExt723;
+    case 724:
+        return vkDevExt724;
+    case 725:
+        return vkDevExt725;
+    case 726:
+        return vkDevExt726;
+    case 727:
+        return vkDevExt727;
+    case 728:
+        return vkDevExt728;
+    case 729:
+        return vkDevExt729;
+    case 730:
+        return vkDevExt730;
+    case 731:
+        return vkDevExt731;
+    case 732:
+        return vkDevExt732;
+    case 733:
+        return vkDevExt733;
+    case 734:
+        return vkDevExt734;
+    case 735:
+        return vkDevExt735;
+    case 736:
+        return vkDevExt736;
+    case 737:
+        return vkDevExt737;
+    case 738:
+        return vkDevExt738;
+    case 739:
+        return vkDevExt739;
+    case 740:
+        return vkDevExt740;
+    case 741:
+        return vkDevExt741;
+    case 742:
+        return vkDevExt742;
+    case 743:
+        return vkDevExt743;
+    case 744:
+        return vkDevExt744;
+    case 745:
+        return vkDevExt745;
+    case 746:
+        return vkDevExt746;
+    case 747:
+        return vkDevExt747;
+    case 748:
+        return vkDevExt748;
+    case 749:
+        return vkDevExt749;
+    case 750:
+        return vkDevExt750;
+    case 751:
+        return vkDevExt751;
+    case 752:
+        return vkDevExt752;
+    case 753:
+        return vkDevExt753;
+    case 754:
+        return vkDevExt754;
+    case 755:
+        return vkDevExt755;
+    case 756:
+        return vkDevExt756;
+    case 757:
+        return vkDevExt757;
+    case 758:
+        return vkDevExt758;
+    case 759:
+        return vkDevExt759;
+    case 760:
+        return vkDevExt760;
+    case 761:
+        return vkDevExt761;
+    case 762:
+        return vkDevExt762;
+    case 763:
+        return vkDevExt763;
+    case 764:
+        return vkDevExt764;
+    case 765:
+        return vkDevExt765;
+    case 766:
+        return vkDevExt766;
+    case 767:
+        return vkDevExt767;
+    case 768:
+        return vkDevExt768;
+    case 769:
+        return vkDevExt769;
+    case 770:
+        return vkDevExt770;
+    case 771:
+        return vkDevExt771;
+    case 772:
+        return vkDevExt772;
+    case 773:
+        return vkDevExt773;
+    case 774:
+        return vkDevExt774;
+    case 775:
+        return vkDevExt775;
+    case 776:
+        return vkDevExt776;
+    case 777:
+        return vkDevExt777;
+    case 778:
+        return vkDevExt778;
+    case 779:
+        return vkDevExt779;
+    case 780:
+        return vkDevExt780;
+    case 781:
+        return vkDevExt781;
+    case 782:
+        return vkDevExt782;
+    case 783:
+        return vkDevExt783;
+    case 784:
+        return vkDevExt784;
+    case 785:
+        return vkDevExt785;
+    case 786:
+        return vkDevExt786;
+    case 787:
+        return vkDevExt787;
+    case 788:
+        return vkDevExt788;
+    case 789:
+        return vkDevExt789;
+    case 790:
+        return vkDevExt790;
+    case 791:
+        return vkDevExt791;
+    case 792:
+        return vkDevExt792;
+    case 793:
+        return vkDevExt793;
+    case 794:
+        return vkDevExt794;
+    case 795:
+        return vkDevExt795;
+    case 796:
+        return vkDevExt796;
+    case 797:
+        return vkDevExt797;
+    case 798:
+        return vkDevExt798;
+    case 799:
+        return vkDevExt799;
+    case 800:
+        return vkDevExt800;
+    case 801:
+        return vkDevExt801;
+    case 802:
+        return vkDevExt802;
+    case 803:
+        return vkDevExt803;
+    case 804:
+        return vkDevExt804;
+    case 805:
+        return vkDevExt805;
+    case 806:
+        return vkDevExt806;
+    case 807:
+        return vkDevExt807;
+    case 808:
+        return vkDevExt808;
+    case 809:
+        return vkDevExt809;
+    case 810:
+        return vkDevExt810;
+    case 811:
+        return vkDevExt811;
+    case 812:
+        return vkDevExt812;
+    case 813:
+        return vkDevExt813;
+    case 814:
+        return vkDevExt814;
+    case 815:
+        return vkDevExt815;
+    case 816:
+        return vkDevExt816;
+    case 817:
+        return vkDevExt817;
+    case 818:
+        return vkDevExt818;
+    case 819:
+        return vkDevExt819;
+    case 820:
+        return vkDevExt820;
+    case 821:
+        return vkDevExt821;
+    case 822:
+        return vkDevExt822;
+    case 823:
+        return vkDevExt823;
+    case 824:
+        return vkDevExt824;
+    case 825:
+        return vkDevExt825;
+    case 826:
+        return vkDevExt826;
+    case 827:
+        return vkDevExt827;
+    case 828:
+        return vkDevExt828;
+    case 829:
+        return vkDevExt829;
+    case 830:
+        return vkDevExt830;
+    case 831:
+        return vkDevExt831;
+    case 832:
+        return vkDevExt832;
+    case 833:
+        return vkDevExt833;
+    case 834:
+        return vkDevExt834;
+    case 835:
+        return vkDevExt835;
+    case 836:
+        return vkDevExt836;
+    case 837:
+        return vkDevExt837;
+    case 838:
+        return vkDevExt838;
+    case 839:
+        return vkDevExt839;
+    case 840:
+        return vkDevExt840;
+    case 841:
+        return vkDevExt841;
+    case 842:
+        return vkDevExt842;
+    case 843:
+        return vkDevExt843;
+    case 844:
+        return vkDevExt844;
+    case 845:
+        return vkDevExt845;
+    case 846:
+        return vkDevExt846;
+    case 847:
+        return vkDevExt847;
+    case 848:
+        return vkDevExt848;
+    case 849:
+        return vkDevExt849;
+    case 850:
+        return vkDevExt850;
+    case 851:
+        return vkDevExt851;
+    case 852:
+        return vkDevExt852;
+    case 853:
+        return vkDevExt853;
+    case 854:
+        return vkDevExt854;
+    case 855:
+        return vkDevExt855;
+    case 856:
+        return vkDevExt856;
+    case 857:
+        return vkDevExt857;
+    case 858:
+        return vkDevExt858;
+    case 859:
+        return vkDevExt859;
+    case 860:
+        return vkDevExt860;
+    case 861:
+        return vkDevExt861;
+    case 862:
+        return vkDevExt862;
+    case 863:
+        return vkDevExt863;
+    case 864:
+        return vkDevExt864;
+    case 865:
+        return vkDevExt865;
+    case 866:
+        return vkDevExt866;
+    case 867:
+        return vkDevExt867;
+    case 868:
+        return vkDevExt868;
+    case 869:
+        return vkDevExt869;
+    case 870:
+        return vkDevExt870;
+    case 871:
+        return vkDevExt871;
+    case 872:
+        return vkDevExt872;
+    case 873:
+        return vkDevExt873;
+    case 874:
+        return vkDevExt874;
+    case 875:
+        return vkDevExt875;
+    case 876:
+        return vkDevExt876;
+    case 877:
+        return vkDevExt877;
+    case 878:
+        return vkDevExt878;
+    case 879:
+        return vkDevExt879;
+    case 880:
+        return vkDevExt880;
+    case 881:
+        return vkDevExt881;
+    case 882:
+        return vkDevExt882;
+    case 883:
+        return vkDevExt883;
+    case 884:
+        return vkDevExt884;
+    case 885:
+        return vkDevExt885;
+    case 886:
+        return vkDevExt886;
+    case 887:
+        return vkDevExt887;
+    case 888:
+        return vkDevExt888;
+    case 889:
+        return vkDevExt889;
+    case 890:
+        return vkDevExt890;
+    case 891:
+        return vkDevExt891;
+    case 892:
+        return vkDevExt892;
+    case 893:
+        return vkDevExt893;
+    case 894:
+        return vkDevExt894;
+    case 895:
+        return vkDevExt895;
+    case 896:
+        return vkDevExt896;
+    case 897:
+        return vkDevExt897;
+    case 898:
+        return vkDevExt898;
+    case 899:
+        return vkDevExt899;
+    case 900:
+        return vkDevExt900;
+    case 901:
+        return vkDevExt901;
+    case 902:
+        return vkDevExt902;
+    case 903:
+        return vkDevExt903;
+    case 904:
+        return vkDevExt904;
+    case 905:
+        return vkDevExt905;
+    case 906:
+        return vkDevExt906;
+    case 907:
+        return vkDevExt907;
+    case 908:
+        return vkDevExt908;
+    case 909:
+        return vkDevExt909;
+    case 910:
+        return vkDevExt910;
+    case 911:
+        return vkDevExt911;
+    case 912:
+        return vkDevExt912;
+    case 913:
+        return vkDevExt913;
+    case 914:
+        return vkDevExt914;
+    case 915:
+        return vkDevExt915;
+    case 916:
+        return vkDevExt916;
+    case 917:
+        return vkDevExt917;
+    case 918:
+        return vkDevExt918;
+    case 919:
+        return vkDevExt919;
+    case 920:
+        return vkDevExt920;
+    case 921:
+        return vkDevExt921;
+    case 922:
+        return vkDevExt922;
+    case 923:
+        return vkDevExt923;
+    case 924:
+        return vkDevExt924;
+    case 925:
+        return vkDevExt925;
+    case 926:
+        return vkDevExt926;
+    case 927:
+        return vkDevExt927;
+    case 928:
+        return vkDevExt928;
+    case 929:
+        return vkDevExt929;
+    case 930:
+        return vkDevExt930;
+    case 931:
+        return vkDevExt931;
+    case 932:
+        return vkDevExt932;
+    case 933:
+        return vkDevExt933;
+    case 934:
+        return vkDevExt934;
+    case 935:
+        return vkDevExt935;
+    case 936:
+        return vkDevExt936;
+    case 937:
+        return vkDevExt937;
+    case 938:
+        return vkDevExt938;
+    case 939:
+        return vkDevExt939;
+    case 940:
+        return vkDevExt940;
+    case 941:
+        return vkDevExt941;
+    case 942:
+        return vkDevExt942;
+    case 943:
+        return vkDevExt943;
+    case 944:
+        return vkDevExt944;
+    case 945:
+        return vkDevExt945;
+    case 946:
+        return vkDevExt946;
+    case 947:
+        return vkDevExt947;
+    case 948:
+        return vkDevExt948;
+    case 949:
+        return vkDevExt949;
+    case 950:
+        return vkDevExt950;
+    case 951:
+        return vkDevExt951;
+    case 952:
+        return vkDevExt952;
+    case 953:
+        return vkDevExt953;
+    case 954:
+        return vkDevExt954;
+    case 955:
+        return vkDevExt955;
+    case 956:
+        return vkDevExt956;
+    case 957:
+        return vkDevExt957;
+    case 958:
+        return vkDevExt958;
+    case 959:
+        return vkDevExt959;
+    case 960:
+        return vkDevExt960;
+    case 961:
+        return vkDevExt961;
+    case 962:
+        return vkDevExt962;
+    case 963:
+        return vkDevExt963;
+    case 964:
+        return vkDevExt964;
+    case 965:
+        return vkDevExt965;
+    case 966:
+        return vkDevExt966;
+    case 967:
+        return vkDevExt967;
+    case 968:
+        return vkDevExt968;
+    case 969:
+        return vkDevExt969;
+    case 970:
+        return vkDevExt970;
+    case 971:
+        return vkDevExt971;
+    case 972:
+        return vkDevExt972;
+    case 973:
+        return vkDevExt973;
+    case 974:
+        return vkDevExt974;
+    case 975:
+        return vkDevExt975;
+    case 976:
+        return vkDevExt976;
+    case 977:
+        return vkDevExt977;
+    case 978:
+        return vkDevExt978;
+    case 979:
+        return vkDevExt979;
+    case 980:
+        return vkDevExt980;
+    case 981:
+        return vkDevExt981;
+    case 982:
+        return vkDevExt982;
+    case 983:
+        return vkDevExt983;
+    case 984:
+        return vkDevExt984;
+    case 985:
+        return vkDevExt985;
+    case 986:
+        return vkDevExt986;
+    case 987:
+        return vkDevExt987;
+    case 988:
+        return vkDevExt988;
+    case 989:
+        return vkDevExt989;
+    case 990:
+        return vkDevExt990;
+    case 991:
+        return vkDevExt991;
+    case 992:
+        return vkDevExt992;
+    case 993:
+        return vkDevExt993;
+    case 994:
+        return vkDevExt994;
+    case 995:
+        return vkDevExt995;
+    case 996:
+        return vkDevExt996;
+    case 997:
+        return vkDevExt997;
+    case 998:
+        return vkDevExt998;
+    case 999:
+        return vkDevExt999;
+    case 1000:
+        return vkDevExt1000;
+    case 1001:
+        return vkDevExt1001;
+    case 1002:
+        return vkDevExt1002;
+    case 1003:
+        return vkDevExt1003;
+    case 1004:
+        return vkDevExt1004;
+    case 1005:
+        return vkDevExt1005;
+    case 1006:
+        return vkDevExt1006;
+    case 1007:
+        return vkDevExt1007;
+    case 1008:
+        return vkDevExt1008;
+    case 1009:
+        return vkDevExt1009;
+    case 1010:
+        return vkDevExt1010;
+    case 1011:
+        return vkDevExt1011;
+    case 1012:
+        return vkDevExt1012;
+    case 1013:
+        return vkDevExt1013;
+    case 1014:
+        return vkDevExt1014;
+    case 1015:
+        return vkDevExt1015;
+    case 1016:
+        return vkDevExt1016;
+    case 1017:
+        return vkDevExt1017;
+    case 1018:
+        return vkDevExt1018;
+    case 1019:
+        return vkDevExt1019;
+    case 1020:
+        return vkDevExt1020;
+    case 1021:
+        return vkDevExt1021;
+    case 1022:
+        return vkDevExt1022;
+    case 1023:
+        return vkDevExt1023;
     }
     return NULL;
 }
@@ -21,280 +21,283 @@
 
 #include <string.h>
 #include "debug_report.h"
+#include "vk_entrypoint_hash.h"
 #include "wsi.h"
 
 static inline void *trampolineGetProcAddr(struct loader_instance *inst,
                                           const char *funcName) {
     // Don't include or check global functions
-    if (!strcmp(funcName, "vkGetInstanceProcAddr"))
+    switch (vk_get_entrypoint_id(funcName)) {
+    case VK_ENTRYPOINT_GetInstanceProcAddr:
         return (PFN_vkVoidFunction)vkGetInstanceProcAddr;
-    if (!strcmp(funcName, "vkDestroyInstance"))
+    case VK_ENTRYPOINT_DestroyInstance:
         return (PFN_vkVoidFunction)vkDestroyInstance;
-    if (!strcmp(funcName, "vkEnumeratePhysicalDevices"))
+    case VK_ENTRYPOINT_EnumeratePhysicalDevices:
         return (PFN_vkVoidFunction)vkEnumeratePhysicalDevices;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceFeatures"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceFeatures:
         return (PFN_vkVoidFunction)vkGetPhysicalDeviceFeatures;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceFormatProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceFormatProperties:
         return (PFN_vkVoidFunction)vkGetPhysicalDeviceFormatProperties;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceImageFormatProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceImageFormatProperties:
         return (PFN_vkVoidFunction)vkGetPhysicalDeviceImageFormatProperties;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceSparseImageFormatProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceSparseImageFormatProperties:
         return (
             PFN_vkVoidFunction)vkGetPhysicalDeviceSparseImageFormatProperties;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceProperties:
         return (PFN_vkVoidFunction)vkGetPhysicalDeviceProperties;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceQueueFamilyProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceQueueFamilyProperties:
         return (PFN_vkVoidFunction)vkGetPhysicalDeviceQueueFamilyProperties;
-    if (!strcmp(funcName, "vkGetPhysicalDeviceMemoryProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceMemoryProperties:
         return (PFN_vkVoidFunction)vkGetPhysicalDeviceMemoryProperties;
-    if (!strcmp(funcName, "vkEnumerateDeviceLayerProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceLayerProperties:
         return (PFN_vkVoidFunction)vkEnumerateDeviceLayerProperties;
-    if (!strcmp(funcName, "vkEnumerateDeviceExtensionProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceExtensionProperties:
         return (PFN_vkVoidFunction)vkEnumerateDeviceExtensionProperties;
-    if (!strcmp(funcName, "vkCreateDevice"))
+    case VK_ENTRYPOINT_CreateDevice:
         return (PFN_vkVoidFunction)vkCreateDevice;
-    if (!strcmp(funcName, "vkGetDeviceProcAddr"))
+    case VK_ENTRYPOINT_GetDeviceProcAddr:
         return (PFN_vkVoidFunction)vkGetDeviceProcAddr;
-    if (!strcmp(funcName, "vkDestroyDevice"))
+    case VK_ENTRYPOINT_DestroyDevice:
         return (PFN_vkVoidFunction)vkDestroyDevice;
-    if (!strcmp(funcName, "vkGetDeviceQueue"))
+    case VK_ENTRYPOINT_GetDeviceQueue:
         return (PFN_vkVoidFunction)vkGetDeviceQueue;
-    if (!strcmp(funcName, "vkQueueSubmit"))
+    case VK_ENTRYPOINT_QueueSubmit:
         return (PFN_vkVoidFunction)vkQueueSubmit;
-    if (!strcmp(funcName, "vkQueueWaitIdle"))
+    case VK_ENTRYPOINT_QueueWaitIdle:
         return (PFN_vkVoidFunction)vkQueueWaitIdle;
-    if (!strcmp(funcName, "vkDeviceWaitIdle"))
+    case VK_ENTRYPOINT_DeviceWaitIdle:
         return (PFN_vkVoidFunction)vkDeviceWaitIdle;
-    if (!strcmp(funcName, "vkAllocateMemory"))
+    case VK_ENTRYPOINT_AllocateMemory:
         return (PFN_vkVoidFunction)vkAllocateMemory;
-    if (!strcmp(funcName, "vkFreeMemory"))
+    case VK_ENTRYPOINT_FreeMemory:
         return (PFN_vkVoidFunction)vkFreeMemory;
-    if (!strcmp(funcName, "vkMapMemory"))
+    case VK_ENTRYPOINT_MapMemory:
         return (PFN_vkVoidFunction)vkMapMemory;
-    if (!strcmp(funcName, "vkUnmapMemory"))
+    case VK_ENTRYPOINT_UnmapMemory:
         return (PFN_vkVoidFunction)vkUnmapMemory;
-    if (!strcmp(funcName, "vkFlushMappedMemoryRanges"))
+    case VK_ENTRYPOINT_FlushMappedMemoryRanges:
         return (PFN_vkVoidFunction)vkFlushMappedMemoryRanges;
-    if (!strcmp(funcName, "vkInvalidateMappedMemoryRanges"))
+    case VK_ENTRYPOINT_InvalidateMappedMemoryRanges:
         return (PFN_vkVoidFunction)vkInvalidateMappedMemoryRanges;
-    if (!strcmp(funcName, "vkGetDeviceMemoryCommitment"))
+    case VK_ENTRYPOINT_GetDeviceMemoryCommitment:
         return (PFN_vkVoidFunction)vkGetDeviceMemoryCommitment;
-    if (!strcmp(funcName, "vkGetImageSparseMemoryRequirements"))
+    case VK_ENTRYPOINT_GetImageSparseMemoryRequirements:
         return (PFN_vkVoidFunction)vkGetImageSparseMemoryRequirements;
-    if (!strcmp(funcName, "vkGetImageMemoryRequirements"))
+    case VK_ENTRYPOINT_GetImageMemoryRequirements:
         return (PFN_vkVoidFunction)vkGetImageMemoryRequirements;
-    if (!strcmp(funcName, "vkGetBufferMemoryRequirements"))
+    case VK_ENTRYPOINT_GetBufferMemoryRequirements:
         return (PFN_vkVoidFunction)vkGetBufferMemoryRequirements;
-    if (!strcmp(funcName, "vkBindImageMemory"))
+    case VK_ENTRYPOINT_BindImageMemory:
         return (PFN_vkVoidFunction)vkBindImageMemory;
-    if (!strcmp(funcName, "vkBindBufferMemory"))
+    case VK_ENTRYPOINT_BindBufferMemory:
         return (PFN_vkVoidFunction)vkBindBufferMemory;
-    if (!strcmp(funcName, "vkQueueBindSparse"))
+    case VK_ENTRYPOINT_QueueBindSparse:
         return (PFN_vkVoidFunction)vkQueueBindSparse;
-    if (!strcmp(funcName, "vkCreateFence"))
+    case VK_ENTRYPOINT_CreateFence:
         return (PFN_vkVoidFunction)vkCreateFence;
-    if (!strcmp(funcName, "vkDestroyFence"))
+    case VK_ENTRYPOINT_DestroyFence:
         return (PFN_vkVoidFunction)vkDestroyFence;
-    if (!strcmp(funcName, "vkGetFenceStatus"))
+    case VK_ENTRYPOINT_GetFenceStatus:
         return (PFN_vkVoidFunction)vkGetFenceStatus;
-    if (!strcmp(funcName, "vkResetFences"))
+    case VK_ENTRYPOINT_ResetFences:
         return (PFN_vkVoidFunction)vkResetFences;
-    if (!strcmp(funcName, "vkWaitForFences"))
+    case VK_ENTRYPOINT_WaitForFences:
         return (PFN_vkVoidFunction)vkWaitForFences;
-    if (!strcmp(funcName, "vkCreateSemaphore"))
+    case VK_ENTRYPOINT_CreateSemaphore:
         return (PFN_vkVoidFunction)vkCreateSemaphore;
-    if (!strcmp(funcName, "vkDestroySemaphore"))
+    case VK_ENTRYPOINT_DestroySemaphore:
         return (PFN_vkVoidFunction)vkDestroySemaphore;
-    if (!strcmp(funcName, "vkCreateEvent"))
+    case VK_ENTRYPOINT_CreateEvent:
         return (PFN_vkVoidFunction)vkCreateEvent;
-    if (!strcmp(funcName, "vkDestroyEvent"))
+    case VK_ENTRYPOINT_DestroyEvent:
         return (PFN_vkVoidFunction)vkDestroyEvent;
-    if (!strcmp(funcName, "vkGetEventStatus"))
+    case VK_ENTRYPOINT_GetEventStatus:
         return (PFN_vkVoidFunction)vkGetEventStatus;
-    if (!strcmp(funcName, "vkSetEvent"))
+    case VK_ENTRYPOINT_SetEvent:
         return (PFN_vkVoidFunction)vkSetEvent;
-    if (!strcmp(funcName, "vkResetEvent"))
+    case VK_ENTRYPOINT_ResetEvent:
         return (PFN_vkVoidFunction)vkResetEvent;
-    if (!strcmp(funcName, "vkCreateQueryPool"))
+    case VK_ENTRYPOINT_CreateQueryPool:
         return (PFN_vkVoidFunction)vkCreateQueryPool;
-    if (!strcmp(funcName, "vkDestroyQueryPool"))
+    case VK_ENTRYPOINT_DestroyQueryPool:
         return (PFN_vkVoidFunction)vkDestroyQueryPool;
-    if (!strcmp(funcName, "vkGetQueryPoolResults"))
+    case VK_ENTRYPOINT_GetQueryPoolResults:
         return (PFN_vkVoidFunction)vkGetQueryPoolResults;
-    if (!strcmp(funcName, "vkCreateBuffer"))
+    case VK_ENTRYPOINT_CreateBuffer:
         return (PFN_vkVoidFunction)vkCreateBuffer;
-    if (!strcmp(funcName, "vkDestroyBuffer"))
+    case VK_ENTRYPOINT_DestroyBuffer:
         return (PFN_vkVoidFunction)vkDestroyBuffer;
-    if (!strcmp(funcName, "vkCreateBufferView"))
+    case VK_ENTRYPOINT_CreateBufferView:
         return (PFN_vkVoidFunction)vkCreateBufferView;
-    if (!strcmp(funcName, "vkDestroyBufferView"))
+    case VK_ENTRYPOINT_DestroyBufferView:
         return (PFN_vkVoidFunction)vkDestroyBufferView;
-    if (!strcmp(funcName, "vkCreateImage"))
+    case VK_ENTRYPOINT_CreateImage:
         return (PFN_vkVoidFunction)vkCreateImage;
-    if (!strcmp(funcName, "vkDestroyImage"))
+    case VK_ENTRYPOINT_DestroyImage:
         return (PFN_vkVoidFunction)vkDestroyImage;
-    if (!strcmp(funcName, "vkGetImageSubresourceLayout"))
+    case VK_ENTRYPOINT_GetImageSubresourceLayout:
         return (PFN_vkVoidFunction)vkGetImageSubresourceLayout;
-    if (!strcmp(funcName, "vkCreateImageView"))
+    case VK_ENTRYPOINT_CreateImageView:
         return (PFN_vkVoidFunction)vkCreateImageView;
-    if (!strcmp(funcName, "vkDestroyImageView"))
+    case VK_ENTRYPOINT_DestroyImageView:
         return (PFN_vkVoidFunction)vkDestroyImageView;
-    if (!strcmp(funcName, "vkCreateShaderModule"))
+    case VK_ENTRYPOINT_CreateShaderModule:
         return (PFN_vkVoidFunction)vkCreateShaderModule;
-    if (!strcmp(funcName, "vkDestroyShaderModule"))
+    case VK_ENTRYPOINT_DestroyShaderModule:
         return (PFN_vkVoidFunction)vkDestroyShaderModule;
-    if (!strcmp(funcName, "vkCreatePipelineCache"))
+    case VK_ENTRYPOINT_CreatePipelineCache:
         return (PFN_vkVoidFunction)vkCreatePipelineCache;
-    if (!strcmp(funcName, "vkDestroyPipelineCache"))
+    case VK_ENTRYPOINT_DestroyPipelineCache:
         return (PFN_vkVoidFunction)vkDestroyPipelineCache;
-    if (!strcmp(funcName, "vkGetPipelineCacheData"))
+    case VK_ENTRYPOINT_GetPipelineCacheData:
         return (PFN_vkVoidFunction)vkGetPipelineCacheData;
-    if (!strcmp(funcName, "vkMergePipelineCaches"))
+    case VK_ENTRYPOINT_MergePipelineCaches:
         return (PFN_vkVoidFunction)vkMergePipelineCaches;
-    if (!strcmp(funcName, "vkCreateGraphicsPipelines"))
+    case VK_ENTRYPOINT_CreateGraphicsPipelines:
         return (PFN_vkVoidFunction)vkCreateGraphicsPipelines;
-    if (!strcmp(funcName, "vkCreateComputePipelines"))
+    case VK_ENTRYPOINT_CreateComputePipelines:
         return (PFN_vkVoidFunction)vkCreateComputePipelines;
-    if (!strcmp(funcName, "vkDestroyPipeline"))
+    case VK_ENTRYPOINT_DestroyPipeline:
         return (PFN_vkVoidFunction)vkDestroyPipeline;
-    if (!strcmp(funcName, "vkCreatePipelineLayout"))
+    case VK_ENTRYPOINT_CreatePipelineLayout:
         return (PFN_vkVoidFunction)vkCreatePipelineLayout;
-    if (!strcmp(funcName, "vkDestroyPipelineLayout"))
+    case VK_ENTRYPOINT_DestroyPipelineLayout:
         return (PFN_vkVoidFunction)vkDestroyPipelineLayout;
-    if (!strcmp(funcName, "vkCreateSampler"))
+    case VK_ENTRYPOINT_CreateSampler:
         return (PFN_vkVoidFunction)vkCreateSampler;
-    if (!strcmp(funcName, "vkDestroySampler"))
+    case VK_ENTRYPOINT_DestroySampler:
         return (PFN_vkVoidFunction)vkDestroySampler;
-    if (!strcmp(funcName, "vkCreateDescriptorSetLayout"))
+    case VK_ENTRYPOINT_CreateDescriptorSetLayout:
         return (PFN_vkVoidFunction)vkCreateDescriptorSetLayout;
-    if (!strcmp(funcName, "vkDestroyDescriptorSetLayout"))
+    case VK_ENTRYPOINT_DestroyDescriptorSetLayout:
         return (PFN_vkVoidFunction)vkDestroyDescriptorSetLayout;
-    if (!strcmp(funcName, "vkCreateDescriptorPool"))
+    case VK_ENTRYPOINT_CreateDescriptorPool:
         return (PFN_vkVoidFunction)vkCreateDescriptorPool;
-    if (!strcmp(funcName, "vkDestroyDescriptorPool"))
+    case VK_ENTRYPOINT_DestroyDescriptorPool:
         return (PFN_vkVoidFunction)vkDestroyDescriptorPool;
-    if (!strcmp(funcName, "vkResetDescriptorPool"))
+    case VK_ENTRYPOINT_ResetDescriptorPool:
         return (PFN_vkVoidFunction)vkResetDescriptorPool;
-    if (!strcmp(funcName, "vkAllocateDescriptorSets"))
+    case VK_ENTRYPOINT_AllocateDescriptorSets:
         return (PFN_vkVoidFunction)vkAllocateDescriptorSets;
-    if (!strcmp(funcName, "vkFreeDescriptorSets"))
+    case VK_ENTRYPOINT_FreeDescriptorSets:
         return (PFN_vkVoidFunction)vkFreeDescriptorSets;
-    if (!strcmp(funcName, "vkUpdateDescriptorSets"))
+    case VK_ENTRYPOINT_UpdateDescriptorSets:
         return (PFN_vkVoidFunction)vkUpdateDescriptorSets;
-    if (!strcmp(funcName, "vkCreateFramebuffer"))
+    case VK_ENTRYPOINT_CreateFramebuffer:
         return (PFN_vkVoidFunction)vkCreateFramebuffer;
-    if (!strcmp(funcName, "vkDestroyFramebuffer"))
+    case VK_ENTRYPOINT_DestroyFramebuffer:
         return (PFN_vkVoidFunction)vkDestroyFramebuffer;
-    if (!strcmp(funcName, "vkCreateRenderPass"))
+    case VK_ENTRYPOINT_CreateRenderPass:
         return (PFN_vkVoidFunction)vkCreateRenderPass;
-    if (!strcmp(funcName, "vkDestroyRenderPass"))
+    case VK_ENTRYPOINT_DestroyRenderPass:
         return (PFN_vkVoidFunction)vkDestroyRenderPass;
-    if (!strcmp(funcName, "vkGetRenderAreaGranularity"))
+    case VK_ENTRYPOINT_GetRenderAreaGranularity:
         return (PFN_vkVoidFunction)vkGetRenderAreaGranularity;
-    if (!strcmp(funcName, "vkCreateCommandPool"))
+    case VK_ENTRYPOINT_CreateCommandPool:
         return (PFN_vkVoidFunction)vkCreateCommandPool;
-    if (!strcmp(funcName, "vkDestroyCommandPool"))
+    case VK_ENTRYPOINT_DestroyCommandPool:
         return (PFN_vkVoidFunction)vkDestroyCommandPool;
-    if (!strcmp(funcName, "vkResetCommandPool"))
+    case VK_ENTRYPOINT_ResetCommandPool:
         return (PFN_vkVoidFunction)vkResetCommandPool;
-    if (!strcmp(funcName, "vkAllocateCommandBuffers"))
+    case VK_ENTRYPOINT_AllocateCommandBuffers:
         return (PFN_vkVoidFunction)vkAllocateCommandBuffers;
-    if (!strcmp(funcName, "vkFreeCommandBuffers"))
+    case VK_ENTRYPOINT_FreeCommandBuffers:
         return (PFN_vkVoidFunction)vkFreeCommandBuffers;
-    if (!strcmp(funcName, "vkBeginCommandBuffer"))
+    case VK_ENTRYPOINT_BeginCommandBuffer:
         return (PFN_vkVoidFunction)vkBeginCommandBuffer;
-    if (!strcmp(funcName, "vkEndCommandBuffer"))
+    case VK_ENTRYPOINT_EndCommandBuffer:
         return (PFN_vkVoidFunction)vkEndCommandBuffer;
-    if (!strcmp(funcName, "vkResetCommandBuffer"))
+    case VK_ENTRYPOINT_ResetCommandBuffer:
         return (PFN_vkVoidFunction)vkResetCommandBuffer;
-    if (!strcmp(funcName, "vkCmdBindPipeline"))
+    case VK_ENTRYPOINT_CmdBindPipeline:
         return (PFN_vkVoidFunction)vkCmdBindPipeline;
-    if (!strcmp(funcName, "vkCmdBindDescriptorSets"))
+    case VK_ENTRYPOINT_CmdBindDescriptorSets:
         return (PFN_vkVoidFunction)vkCmdBindDescriptorSets;
-    if (!strcmp(funcName, "vkCmdBindVertexBuffers"))
+    case VK_ENTRYPOINT_CmdBindVertexBuffers:
         return (PFN_vkVoidFunction)vkCmdBindVertexBuffers;
-    if (!strcmp(funcName, "vkCmdBindIndexBuffer"))
+    case VK_ENTRYPOINT_CmdBindIndexBuffer:
         return (PFN_vkVoidFunction)vkCmdBindIndexBuffer;
-    if (!strcmp(funcName, "vkCmdSetViewport"))
+    case VK_ENTRYPOINT_CmdSetViewport:
         return (PFN_vkVoidFunction)vkCmdSetViewport;
-    if (!strcmp(funcName, "vkCmdSetScissor"))
+    case VK_ENTRYPOINT_CmdSetScissor:
         return (PFN_vkVoidFunction)vkCmdSetScissor;
-    if (!strcmp(funcName, "vkCmdSetLineWidth"))
+    case VK_ENTRYPOINT_CmdSetLineWidth:
         return (PFN_vkVoidFunction)vkCmdSetLineWidth;
-    if (!strcmp(funcName, "vkCmdSetDepthBias"))
+    case VK_ENTRYPOINT_CmdSetDepthBias:
         return (PFN_vkVoidFunction)vkCmdSetDepthBias;
-    if (!strcmp(funcName, "vkCmdSetBlendConstants"))
+    case VK_ENTRYPOINT_CmdSetBlendConstants:
         return (PFN_vkVoidFunction)vkCmdSetBlendConstants;
-    if (!strcmp(funcName, "vkCmdSetDepthBounds"))
+    case VK_ENTRYPOINT_CmdSetDepthBounds:
         return (PFN_vkVoidFunction)vkCmdSetDepthBounds;
-    if (!strcmp(funcName, "vkCmdSetStencilCompareMask"))
+    case VK_ENTRYPOINT_CmdSetStencilCompareMask:
         return (PFN_vkVoidFunction)vkCmdSetStencilCompareMask;
-    if (!strcmp(funcName, "vkCmdSetStencilWriteMask"))
+    case VK_ENTRYPOINT_CmdSetStencilWriteMask:
         return (PFN_vkVoidFunction)vkCmdSetStencilWriteMask;
-    if (!strcmp(funcName, "vkCmdSetStencilReference"))
+    case VK_ENTRYPOINT_CmdSetStencilReference:
         return (PFN_vkVoidFunction)vkCmdSetStencilReference;
-    if (!strcmp(funcName, "vkCmdDraw"))
+    case VK_ENTRYPOINT_CmdDraw:
         return (PFN_vkVoidFunction)vkCmdDraw;
-    if (!strcmp(funcName, "vkCmdDrawIndexed"))
+    case VK_ENTRYPOINT_CmdDrawIndexed:
         return (PFN_vkVoidFunction)vkCmdDrawIndexed;
-    if (!strcmp(funcName, "vkCmdDrawIndirect"))
+    case VK_ENTRYPOINT_CmdDrawIndirect:
         return (PFN_vkVoidFunction)vkCmdDrawIndirect;
-    if (!strcmp(funcName, "vkCmdDrawIndexedIndirect"))
+    case VK_ENTRYPOINT_CmdDrawIndexedIndirect:
         return (PFN_vkVoidFunction)vkCmdDrawIndexedIndirect;
-    if (!strcmp(funcName, "vkCmdDispatch"))
+    case VK_ENTRYPOINT_CmdDispatch:
         return (PFN_vkVoidFunction)vkCmdDispatch;
-    if (!strcmp(funcName, "vkCmdDispatchIndirect"))
+    case VK_ENTRYPOINT_CmdDispatchIndirect:
         return (PFN_vkVoidFunction)vkCmdDispatchIndirect;
-    if (!strcmp(funcName, "vkCmdCopyBuffer"))
+    case VK_ENTRYPOINT_CmdCopyBuffer:
         return (PFN_vkVoidFunction)vkCmdCopyBuffer;
-    if (!strcmp(funcName, "vkCmdCopyImage"))
+    case VK_ENTRYPOINT_CmdCopyImage:
         return (PFN_vkVoidFunction)vkCmdCopyImage;
-    if (!strcmp(funcName, "vkCmdBlitImage"))
+    case VK_ENTRYPOINT_CmdBlitImage:
         return (PFN_vkVoidFunction)vkCmdBlitImage;
-    if (!strcmp(funcName, "vkCmdCopyBufferToImage"))
+    case VK_ENTRYPOINT_CmdCopyBufferToImage:
         return (PFN_vkVoidFunction)vkCmdCopyBufferToImage;
-    if (!strcmp(funcName, "vkCmdCopyImageToBuffer"))
+    case VK_ENTRYPOINT_CmdCopyImageToBuffer:
         return (PFN_vkVoidFunction)vkCmdCopyImageToBuffer;
-    if (!strcmp(funcName, "vkCmdUpdateBuffer"))
+    case VK_ENTRYPOINT_CmdUpdateBuffer:
         return (PFN_vkVoidFunction)vkCmdUpdateBuffer;
-    if (!strcmp(funcName, "vkCmdFillBuffer"))
+    case VK_ENTRYPOINT_CmdFillBuffer:
         return (PFN_vkVoidFunction)vkCmdFillBuffer;
-    if (!strcmp(funcName, "vkCmdClearColorImage"))
+    case VK_ENTRYPOINT_CmdClearColorImage:
         return (PFN_vkVoidFunction)vkCmdClearColorImage;
-    if (!strcmp(funcName, "vkCmdClearDepthStencilImage"))
+    case VK_ENTRYPOINT_CmdClearDepthStencilImage:
         return (PFN_vkVoidFunction)vkCmdClearDepthStencilImage;
-    if (!strcmp(funcName, "vkCmdClearAttachments"))
+    case VK_ENTRYPOINT_CmdClearAttachments:
         return (PFN_vkVoidFunction)vkCmdClearAttachments;
-    if (!strcmp(funcName, "vkCmdResolveImage"))
+    case VK_ENTRYPOINT_CmdResolveImage:
         return (PFN_vkVoidFunction)vkCmdResolveImage;
-    if (!strcmp(funcName, "vkCmdSetEvent"))
+    case VK_ENTRYPOINT_CmdSetEvent:
         return (PFN_vkVoidFunction)vkCmdSetEvent;
-    if (!strcmp(funcName, "vkCmdResetEvent"))
+    case VK_ENTRYPOINT_CmdResetEvent:
         return (PFN_vkVoidFunction)vkCmdResetEvent;
-    if (!strcmp(funcName, "vkCmdWaitEvents"))
+    case VK_ENTRYPOINT_CmdWaitEvents:
         return (PFN_vkVoidFunction)vkCmdWaitEvents;
-    if (!strcmp(funcName, "vkCmdPipelineBarrier"))
+    case VK_ENTRYPOINT_CmdPipelineBarrier:
         return (PFN_vkVoidFunction)vkCmdPipelineBarrier;
-    if (!strcmp(funcName, "vkCmdBeginQuery"))
+    case VK_ENTRYPOINT_CmdBeginQuery:
         return (PFN_vkVoidFunction)vkCmdBeginQuery;
-    if (!strcmp(funcName, "vkCmdEndQuery"))
+    case VK_ENTRYPOINT_CmdEndQuery:
         return (PFN_vkVoidFunction)vkCmdEndQuery;
-    if (!strcmp(funcName, "vkCmdResetQueryPool"))
+    case VK_ENTRYPOINT_CmdResetQueryPool:
         return (PFN_vkVoidFunction)vkCmdResetQueryPool;
-    if (!strcmp(funcName, "vkCmdWriteTimestamp"))
+    case VK_ENTRYPOINT_CmdWriteTimestamp:
         return (PFN_vkVoidFunction)vkCmdWriteTimestamp;
-    if (!strcmp(funcName, "vkCmdCopyQueryPoolResults"))
+    case VK_ENTRYPOINT_CmdCopyQueryPoolResults:
         return (PFN_vkVoidFunction)vkCmdCopyQueryPoolResults;
-    if (!strcmp(funcName, "vkCmdPushConstants"))
+    case VK_ENTRYPOINT_CmdPushConstants:
         return (PFN_vkVoidFunction)vkCmdPushConstants;
-    if (!strcmp(funcName, "vkCmdBeginRenderPass"))
+    case VK_ENTRYPOINT_CmdBeginRenderPass:
         return (PFN_vkVoidFunction)vkCmdBeginRenderPass;
-    if (!strcmp(funcName, "vkCmdNextSubpass"))
+    case VK_ENTRYPOINT_CmdNextSubpass:
         return (PFN_vkVoidFunction)vkCmdNextSubpass;
-    if (!strcmp(funcName, "vkCmdEndRenderPass"))
+    case VK_ENTRYPOINT_CmdEndRenderPass:
         return (PFN_vkVoidFunction)vkCmdEndRenderPass;
-    if (!strcmp(funcName, "vkCmdExecuteCommands"))
+    case VK_ENTRYPOINT_CmdExecuteCommands:
         return (PFN_vkVoidFunction)vkCmdExecuteCommands;
+    }
 
     // Instance extensions
     void *addr;
@@ -309,16 +312,14 @@ static inline void *trampolineGetProcAddr(struct loader_instance *inst,
 }
 
 static inline void *globalGetProcAddr(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k')
-        return NULL;
-
-    name += 2;
-    if (!strcmp(name, "CreateInstance"))
+    switch (vk_get_entrypoint_id(name)) {
+    case VK_ENTRYPOINT_CreateInstance:
         return (void *)vkCreateInstance;
-    if (!strcmp(name, "EnumerateInstanceExtensionProperties"))
+    case VK_ENTRYPOINT_EnumerateInstanceExtensionProperties:
         return (void *)vkEnumerateInstanceExtensionProperties;
-    if (!strcmp(name, "EnumerateInstanceLayerProperties"))
+    case VK_ENTRYPOINT_EnumerateInstanceLayerProperties:
         return (void *)vkEnumerateInstanceLayerProperties;
+    }
 
     return NULL;
 }
@@ -328,45 +329,40 @@ static inline void *globalGetProcAddr(const char *name) {
 *  Thus GPA must return loader entrypoint for these instead of first function
 *  in the chain. */
 static inline void *loader_non_passthrough_gipa(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k')
-        return NULL;
-
-    name += 2;
-    if (!strcmp(name, "CreateInstance"))
+    switch (vk_get_entrypoint_id(name)) {
+    case VK_ENTRYPOINT_CreateInstance:
         return (void *)vkCreateInstance;
-    if (!strcmp(name, "DestroyInstance"))
+    case VK_ENTRYPOINT_DestroyInstance:
         return (void *)vkDestroyInstance;
-    if (!strcmp(name, "GetDeviceProcAddr"))
+    case VK_ENTRYPOINT_GetDeviceProcAddr:
         return (void *)vkGetDeviceProcAddr;
     // remove once no longer locks
-    if (!strcmp(name, "EnumeratePhysicalDevices"))
+    case VK_ENTRYPOINT_EnumeratePhysicalDevices:
         return (void *)vkEnumeratePhysicalDevices;
-    if (!strcmp(name, "EnumerateDeviceExtensionProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceExtensionProperties:
         return (void *)vkEnumerateDeviceExtensionProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceLayerProperties:
         return (void *)vkEnumerateDeviceLayerProperties;
-    if (!strcmp(name, "GetInstanceProcAddr"))
+    case VK_ENTRYPOINT_GetInstanceProcAddr:
         return (void *)vkGetInstanceProcAddr;
-    if (!strcmp(name, "CreateDevice"))
+    case VK_ENTRYPOINT_CreateDevice:
         return (void *)vkCreateDevice;
+    }
 
     return NULL;
 }
 
 static inline void *loader_non_passthrough_gdpa(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k')
-        return NULL;
-
-    name += 2;
-
-    if (!strcmp(name, "GetDeviceProcAddr"))
+    switch (vk_get_entrypoint_id(name)) {
+    case VK_ENTRYPOINT_GetDeviceProcAddr:
         return (void *)vkGetDeviceProcAddr;
-    if (!strcmp(name, "DestroyDevice"))
+    case VK_ENTRYPOINT_DestroyDevice:
         return (void *)vkDestroyDevice;
-    if (!strcmp(name, "GetDeviceQueue"))
+    case VK_ENTRYPOINT_GetDeviceQueue:
         return (void *)vkGetDeviceQueue;
-    if (!strcmp(name, "AllocateCommandBuffers"))
+    case VK_ENTRYPOINT_AllocateCommandBuffers:
         return (void *)vkAllocateCommandBuffers;
+    }
 
     return NULL;
 }
@@ -1815,6 +1815,100 @@ static cJSON *loader_get_json(const struct loader_instance *inst,
     return json;
 }
 
+// Process-wide cache of parsed manifest files, guarded by loader_json_lock.
+// Every instance creation and layer/extension enumeration rescans the same
+// manifests, so a file is only re-read and re-parsed when its modification
+// time (to the file system's sub-second resolution) or size changes. Trees are
+// allocated with the default allocator since they outlive the instance that
+// first read them; the cache is emptied when the last instance is destroyed.
+struct loader_manifest_cache_entry {
+    char *filename;
+    int64_t mtime;
+    int64_t size;
+    cJSON *json;
+    struct loader_manifest_cache_entry *next;
+};
+static struct loader_manifest_cache_entry *loader_manifest_cache;
+
+static void loader_manifest_cache_delete_json(cJSON *json) {
+    struct loader_instance *saved_instance = tls_instance;
+    tls_instance = NULL;
+    cJSON_Delete(json);
+    tls_instance = saved_instance;
+}
+
+// Free every cached manifest. Must be called with loader_json_lock held.
+static void loader_manifest_cache_clear(void) {
+    while (loader_manifest_cache != NULL) {
+        struct loader_manifest_cache_entry *entry = loader_manifest_cache;
+        loader_manifest_cache = entry->next;
+        if (entry->json != NULL)
+            loader_manifest_cache_delete_json(entry->json);
+        free(entry->filename);
+        free(entry);
+    }
+}
+
+/**
+ * Get the parsed contents of a manifest file, reading and parsing it only if
+ * it isn't cached or has changed on disk since it was cached.
+ * Must be called with loader_json_lock held.
+ *
+ * \returns
+ * A pointer to a cJSON object representing the JSON parse tree, or NULL.
+ * The tree belongs to the cache; it must not be modified or freed by the
+ * caller and is only valid while loader_json_lock is held.
+ */
+static cJSON *loader_get_cached_json(const struct loader_instance *inst,
+                                     const char *filename) {
+    struct loader_manifest_cache_entry *entry;
+    struct loader_instance *saved_instance;
+    int64_t mtime, size;
+    cJSON *json;
+
+    if (!loader_platform_file_stat(filename, &mtime, &size)) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "Couldn't open JSON file %s", filename);
+        return NULL;
+    }
+
+    for (entry = loader_manifest_cache; entry != NULL; entry = entry->next) {
+        if (!strcmp(entry->filename, filename))
+            break;
+    }
+    if (entry != NULL && entry->json != NULL && entry->mtime == mtime &&
+        entry->size == size)
+        return entry->json;
+
+    saved_instance = tls_instance;
+    tls_instance = NULL;
+    json = loader_get_json(inst, filename);
+    tls_instance = saved_instance;
+
+    if (entry == NULL) {
+        entry = malloc(sizeof(*entry));
+        if (entry == NULL || (entry->filename = malloc(strlen(filename) + 1)) ==
+                                 NULL) {
+            free(entry);
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "Out of memory can't cache JSON file %s", filename);
+            if (json != NULL)
+                loader_manifest_cache_delete_json(json);
+            return NULL;
+        }
+        strcpy(entry->filename, filename);
+        entry->json = NULL;
+        entry->next = loader_manifest_cache;
+        loader_manifest_cache = entry;
+    }
+    if (entry->json != NULL)
+        loader_manifest_cache_delete_json(entry->json);
+    entry->json = json;
+    entry->mtime = mtime;
+    entry->size = size;
+    return json;
+}
+
 /**
  * Do a deep copy of the loader_layer_properties structure.
  */
@@ -2809,7 +2903,7 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
             continue;
         }
 
-        json = loader_get_json(inst, file_str);
+        json = loader_get_cached_json(inst, file_str);
         if (!json) {
             continue;
         }
@@ -2858,8 +2952,6 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
                                "%s, skipping",
                                file_str);
                     cJSON_Free(temp);
-                    cJSON_Delete(json);
-                    json = NULL;
                     continue;
                 }
                 // strip out extra quotes
@@ -2872,8 +2964,6 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
                                "Can't find \"library_path\" in ICD JSON file "
                                "%s, skipping",
                                file_str);
-                    cJSON_Delete(json);
-                    json = NULL;
                     continue;
                 }
                 char fullpath[MAX_STRING_SIZE];
@@ -2922,15 +3012,9 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
                 "Can't find \"ICD\" object in ICD JSON file %s, skipping",
                 file_str);
         }
-
-        cJSON_Delete(json);
-        json = NULL;
     }
 
 out:
-    if (NULL != json) {
-        cJSON_Delete(json);
-    }
     if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
             if (NULL != manifest_files.filename_list[i]) {
@@ -2991,14 +3075,13 @@ void loader_layer_scan(const struct loader_instance *inst,
                 continue;
 
             // parse file into JSON struct
-            json = loader_get_json(inst, file_str);
+            json = loader_get_cached_json(inst, file_str);
             if (!json) {
                 continue;
             }
 
             loader_add_layer_properties(inst, instance_layers, json,
                                         (implicit == 1), file_str);
-            cJSON_Delete(json);
         }
     }
 
@@ -3054,7 +3137,7 @@ void loader_implicit_layer_scan(const struct loader_instance *inst,
         }
 
         // parse file into JSON struct
-        json = loader_get_json(inst, file_str);
+        json = loader_get_cached_json(inst, file_str);
         if (!json) {
             continue;
         }
@@ -3063,7 +3146,6 @@ void loader_implicit_layer_scan(const struct loader_instance *inst,
                                     file_str);
 
         loader_instance_heap_free(inst, file_str);
-        cJSON_Delete(json);
     }
     loader_instance_heap_free(inst, manifest_files.filename_list);
 
@@ -3161,9 +3243,10 @@ static void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst,
  */
 void loader_init_dispatch_dev_ext(struct loader_instance *inst,
                                   struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_DEV_EXTS; i++) {
+    for (uint32_t i = 0; i < DEV_EXT_HASH_SIZE; i++) {
         if (inst->disp_hash[i].func_name != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i,
+            loader_init_dispatch_dev_ext_entry(inst, dev,
+                                               inst->disp_hash[i].index,
                                                inst->disp_hash[i].func_name);
     }
 }
@@ -3218,105 +3301,61 @@ loader_check_layers_for_address(const struct loader_instance *const inst,
 }
 
 static void loader_free_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_DEV_EXTS; i++) {
+    for (uint32_t i = 0; i < DEV_EXT_HASH_SIZE; i++) {
         loader_instance_heap_free(inst, inst->disp_hash[i].func_name);
-        loader_instance_heap_free(inst, inst->disp_hash[i].list.index);
     }
     memset(inst->disp_hash, 0, sizeof(inst->disp_hash));
+    inst->dev_ext_count = 0;
 }
 
-static bool loader_add_dev_ext_table(struct loader_instance *inst,
-                                     uint32_t *ptr_idx, const char *funcName) {
-    uint32_t i;
-    uint32_t idx = *ptr_idx;
-    struct loader_dispatch_hash_list *list = &inst->disp_hash[idx].list;
-
-    if (!inst->disp_hash[idx].func_name) {
-        // no entry here at this idx, so use it
-        assert(list->capacity == 0);
-        inst->disp_hash[idx].func_name = (char *)loader_instance_heap_alloc(
-            inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (inst->disp_hash[idx].func_name == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table() can't allocate memory for "
-                       "func_name");
-            return false;
-        }
-        strncpy(inst->disp_hash[idx].func_name, funcName, strlen(funcName) + 1);
-        return true;
+/**
+ * Look funcName up in the device extension hash table. The table is open
+ * addressed with linear probing and entries are never removed individually,
+ * so the probe sequence for funcName ends at the first unused slot.
+ * \returns
+ * The slot holding funcName, or the unused slot where it would be inserted.
+ */
+static struct loader_dispatch_hash_entry *
+loader_find_dev_ext_slot(struct loader_instance *inst, uint32_t hash,
+                         const char *funcName) {
+    uint32_t i = hash & (DEV_EXT_HASH_SIZE - 1);
+    while (inst->disp_hash[i].func_name != NULL) {
+        if (inst->disp_hash[i].hash == hash &&
+            !strcmp(inst->disp_hash[i].func_name, funcName))
+            break;
+        i = (i + 1) & (DEV_EXT_HASH_SIZE - 1);
     }
-
-    // check for enough capacity
-    if (list->capacity == 0) {
-        list->index = loader_instance_heap_alloc(inst, 8 * sizeof(*(list->index)),
-                                        VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table() can't allocate list memory");
-            return false;
-        }
-        list->capacity = 8 * sizeof(*(list->index));
-    } else if (list->capacity < (list->count + 1) * sizeof(*(list->index))) {
-        list->index = loader_instance_heap_realloc(inst, list->index, list->capacity,
-                                          list->capacity * 2,
-                                          VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(
-                inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                "loader_add_dev_ext_table() can't reallocate list memory");
-            return false;
-        }
-        list->capacity *= 2;
-    }
-
-    // find an unused index in the hash table and use it
-    i = (idx + 1) % MAX_NUM_DEV_EXTS;
-    do {
-        if (!inst->disp_hash[i].func_name) {
-            assert(inst->disp_hash[i].list.capacity == 0);
-            inst->disp_hash[i].func_name =
-                (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1,
-                                          VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (inst->disp_hash[i].func_name == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_add_dev_ext_table() can't rallocate "
-                           "func_name memory");
-                return false;
-            }
-            strncpy(inst->disp_hash[i].func_name, funcName,
-                    strlen(funcName) + 1);
-            list->index[list->count] = i;
-            list->count++;
-            *ptr_idx = i;
-            return true;
-        }
-        i = (i + 1) % MAX_NUM_DEV_EXTS;
-    } while (i != idx);
-
-    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-               "loader_add_dev_ext_table() couldn't insert into hash table; is "
-               "it full?");
-    return false;
+    return &inst->disp_hash[i];
 }
 
-static bool loader_name_in_dev_ext_table(struct loader_instance *inst,
-                                         uint32_t *idx, const char *funcName) {
-    uint32_t alt_idx;
-    if (inst->disp_hash[*idx].func_name &&
-        !strcmp(inst->disp_hash[*idx].func_name, funcName))
-        return true;
-
-    // funcName wasn't at the primary spot in the hash table
-    // search the list of secondary locations (shallow search, not deep search)
-    for (uint32_t i = 0; i < inst->disp_hash[*idx].list.count; i++) {
-        alt_idx = inst->disp_hash[*idx].list.index[i];
-        if (!strcmp(inst->disp_hash[*idx].func_name, funcName)) {
-            *idx = alt_idx;
-            return true;
-        }
+static bool loader_add_dev_ext_table(struct loader_instance *inst,
+                                     struct loader_dispatch_hash_entry *slot,
+                                     uint32_t hash, const char *funcName) {
+    // The table has twice as many slots as there are trampolines, so running
+    // out of trampolines always happens first and probing always terminates.
+    // Nothing is evicted when they run out: handed out trampolines stay valid
+    // for the life of the instance, and the new name just gets no entry.
+    if (inst->dev_ext_count >= MAX_NUM_DEV_EXTS) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_add_dev_ext_table() all %d device extension "
+                   "trampolines are in use; can't add %s",
+                   MAX_NUM_DEV_EXTS, funcName);
+        return false;
     }
 
-    return false;
+    size_t len = strlen(funcName) + 1;
+    slot->func_name = (char *)loader_instance_heap_alloc(
+        inst, len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (slot->func_name == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_add_dev_ext_table() can't allocate memory for "
+                   "func_name");
+        return false;
+    }
+    memcpy(slot->func_name, funcName, len);
+    slot->hash = hash;
+    slot->index = inst->dev_ext_count++;
+    return true;
 }
 
 /**
@@ -3334,18 +3373,18 @@ static bool loader_name_in_dev_ext_table(struct loader_instance *inst,
  * has not been seen yet. Next check if a layer or ICD supports it.  If so then
  * a
  * new entry in the hash table is initialized and that trampoline address for
- * the new entry is returned. Null is returned if the hash table is full or
+ * the new entry is returned. Null is returned if all trampolines are in use or
  * if no discovered layer or ICD returns a non-NULL GetProcAddr for it.
  */
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
-    uint32_t idx;
+    struct loader_dispatch_hash_entry *slot;
     uint32_t seed = 0;
+    uint32_t hash = murmurhash(funcName, strlen(funcName), seed);
 
-    idx = murmurhash(funcName, strlen(funcName), seed) % MAX_NUM_DEV_EXTS;
-
-    if (loader_name_in_dev_ext_table(inst, &idx, funcName))
+    slot = loader_find_dev_ext_slot(inst, hash, funcName);
+    if (slot->func_name != NULL)
         // found funcName already in hash
-        return loader_get_dev_ext_trampoline(idx);
+        return loader_get_dev_ext_trampoline(slot->index);
 
     // Check if funcName is supported in either ICDs or a layer library
     if (!loader_check_icds_for_address(inst, funcName) &&
@@ -3354,11 +3393,11 @@ void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
         return NULL;
     }
 
-    if (loader_add_dev_ext_table(inst, &idx, funcName)) {
+    if (loader_add_dev_ext_table(inst, slot, hash, funcName)) {
         // successfully added new table entry
         // init any dev dispatch table entrys as needed
-        loader_init_dispatch_dev_ext_entry(inst, NULL, idx, funcName);
-        return loader_get_dev_ext_trampoline(idx);
+        loader_init_dispatch_dev_ext_entry(inst, NULL, slot->index, funcName);
+        return loader_get_dev_ext_trampoline(slot->index);
     }
 
     return NULL;
@@ -4093,6 +4132,14 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(
     if (ptr_instance->phys_devs_term)
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term);
     loader_free_dev_ext_table(ptr_instance);
+
+    // Manifests are usually only scanned while creating instances, so don't
+    // hold on to them once none are left
+    if (loader.instances == NULL) {
+        loader_platform_thread_lock_mutex(&loader_json_lock);
+        loader_manifest_cache_clear();
+        loader_platform_thread_unlock_mutex(&loader_json_lock);
+    }
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(
@@ -137,20 +137,27 @@ struct loader_layer_list {
     struct loader_layer_properties *list;
 };
 
-struct loader_dispatch_hash_list {
-    size_t capacity;
-    uint32_t count;
-    uint32_t *index; // index into the dev_ext dispatch table
-};
-
-#define MAX_NUM_DEV_EXTS 250
-// loader_dispatch_hash_entry and loader_dev_ext_dispatch_table.DevExt have one
-// to one
-// correspondence; one loader_dispatch_hash_entry for one DevExt dispatch entry.
-// Also have a one to one correspondence with functions in dev_ext_trampoline.c
+// Number of device extension trampolines in dev_ext_trampoline.c, and so the
+// number of distinct unknown device entrypoints the loader can hand out per
+// instance. The trampolines are compiled code, so this is a fixed cap rather
+// than a table that grows: once every trampoline is in use, lookups of further
+// new names log an error and return NULL, while names that already have a
+// trampoline keep resolving to it. dev_ext_trampoline.c is generated for this
+// count by "vk-loader-generate.py <wsi> dev-ext-trampoline <count>"; change
+// both together.
+#define MAX_NUM_DEV_EXTS 1024
+// Slots in the open addressed name -> trampoline index table. Must be a power
+// of two; twice the number of trampolines keeps probe sequences short even
+// when every trampoline is in use.
+#define DEV_EXT_HASH_SIZE (2 * MAX_NUM_DEV_EXTS)
+
+// One slot of loader_instance.disp_hash. Trampoline indices are handed out in
+// order of first lookup, so index is also the loader_dev_ext_dispatch_table.DevExt
+// entry and the dev_ext_trampoline.c function serving func_name.
 struct loader_dispatch_hash_entry {
-    char *func_name;
-    struct loader_dispatch_hash_list list; // to handle hashing collisions
+    char *func_name; // NULL if the slot is unused
+    uint32_t hash;   // cached murmurhash of func_name
+    uint32_t index;  // index into the dev_ext dispatch table
 };
 
 typedef void(VKAPI_PTR *PFN_vkDevExt)(VkDevice device);
@@ -264,7 +271,8 @@ struct loader_instance {
     struct loader_extension_list ext_list; // icds and loaders extensions
     struct loader_icd_libs icd_libs;
     struct loader_layer_list instance_layer_list;
-    struct loader_dispatch_hash_entry disp_hash[MAX_NUM_DEV_EXTS];
+    struct loader_dispatch_hash_entry disp_hash[DEV_EXT_HASH_SIZE];
+    uint32_t dev_ext_count; // trampoline indices handed out from disp_hash
 
     struct loader_msg_callback_map_entry *icd_msg_callback_map;
 
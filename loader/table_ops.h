@@ -28,6 +28,7 @@
 #include <string.h>
 #include "loader.h"
 #include "vk_loader_platform.h"
+#include "vk_entrypoint_hash.h"
 
 static VkResult vkDevExtError(VkDevice dev) {
     struct loader_device *found_dev;
@@ -272,252 +273,250 @@ static inline void loader_init_device_extension_dispatch_table(
 static inline void *
 loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table,
                                     const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k')
-        return NULL;
-
-    name += 2;
-    if (!strcmp(name, "GetDeviceProcAddr"))
+    switch (vk_get_entrypoint_id(name)) {
+    case VK_ENTRYPOINT_GetDeviceProcAddr:
         return (void *)table->GetDeviceProcAddr;
-    if (!strcmp(name, "DestroyDevice"))
+    case VK_ENTRYPOINT_DestroyDevice:
         return (void *)table->DestroyDevice;
-    if (!strcmp(name, "GetDeviceQueue"))
+    case VK_ENTRYPOINT_GetDeviceQueue:
         return (void *)table->GetDeviceQueue;
-    if (!strcmp(name, "QueueSubmit"))
+    case VK_ENTRYPOINT_QueueSubmit:
         return (void *)table->QueueSubmit;
-    if (!strcmp(name, "QueueWaitIdle"))
+    case VK_ENTRYPOINT_QueueWaitIdle:
         return (void *)table->QueueWaitIdle;
-    if (!strcmp(name, "DeviceWaitIdle"))
+    case VK_ENTRYPOINT_DeviceWaitIdle:
         return (void *)table->DeviceWaitIdle;
-    if (!strcmp(name, "AllocateMemory"))
+    case VK_ENTRYPOINT_AllocateMemory:
         return (void *)table->AllocateMemory;
-    if (!strcmp(name, "FreeMemory"))
+    case VK_ENTRYPOINT_FreeMemory:
         return (void *)table->FreeMemory;
-    if (!strcmp(name, "MapMemory"))
+    case VK_ENTRYPOINT_MapMemory:
         return (void *)table->MapMemory;
-    if (!strcmp(name, "UnmapMemory"))
+    case VK_ENTRYPOINT_UnmapMemory:
         return (void *)table->UnmapMemory;
-    if (!strcmp(name, "FlushMappedMemoryRanges"))
+    case VK_ENTRYPOINT_FlushMappedMemoryRanges:
         return (void *)table->FlushMappedMemoryRanges;
-    if (!strcmp(name, "InvalidateMappedMemoryRanges"))
+    case VK_ENTRYPOINT_InvalidateMappedMemoryRanges:
         return (void *)table->InvalidateMappedMemoryRanges;
-    if (!strcmp(name, "GetDeviceMemoryCommitment"))
+    case VK_ENTRYPOINT_GetDeviceMemoryCommitment:
         return (void *)table->GetDeviceMemoryCommitment;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements"))
+    case VK_ENTRYPOINT_GetImageSparseMemoryRequirements:
         return (void *)table->GetImageSparseMemoryRequirements;
-    if (!strcmp(name, "GetBufferMemoryRequirements"))
+    case VK_ENTRYPOINT_GetBufferMemoryRequirements:
         return (void *)table->GetBufferMemoryRequirements;
-    if (!strcmp(name, "GetImageMemoryRequirements"))
+    case VK_ENTRYPOINT_GetImageMemoryRequirements:
         return (void *)table->GetImageMemoryRequirements;
-    if (!strcmp(name, "BindBufferMemory"))
+    case VK_ENTRYPOINT_BindBufferMemory:
         return (void *)table->BindBufferMemory;
-    if (!strcmp(name, "BindImageMemory"))
+    case VK_ENTRYPOINT_BindImageMemory:
         return (void *)table->BindImageMemory;
-    if (!strcmp(name, "QueueBindSparse"))
+    case VK_ENTRYPOINT_QueueBindSparse:
         return (void *)table->QueueBindSparse;
-    if (!strcmp(name, "CreateFence"))
+    case VK_ENTRYPOINT_CreateFence:
         return (void *)table->CreateFence;
-    if (!strcmp(name, "DestroyFence"))
+    case VK_ENTRYPOINT_DestroyFence:
         return (void *)table->DestroyFence;
-    if (!strcmp(name, "ResetFences"))
+    case VK_ENTRYPOINT_ResetFences:
         return (void *)table->ResetFences;
-    if (!strcmp(name, "GetFenceStatus"))
+    case VK_ENTRYPOINT_GetFenceStatus:
         return (void *)table->GetFenceStatus;
-    if (!strcmp(name, "WaitForFences"))
+    case VK_ENTRYPOINT_WaitForFences:
         return (void *)table->WaitForFences;
-    if (!strcmp(name, "CreateSemaphore"))
+    case VK_ENTRYPOINT_CreateSemaphore:
         return (void *)table->CreateSemaphore;
-    if (!strcmp(name, "DestroySemaphore"))
+    case VK_ENTRYPOINT_DestroySemaphore:
         return (void *)table->DestroySemaphore;
-    if (!strcmp(name, "CreateEvent"))
+    case VK_ENTRYPOINT_CreateEvent:
         return (void *)table->CreateEvent;
-    if (!strcmp(name, "DestroyEvent"))
+    case VK_ENTRYPOINT_DestroyEvent:
         return (void *)table->DestroyEvent;
-    if (!strcmp(name, "GetEventStatus"))
+    case VK_ENTRYPOINT_GetEventStatus:
         return (void *)table->GetEventStatus;
-    if (!strcmp(name, "SetEvent"))
+    case VK_ENTRYPOINT_SetEvent:
         return (void *)table->SetEvent;
-    if (!strcmp(name, "ResetEvent"))
+    case VK_ENTRYPOINT_ResetEvent:
         return (void *)table->ResetEvent;
-    if (!strcmp(name, "CreateQueryPool"))
+    case VK_ENTRYPOINT_CreateQueryPool:
         return (void *)table->CreateQueryPool;
-    if (!strcmp(name, "DestroyQueryPool"))
+    case VK_ENTRYPOINT_DestroyQueryPool:
         return (void *)table->DestroyQueryPool;
-    if (!strcmp(name, "GetQueryPoolResults"))
+    case VK_ENTRYPOINT_GetQueryPoolResults:
         return (void *)table->GetQueryPoolResults;
-    if (!strcmp(name, "CreateBuffer"))
+    case VK_ENTRYPOINT_CreateBuffer:
         return (void *)table->CreateBuffer;
-    if (!strcmp(name, "DestroyBuffer"))
+    case VK_ENTRYPOINT_DestroyBuffer:
         return (void *)table->DestroyBuffer;
-    if (!strcmp(name, "CreateBufferView"))
+    case VK_ENTRYPOINT_CreateBufferView:
         return (void *)table->CreateBufferView;
-    if (!strcmp(name, "DestroyBufferView"))
+    case VK_ENTRYPOINT_DestroyBufferView:
         return (void *)table->DestroyBufferView;
-    if (!strcmp(name, "CreateImage"))
+    case VK_ENTRYPOINT_CreateImage:
         return (void *)table->CreateImage;
-    if (!strcmp(name, "DestroyImage"))
+    case VK_ENTRYPOINT_DestroyImage:
         return (void *)table->DestroyImage;
-    if (!strcmp(name, "GetImageSubresourceLayout"))
+    case VK_ENTRYPOINT_GetImageSubresourceLayout:
         return (void *)table->GetImageSubresourceLayout;
-    if (!strcmp(name, "CreateImageView"))
+    case VK_ENTRYPOINT_CreateImageView:
         return (void *)table->CreateImageView;
-    if (!strcmp(name, "DestroyImageView"))
+    case VK_ENTRYPOINT_DestroyImageView:
         return (void *)table->DestroyImageView;
-    if (!strcmp(name, "CreateShaderModule"))
+    case VK_ENTRYPOINT_CreateShaderModule:
         return (void *)table->CreateShaderModule;
-    if (!strcmp(name, "DestroyShaderModule"))
+    case VK_ENTRYPOINT_DestroyShaderModule:
         return (void *)table->DestroyShaderModule;
-    if (!strcmp(name, "CreatePipelineCache"))
+    case VK_ENTRYPOINT_CreatePipelineCache:
         return (void *)vkCreatePipelineCache;
-    if (!strcmp(name, "DestroyPipelineCache"))
+    case VK_ENTRYPOINT_DestroyPipelineCache:
         return (void *)vkDestroyPipelineCache;
-    if (!strcmp(name, "GetPipelineCacheData"))
+    case VK_ENTRYPOINT_GetPipelineCacheData:
         return (void *)vkGetPipelineCacheData;
-    if (!strcmp(name, "MergePipelineCaches"))
+    case VK_ENTRYPOINT_MergePipelineCaches:
         return (void *)vkMergePipelineCaches;
-    if (!strcmp(name, "CreateGraphicsPipelines"))
+    case VK_ENTRYPOINT_CreateGraphicsPipelines:
         return (void *)vkCreateGraphicsPipelines;
-    if (!strcmp(name, "CreateComputePipelines"))
+    case VK_ENTRYPOINT_CreateComputePipelines:
         return (void *)vkCreateComputePipelines;
-    if (!strcmp(name, "DestroyPipeline"))
+    case VK_ENTRYPOINT_DestroyPipeline:
         return (void *)table->DestroyPipeline;
-    if (!strcmp(name, "CreatePipelineLayout"))
+    case VK_ENTRYPOINT_CreatePipelineLayout:
         return (void *)table->CreatePipelineLayout;
-    if (!strcmp(name, "DestroyPipelineLayout"))
+    case VK_ENTRYPOINT_DestroyPipelineLayout:
         return (void *)table->DestroyPipelineLayout;
-    if (!strcmp(name, "CreateSampler"))
+    case VK_ENTRYPOINT_CreateSampler:
         return (void *)table->CreateSampler;
-    if (!strcmp(name, "DestroySampler"))
+    case VK_ENTRYPOINT_DestroySampler:
         return (void *)table->DestroySampler;
-    if (!strcmp(name, "CreateDescriptorSetLayout"))
+    case VK_ENTRYPOINT_CreateDescriptorSetLayout:
         return (void *)table->CreateDescriptorSetLayout;
-    if (!strcmp(name, "DestroyDescriptorSetLayout"))
+    case VK_ENTRYPOINT_DestroyDescriptorSetLayout:
         return (void *)table->DestroyDescriptorSetLayout;
-    if (!strcmp(name, "CreateDescriptorPool"))
+    case VK_ENTRYPOINT_CreateDescriptorPool:
         return (void *)table->CreateDescriptorPool;
-    if (!strcmp(name, "DestroyDescriptorPool"))
+    case VK_ENTRYPOINT_DestroyDescriptorPool:
         return (void *)table->DestroyDescriptorPool;
-    if (!strcmp(name, "ResetDescriptorPool"))
+    case VK_ENTRYPOINT_ResetDescriptorPool:
         return (void *)table->ResetDescriptorPool;
-    if (!strcmp(name, "AllocateDescriptorSets"))
+    case VK_ENTRYPOINT_AllocateDescriptorSets:
         return (void *)table->AllocateDescriptorSets;
-    if (!strcmp(name, "FreeDescriptorSets"))
+    case VK_ENTRYPOINT_FreeDescriptorSets:
         return (void *)table->FreeDescriptorSets;
-    if (!strcmp(name, "UpdateDescriptorSets"))
+    case VK_ENTRYPOINT_UpdateDescriptorSets:
         return (void *)table->UpdateDescriptorSets;
-    if (!strcmp(name, "CreateFramebuffer"))
+    case VK_ENTRYPOINT_CreateFramebuffer:
         return (void *)table->CreateFramebuffer;
-    if (!strcmp(name, "DestroyFramebuffer"))
+    case VK_ENTRYPOINT_DestroyFramebuffer:
         return (void *)table->DestroyFramebuffer;
-    if (!strcmp(name, "CreateRenderPass"))
+    case VK_ENTRYPOINT_CreateRenderPass:
         return (void *)table->CreateRenderPass;
-    if (!strcmp(name, "DestroyRenderPass"))
+    case VK_ENTRYPOINT_DestroyRenderPass:
         return (void *)table->DestroyRenderPass;
-    if (!strcmp(name, "GetRenderAreaGranularity"))
+    case VK_ENTRYPOINT_GetRenderAreaGranularity:
         return (void *)table->GetRenderAreaGranularity;
-    if (!strcmp(name, "CreateCommandPool"))
+    case VK_ENTRYPOINT_CreateCommandPool:
         return (void *)table->CreateCommandPool;
-    if (!strcmp(name, "DestroyCommandPool"))
+    case VK_ENTRYPOINT_DestroyCommandPool:
         return (void *)table->DestroyCommandPool;
-    if (!strcmp(name, "ResetCommandPool"))
+    case VK_ENTRYPOINT_ResetCommandPool:
         return (void *)table->ResetCommandPool;
-    if (!strcmp(name, "AllocateCommandBuffers"))
+    case VK_ENTRYPOINT_AllocateCommandBuffers:
         return (void *)table->AllocateCommandBuffers;
-    if (!strcmp(name, "FreeCommandBuffers"))
+    case VK_ENTRYPOINT_FreeCommandBuffers:
         return (void *)table->FreeCommandBuffers;
-    if (!strcmp(name, "BeginCommandBuffer"))
+    case VK_ENTRYPOINT_BeginCommandBuffer:
         return (void *)table->BeginCommandBuffer;
-    if (!strcmp(name, "EndCommandBuffer"))
+    case VK_ENTRYPOINT_EndCommandBuffer:
         return (void *)table->EndCommandBuffer;
-    if (!strcmp(name, "ResetCommandBuffer"))
+    case VK_ENTRYPOINT_ResetCommandBuffer:
         return (void *)table->ResetCommandBuffer;
-    if (!strcmp(name, "CmdBindPipeline"))
+    case VK_ENTRYPOINT_CmdBindPipeline:
         return (void *)table->CmdBindPipeline;
-    if (!strcmp(name, "CmdSetViewport"))
+    case VK_ENTRYPOINT_CmdSetViewport:
         return (void *)table->CmdSetViewport;
-    if (!strcmp(name, "CmdSetScissor"))
+    case VK_ENTRYPOINT_CmdSetScissor:
         return (void *)table->CmdSetScissor;
-    if (!strcmp(name, "CmdSetLineWidth"))
+    case VK_ENTRYPOINT_CmdSetLineWidth:
         return (void *)table->CmdSetLineWidth;
-    if (!strcmp(name, "CmdSetDepthBias"))
+    case VK_ENTRYPOINT_CmdSetDepthBias:
         return (void *)table->CmdSetDepthBias;
-    if (!strcmp(name, "CmdSetBlendConstants"))
+    case VK_ENTRYPOINT_CmdSetBlendConstants:
         return (void *)table->CmdSetBlendConstants;
-    if (!strcmp(name, "CmdSetDepthBounds"))
+    case VK_ENTRYPOINT_CmdSetDepthBounds:
         return (void *)table->CmdSetDepthBounds;
-    if (!strcmp(name, "CmdSetStencilCompareMask"))
+    case VK_ENTRYPOINT_CmdSetStencilCompareMask:
         return (void *)table->CmdSetStencilCompareMask;
-    if (!strcmp(name, "CmdSetStencilwriteMask"))
+    case VK_ENTRYPOINT_CmdSetStencilWriteMask:
         return (void *)table->CmdSetStencilWriteMask;
-    if (!strcmp(name, "CmdSetStencilReference"))
+    case VK_ENTRYPOINT_CmdSetStencilReference:
         return (void *)table->CmdSetStencilReference;
-    if (!strcmp(name, "CmdBindDescriptorSets"))
+    case VK_ENTRYPOINT_CmdBindDescriptorSets:
         return (void *)table->CmdBindDescriptorSets;
-    if (!strcmp(name, "CmdBindVertexBuffers"))
+    case VK_ENTRYPOINT_CmdBindVertexBuffers:
         return (void *)table->CmdBindVertexBuffers;
-    if (!strcmp(name, "CmdBindIndexBuffer"))
+    case VK_ENTRYPOINT_CmdBindIndexBuffer:
         return (void *)table->CmdBindIndexBuffer;
-    if (!strcmp(name, "CmdDraw"))
+    case VK_ENTRYPOINT_CmdDraw:
         return (void *)table->CmdDraw;
-    if (!strcmp(name, "CmdDrawIndexed"))
+    case VK_ENTRYPOINT_CmdDrawIndexed:
         return (void *)table->CmdDrawIndexed;
-    if (!strcmp(name, "CmdDrawIndirect"))
+    case VK_ENTRYPOINT_CmdDrawIndirect:
         return (void *)table->CmdDrawIndirect;
-    if (!strcmp(name, "CmdDrawIndexedIndirect"))
+    case VK_ENTRYPOINT_CmdDrawIndexedIndirect:
         return (void *)table->CmdDrawIndexedIndirect;
-    if (!strcmp(name, "CmdDispatch"))
+    case VK_ENTRYPOINT_CmdDispatch:
         return (void *)table->CmdDispatch;
-    if (!strcmp(name, "CmdDispatchIndirect"))
+    case VK_ENTRYPOINT_CmdDispatchIndirect:
         return (void *)table->CmdDispatchIndirect;
-    if (!strcmp(name, "CmdCopyBuffer"))
+    case VK_ENTRYPOINT_CmdCopyBuffer:
         return (void *)table->CmdCopyBuffer;
-    if (!strcmp(name, "CmdCopyImage"))
+    case VK_ENTRYPOINT_CmdCopyImage:
         return (void *)table->CmdCopyImage;
-    if (!strcmp(name, "CmdBlitImage"))
+    case VK_ENTRYPOINT_CmdBlitImage:
         return (void *)table->CmdBlitImage;
-    if (!strcmp(name, "CmdCopyBufferToImage"))
+    case VK_ENTRYPOINT_CmdCopyBufferToImage:
         return (void *)table->CmdCopyBufferToImage;
-    if (!strcmp(name, "CmdCopyImageToBuffer"))
+    case VK_ENTRYPOINT_CmdCopyImageToBuffer:
         return (void *)table->CmdCopyImageToBuffer;
-    if (!strcmp(name, "CmdUpdateBuffer"))
+    case VK_ENTRYPOINT_CmdUpdateBuffer:
         return (void *)table->CmdUpdateBuffer;
-    if (!strcmp(name, "CmdFillBuffer"))
+    case VK_ENTRYPOINT_CmdFillBuffer:
         return (void *)table->CmdFillBuffer;
-    if (!strcmp(name, "CmdClearColorImage"))
+    case VK_ENTRYPOINT_CmdClearColorImage:
         return (void *)table->CmdClearColorImage;
-    if (!strcmp(name, "CmdClearDepthStencilImage"))
+    case VK_ENTRYPOINT_CmdClearDepthStencilImage:
         return (void *)table->CmdClearDepthStencilImage;
-    if (!strcmp(name, "CmdClearAttachments"))
+    case VK_ENTRYPOINT_CmdClearAttachments:
         return (void *)table->CmdClearAttachments;
-    if (!strcmp(name, "CmdResolveImage"))
+    case VK_ENTRYPOINT_CmdResolveImage:
         return (void *)table->CmdResolveImage;
-    if (!strcmp(name, "CmdSetEvent"))
+    case VK_ENTRYPOINT_CmdSetEvent:
         return (void *)table->CmdSetEvent;
-    if (!strcmp(name, "CmdResetEvent"))
+    case VK_ENTRYPOINT_CmdResetEvent:
         return (void *)table->CmdResetEvent;
-    if (!strcmp(name, "CmdWaitEvents"))
+    case VK_ENTRYPOINT_CmdWaitEvents:
         return (void *)table->CmdWaitEvents;
-    if (!strcmp(name, "CmdPipelineBarrier"))
+    case VK_ENTRYPOINT_CmdPipelineBarrier:
         return (void *)table->CmdPipelineBarrier;
-    if (!strcmp(name, "CmdBeginQuery"))
+    case VK_ENTRYPOINT_CmdBeginQuery:
         return (void *)table->CmdBeginQuery;
-    if (!strcmp(name, "CmdEndQuery"))
+    case VK_ENTRYPOINT_CmdEndQuery:
         return (void *)table->CmdEndQuery;
-    if (!strcmp(name, "CmdResetQueryPool"))
+    case VK_ENTRYPOINT_CmdResetQueryPool:
         return (void *)table->CmdResetQueryPool;
-    if (!strcmp(name, "CmdWriteTimestamp"))
+    case VK_ENTRYPOINT_CmdWriteTimestamp:
         return (void *)table->CmdWriteTimestamp;
-    if (!strcmp(name, "CmdCopyQueryPoolResults"))
+    case VK_ENTRYPOINT_CmdCopyQueryPoolResults:
         return (void *)table->CmdCopyQueryPoolResults;
-    if (!strcmp(name, "CmdPushConstants"))
+    case VK_ENTRYPOINT_CmdPushConstants:
         return (void *)table->CmdPushConstants;
-    if (!strcmp(name, "CmdBeginRenderPass"))
+    case VK_ENTRYPOINT_CmdBeginRenderPass:
         return (void *)table->CmdBeginRenderPass;
-    if (!strcmp(name, "CmdNextSubpass"))
+    case VK_ENTRYPOINT_CmdNextSubpass:
         return (void *)table->CmdNextSubpass;
-    if (!strcmp(name, "CmdEndRenderPass"))
+    case VK_ENTRYPOINT_CmdEndRenderPass:
         return (void *)table->CmdEndRenderPass;
-    if (!strcmp(name, "CmdExecuteCommands"))
+    case VK_ENTRYPOINT_CmdExecuteCommands:
         return (void *)table->CmdExecuteCommands;
+    }
 
     return NULL;
 }
@@ -643,98 +642,94 @@ static inline void loader_init_instance_extension_dispatch_table(
 static inline void *
 loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table,
                                       const char *name, bool *found_name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') {
-        *found_name = false;
-        return NULL;
-    }
-
     *found_name = true;
-    name += 2;
-    if (!strcmp(name, "DestroyInstance"))
+    switch (vk_get_entrypoint_id(name)) {
+    case VK_ENTRYPOINT_DestroyInstance:
         return (void *)table->DestroyInstance;
-    if (!strcmp(name, "EnumeratePhysicalDevices"))
+    case VK_ENTRYPOINT_EnumeratePhysicalDevices:
         return (void *)table->EnumeratePhysicalDevices;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceFeatures:
         return (void *)table->GetPhysicalDeviceFeatures;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceImageFormatProperties:
         return (void *)table->GetPhysicalDeviceImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceFormatProperties:
         return (void *)table->GetPhysicalDeviceFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceSparseImageFormatProperties:
         return (void *)table->GetPhysicalDeviceSparseImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceProperties:
         return (void *)table->GetPhysicalDeviceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceQueueFamilyProperties:
         return (void *)table->GetPhysicalDeviceQueueFamilyProperties;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceMemoryProperties:
         return (void *)table->GetPhysicalDeviceMemoryProperties;
-    if (!strcmp(name, "GetInstanceProcAddr"))
+    case VK_ENTRYPOINT_GetInstanceProcAddr:
         return (void *)table->GetInstanceProcAddr;
-    if (!strcmp(name, "EnumerateDeviceExtensionProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceExtensionProperties:
         return (void *)table->EnumerateDeviceExtensionProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties"))
+    case VK_ENTRYPOINT_EnumerateDeviceLayerProperties:
         return (void *)table->EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "DestroySurfaceKHR"))
+    case VK_ENTRYPOINT_DestroySurfaceKHR:
         return (void *)table->DestroySurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceSupportKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfaceSupportKHR:
         return (void *)table->GetPhysicalDeviceSurfaceSupportKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilitiesKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfaceCapabilitiesKHR:
         return (void *)table->GetPhysicalDeviceSurfaceCapabilitiesKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceFormatsKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfaceFormatsKHR:
         return (void *)table->GetPhysicalDeviceSurfaceFormatsKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfacePresentModesKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfacePresentModesKHR:
         return (void *)table->GetPhysicalDeviceSurfacePresentModesKHR;
 #ifdef VK_USE_PLATFORM_MIR_KHR
-    if (!strcmp(name, "CreateMirSurfaceKHR"))
+    case VK_ENTRYPOINT_CreateMirSurfaceKHR:
         return (void *)table->CreateMirSurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceMirPresentationSupportKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceMirPresentationSupportKHR:
         return (void *)table->GetPhysicalDeviceMirPresentationSupportKHR;
 #endif
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    if (!strcmp(name, "CreateWaylandSurfaceKHR"))
+    case VK_ENTRYPOINT_CreateWaylandSurfaceKHR:
         return (void *)table->CreateWaylandSurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceWaylandPresentationSupportKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceWaylandPresentationSupportKHR:
         return (void *)table->GetPhysicalDeviceWaylandPresentationSupportKHR;
 #endif
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "CreateWin32SurfaceKHR"))
+    case VK_ENTRYPOINT_CreateWin32SurfaceKHR:
         return (void *)table->CreateWin32SurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceWin32PresentationSupportKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceWin32PresentationSupportKHR:
         return (void *)table->GetPhysicalDeviceWin32PresentationSupportKHR;
 #endif
 #ifdef VK_USE_PLATFORM_XCB_KHR
-    if (!strcmp(name, "CreateXcbSurfaceKHR"))
+    case VK_ENTRYPOINT_CreateXcbSurfaceKHR:
         return (void *)table->CreateXcbSurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceXcbPresentationSupportKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceXcbPresentationSupportKHR:
         return (void *)table->GetPhysicalDeviceXcbPresentationSupportKHR;
 #endif
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-    if (!strcmp(name, "CreateXlibSurfaceKHR"))
+    case VK_ENTRYPOINT_CreateXlibSurfaceKHR:
         return (void *)table->CreateXlibSurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceXlibPresentationSupportKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceXlibPresentationSupportKHR:
         return (void *)table->GetPhysicalDeviceXlibPresentationSupportKHR;
 #endif
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPropertiesKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceDisplayPropertiesKHR:
         return (void *)table->GetPhysicalDeviceDisplayPropertiesKHR;
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPlanePropertiesKHR"))
+    case VK_ENTRYPOINT_GetPhysicalDeviceDisplayPlanePropertiesKHR:
         return (void *)table->GetPhysicalDeviceDisplayPlanePropertiesKHR;
-    if (!strcmp(name, "GetDisplayPlaneSupportedDisplaysKHR"))
+    case VK_ENTRYPOINT_GetDisplayPlaneSupportedDisplaysKHR:
         return (void *)table->GetDisplayPlaneSupportedDisplaysKHR;
-    if (!strcmp(name, "GetDisplayModePropertiesKHR"))
+    case VK_ENTRYPOINT_GetDisplayModePropertiesKHR:
         return (void *)table->GetDisplayModePropertiesKHR;
-    if (!strcmp(name, "CreateDisplayModeKHR"))
+    case VK_ENTRYPOINT_CreateDisplayModeKHR:
         return (void *)table->CreateDisplayModeKHR;
-    if (!strcmp(name, "GetDisplayPlaneCapabilitiesKHR"))
+    case VK_ENTRYPOINT_GetDisplayPlaneCapabilitiesKHR:
         return (void *)table->GetDisplayPlaneCapabilitiesKHR;
-    if (!strcmp(name, "CreateDisplayPlaneSurfaceKHR"))
+    case VK_ENTRYPOINT_CreateDisplayPlaneSurfaceKHR:
         return (void *)table->CreateDisplayPlaneSurfaceKHR;
 
-    if (!strcmp(name, "CreateDebugReportCallbackEXT"))
+    case VK_ENTRYPOINT_CreateDebugReportCallbackEXT:
         return (void *)table->CreateDebugReportCallbackEXT;
-    if (!strcmp(name, "DestroyDebugReportCallbackEXT"))
+    case VK_ENTRYPOINT_DestroyDebugReportCallbackEXT:
         return (void *)table->DestroyDebugReportCallbackEXT;
-    if (!strcmp(name, "DebugReportMessageEXT"))
+    case VK_ENTRYPOINT_DebugReportMessageEXT:
         return (void *)table->DebugReportMessageEXT;
+    }
 
     *found_name = false;
     return NULL;
@@ -116,6 +116,13 @@ class Subcommand(object):
         pass
 
 class DevExtTrampolineSubcommand(Subcommand):
+    # Must match MAX_NUM_DEV_EXTS in loader.h; an optional argument overrides it
+    default_count = 1024
+
+    def __init__(self, argv):
+        super(DevExtTrampolineSubcommand, self).__init__(argv)
+        self.count = int(argv[0]) if argv else self.default_count
+
     def generate_header(self):
         lines = []
         lines.append("#include \"vk_loader_platform.h\"")
@@ -123,11 +130,15 @@ class DevExtTrampolineSubcommand(Subcommand):
         lines.append("#if defined(__linux__)")
         lines.append("#pragma GCC optimize(3)  // force gcc to use tail-calls")
         lines.append("#endif")
+        lines.append("")
+        lines.append("#if MAX_NUM_DEV_EXTS != %s" % self.count)
+        lines.append("#error \"dev_ext_trampoline.c must be regenerated for MAX_NUM_DEV_EXTS\"")
+        lines.append("#endif")
         return "\n".join(lines)
 
     def generate_body(self):
         lines = []
-        for i in range(250):
+        for i in range(self.count):
             lines.append('\nVKAPI_ATTR void VKAPI_CALL vkDevExt%s(VkDevice device)' % i)
             lines.append('{')
             lines.append('    const struct loader_dev_dispatch_table *disp;')
@@ -138,7 +149,7 @@ class DevExtTrampolineSubcommand(Subcommand):
         lines.append('void *loader_get_dev_ext_trampoline(uint32_t index)')
         lines.append('{')
         lines.append('    switch (index) {')
-        for i in range(250):
+        for i in range(self.count):
             lines.append('        case %s:' % i)
             lines.append('            return vkDevExt%s;' % i)
         lines.append('    }')
@@ -431,6 +442,123 @@ class LoaderGetProcAddrSubcommand(Subcommand):
 
         return "\n".join(body)
 
+class EntrypointHashSubcommand(Subcommand):
+    # Every entry point the loader or a layer may be asked for, whatever the platform, so
+    # that ids agree between builds for different window systems
+    def __init__(self, argv):
+        super(EntrypointHashSubcommand, self).__init__(argv)
+        extensions = [vulkan.core, vulkan.ext_khr_surface, vulkan.ext_khr_device_swapchain, vulkan.ext_khr_display,
+                      vulkan.ext_khr_win32_surface, vulkan.ext_khr_xcb_surface, vulkan.ext_khr_xlib_surface,
+                      vulkan.ext_khr_wayland_surface, vulkan.ext_khr_mir_surface, vulkan.ext_khr_android_surface,
+                      vulkan.lunarg_debug_report]
+        self.names = []
+        for ext in extensions:
+            for proto in ext.protos:
+                if proto.name not in self.names:
+                    self.names.append(proto.name)
+
+    @staticmethod
+    def _hash(name):
+        # FNV-1a; must match vk_entrypoint_hash() below
+        h = 2166136261
+        for c in name.encode('ascii'):
+            h = ((h ^ c) * 16777619) & 0xffffffff
+        return h
+
+    @staticmethod
+    def _slot(h, seed, count):
+        # must match vk_get_entrypoint_id() below
+        x = h ^ seed
+        x ^= x >> 16
+        x = (x * 0x7feb352d) & 0xffffffff
+        x ^= x >> 15
+        return x % count
+
+    def _build(self):
+        # Hash and displace: names are grouped into buckets by hash, and each bucket, largest
+        # first, is given the first seed that moves all of its names to free slots. With as
+        # many slots as names, the result is a minimal perfect hash.
+        count = len(self.names)
+        hashes = dict((name, self._hash(name)) for name in self.names)
+        if len(set(hashes.values())) != count:
+            raise Exception("entry point names collide in the first level hash")
+        buckets = [[] for i in range(count)]
+        for name in self.names:
+            buckets[hashes[name] % count].append(name)
+        seeds = [0] * count
+        slots = [None] * count
+        for b in sorted(range(count), key=lambda b: (-len(buckets[b]), b)):
+            if not buckets[b]:
+                break
+            for seed in range(1, 0x10000):
+                placed = [self._slot(hashes[name], seed, count) for name in buckets[b]]
+                if len(set(placed)) == len(placed) and all(slots[s] is None for s in placed):
+                    break
+            else:
+                raise Exception("no seed places entry point bucket %d" % b)
+            seeds[b] = seed
+            for name, s in zip(buckets[b], placed):
+                slots[s] = name
+        return seeds, slots
+
+    def generate_header(self):
+        return "\n".join(["#pragma once",
+                          "",
+                          "#include <stdint.h>",
+                          "#include <string.h>"])
+
+    def generate_body(self):
+        seeds, slots = self._build()
+        count = len(slots)
+        body = []
+        body.append("// Ids of the entry points below, numbered by their slot in a minimal perfect hash of")
+        body.append("// their names. vk_get_entrypoint_id() maps a name to its id with one pass over the")
+        body.append("// name and one strcmp(), so a GetProcAddr can switch on the id instead of comparing")
+        body.append("// the name against every entry point it knows.")
+        body.append("enum vk_entrypoint_id {")
+        body.append("    VK_ENTRYPOINT_UNKNOWN = -1,")
+        for i, name in enumerate(slots):
+            body.append("    VK_ENTRYPOINT_%s = %d," % (name, i))
+        body.append("    VK_ENTRYPOINT_COUNT = %d" % count)
+        body.append("};")
+        body.append("")
+        body.append("static const char *const vk_entrypoint_names[VK_ENTRYPOINT_COUNT] = {")
+        for name in slots:
+            body.append("    \"%s\"," % name)
+        body.append("};")
+        body.append("")
+        body.append("static const uint16_t vk_entrypoint_seeds[VK_ENTRYPOINT_COUNT] = {")
+        for i in range(0, count, 12):
+            body.append("    %s," % ", ".join(str(s) for s in seeds[i:i + 12]))
+        body.append("};")
+        body.append("")
+        body.append("static inline uint32_t vk_entrypoint_hash(const char *name) {")
+        body.append("    uint32_t h = 2166136261u;")
+        body.append("    while (*name) {")
+        body.append("        h ^= (uint8_t)*name++;")
+        body.append("        h *= 16777619u;")
+        body.append("    }")
+        body.append("    return h;")
+        body.append("}")
+        body.append("")
+        body.append("// Returns the vk_entrypoint_id of name, or VK_ENTRYPOINT_UNKNOWN")
+        body.append("static inline int vk_get_entrypoint_id(const char *name) {")
+        body.append("    uint32_t h, x;")
+        body.append("")
+        body.append("    if (!name || name[0] != 'v' || name[1] != 'k')")
+        body.append("        return VK_ENTRYPOINT_UNKNOWN;")
+        body.append("")
+        body.append("    name += 2;")
+        body.append("    h = vk_entrypoint_hash(name);")
+        body.append("    x = h ^ vk_entrypoint_seeds[h % VK_ENTRYPOINT_COUNT];")
+        body.append("    x ^= x >> 16;")
+        body.append("    x *= 0x7feb352du;")
+        body.append("    x ^= x >> 15;")
+        body.append("    x %= VK_ENTRYPOINT_COUNT;")
+        body.append("    return strcmp(vk_entrypoint_names[x], name) ? VK_ENTRYPOINT_UNKNOWN : (int)x;")
+        body.append("}")
+        return "\n".join(body)
+
 def main():
 
     wsi = {
@@ -448,6 +576,7 @@ def main():
             "dispatch-table-ops": DispatchTableOpsSubcommand,
             "win-def-file": WinDefFileSubcommand,
             "loader-get-proc-addr": LoaderGetProcAddrSubcommand,
+            "entrypoint-hash": EntrypointHashSubcommand,
     }
 
     if len(sys.argv) < 3 or sys.argv[1] not in wsi or sys.argv[2] not in subcommands:
@@ -45,6 +45,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <sys/stat.h>
 
 // VK Library Filenames, Paths, etc.:
 #define PATH_SEPERATOR ':'
@@ -125,6 +126,18 @@ static inline bool loader_platform_file_exists(const char *path) {
         return true;
 }
 
+// Fills in the modification time, in nanoseconds, and size of a file; returns
+// false if it can't be stat'ed.
+static inline bool loader_platform_file_stat(const char *path, int64_t *mtime,
+                                             int64_t *size) {
+    struct stat st;
+    if (stat(path, &st))
+        return false;
+    *mtime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+    *size = (int64_t)st.st_size;
+    return true;
+}
+
 static inline bool loader_platform_is_path_absolute(const char *path) {
     if (path[0] == '/')
         return true;
@@ -232,6 +245,8 @@ loader_platform_thread_cond_broadcast(loader_platform_thread_cond *pCond) {
 #include <io.h>
 #include <stdbool.h>
 #include <shlwapi.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #ifdef __cplusplus
 #include <iostream>
 #include <string>
@@ -267,6 +282,21 @@ static bool loader_platform_file_exists(const char *path) {
         return true;
 }
 
+// Fills in the modification time, in 100ns units, and size of a file; returns
+// false if it can't be read. _stat64 only gives whole seconds.
+static bool loader_platform_file_stat(const char *path, int64_t *mtime,
+                                      int64_t *size) {
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &attributes))
+        return false;
+    *mtime = (int64_t)(((uint64_t)attributes.ftLastWriteTime.dwHighDateTime
+                        << 32) |
+                       attributes.ftLastWriteTime.dwLowDateTime);
+    *size = (int64_t)(((uint64_t)attributes.nFileSizeHigh << 32) |
+                      attributes.nFileSizeLow);
+    return true;
+}
+
 static bool loader_platform_is_path_absolute(const char *path) {
     return !PathIsRelative(path);
 }
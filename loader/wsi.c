@@ -29,6 +29,7 @@
 #include "vk_loader_platform.h"
 #include "loader.h"
 #include "wsi.h"
+#include "vk_entrypoint_hash.h"
 #include <vulkan/vk_icd.h>
 
 static const VkExtensionProperties wsi_surface_extension_info = {
@@ -1376,38 +1377,34 @@ bool wsi_swapchain_instance_gpa(struct loader_instance *ptr_instance,
                                 const char *name, void **addr) {
     *addr = NULL;
 
+    switch (vk_get_entrypoint_id(name)) {
     /*
      * Functions for the VK_KHR_surface extension:
      */
-    if (!strcmp("vkDestroySurfaceKHR", name)) {
+    case VK_ENTRYPOINT_DestroySurfaceKHR:
         *addr = ptr_instance->wsi_surface_enabled ? (void *)vkDestroySurfaceKHR
                                                   : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceSurfaceSupportKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfaceSupportKHR:
         *addr = ptr_instance->wsi_surface_enabled
                     ? (void *)vkGetPhysicalDeviceSurfaceSupportKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceSurfaceCapabilitiesKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfaceCapabilitiesKHR:
         *addr = ptr_instance->wsi_surface_enabled
                     ? (void *)vkGetPhysicalDeviceSurfaceCapabilitiesKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceSurfaceFormatsKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfaceFormatsKHR:
         *addr = ptr_instance->wsi_surface_enabled
                     ? (void *)vkGetPhysicalDeviceSurfaceFormatsKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceSurfacePresentModesKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceSurfacePresentModesKHR:
         *addr = ptr_instance->wsi_surface_enabled
                     ? (void *)vkGetPhysicalDeviceSurfacePresentModesKHR
                     : NULL;
         return true;
-    }
 
     /*
      * Functions for the VK_KHR_swapchain extension:
@@ -1417,164 +1414,142 @@ bool wsi_swapchain_instance_gpa(struct loader_instance *ptr_instance,
      * function will return the trampoline function for such device-extension
      * functions, regardless of whether the extension has been enabled.
      */
-    if (!strcmp("vkCreateSwapchainKHR", name)) {
+    case VK_ENTRYPOINT_CreateSwapchainKHR:
         *addr = (void *)vkCreateSwapchainKHR;
         return true;
-    }
-    if (!strcmp("vkDestroySwapchainKHR", name)) {
+    case VK_ENTRYPOINT_DestroySwapchainKHR:
         *addr = (void *)vkDestroySwapchainKHR;
         return true;
-    }
-    if (!strcmp("vkGetSwapchainImagesKHR", name)) {
+    case VK_ENTRYPOINT_GetSwapchainImagesKHR:
         *addr = (void *)vkGetSwapchainImagesKHR;
         return true;
-    }
-    if (!strcmp("vkAcquireNextImageKHR", name)) {
+    case VK_ENTRYPOINT_AcquireNextImageKHR:
         *addr = (void *)vkAcquireNextImageKHR;
         return true;
-    }
-    if (!strcmp("vkQueuePresentKHR", name)) {
+    case VK_ENTRYPOINT_QueuePresentKHR:
         *addr = (void *)vkQueuePresentKHR;
         return true;
-    }
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     /*
      * Functions for the VK_KHR_win32_surface extension:
      */
-    if (!strcmp("vkCreateWin32SurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateWin32SurfaceKHR:
         *addr = ptr_instance->wsi_win32_surface_enabled
                     ? (void *)vkCreateWin32SurfaceKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceWin32PresentationSupportKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceWin32PresentationSupportKHR:
         *addr = ptr_instance->wsi_win32_surface_enabled
                     ? (void *)vkGetPhysicalDeviceWin32PresentationSupportKHR
                     : NULL;
         return true;
-    }
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_MIR_KHR
     /*
      * Functions for the VK_KHR_mir_surface extension:
      */
-    if (!strcmp("vkCreateMirSurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateMirSurfaceKHR:
         *addr = ptr_instance->wsi_mir_surface_enabled
                     ? (void *)vkCreateMirSurfaceKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceMirPresentationSupportKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceMirPresentationSupportKHR:
         *addr = ptr_instance->wsi_mir_surface_enabled
                     ? (void *)vkGetPhysicalDeviceMirPresentationSupportKHR
                     : NULL;
         return true;
-    }
 #endif // VK_USE_PLATFORM_MIR_KHR
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
     /*
      * Functions for the VK_KHR_wayland_surface extension:
      */
-    if (!strcmp("vkCreateWaylandSurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateWaylandSurfaceKHR:
         *addr = ptr_instance->wsi_wayland_surface_enabled
                     ? (void *)vkCreateWaylandSurfaceKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceWaylandPresentationSupportKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceWaylandPresentationSupportKHR:
         *addr = ptr_instance->wsi_wayland_surface_enabled
                     ? (void *)vkGetPhysicalDeviceWaylandPresentationSupportKHR
                     : NULL;
         return true;
-    }
 #endif // VK_USE_PLATFORM_WAYLAND_KHR
 #ifdef VK_USE_PLATFORM_XCB_KHR
     /*
      * Functions for the VK_KHR_xcb_surface extension:
      */
-    if (!strcmp("vkCreateXcbSurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateXcbSurfaceKHR:
         *addr = ptr_instance->wsi_xcb_surface_enabled
                     ? (void *)vkCreateXcbSurfaceKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceXcbPresentationSupportKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceXcbPresentationSupportKHR:
         *addr = ptr_instance->wsi_xcb_surface_enabled
                     ? (void *)vkGetPhysicalDeviceXcbPresentationSupportKHR
                     : NULL;
         return true;
-    }
 #endif // VK_USE_PLATFORM_XCB_KHR
 #ifdef VK_USE_PLATFORM_XLIB_KHR
     /*
      * Functions for the VK_KHR_xlib_surface extension:
      */
-    if (!strcmp("vkCreateXlibSurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateXlibSurfaceKHR:
         *addr = ptr_instance->wsi_xlib_surface_enabled
                     ? (void *)vkCreateXlibSurfaceKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceXlibPresentationSupportKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceXlibPresentationSupportKHR:
         *addr = ptr_instance->wsi_xlib_surface_enabled
                     ? (void *)vkGetPhysicalDeviceXlibPresentationSupportKHR
                     : NULL;
         return true;
-    }
 #endif // VK_USE_PLATFORM_XLIB_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
     /*
      * Functions for the VK_KHR_android_surface extension:
      */
-    if (!strcmp("vkCreateAndroidSurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateAndroidSurfaceKHR:
         *addr = ptr_instance->wsi_xlib_surface_enabled
                     ? (void *)vkCreateAndroidSurfaceKHR
                     : NULL;
         return true;
-    }
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 
     /*
      * Functions for VK_KHR_display extension:
      */
-    if (!strcmp("vkGetPhysicalDeviceDisplayPropertiesKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceDisplayPropertiesKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkGetPhysicalDeviceDisplayPropertiesKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetPhysicalDeviceDisplayPlanePropertiesKHR", name)) {
+    case VK_ENTRYPOINT_GetPhysicalDeviceDisplayPlanePropertiesKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkGetPhysicalDeviceDisplayPlanePropertiesKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetDisplayPlaneSupportedDisplaysKHR", name)) {
+    case VK_ENTRYPOINT_GetDisplayPlaneSupportedDisplaysKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkGetDisplayPlaneSupportedDisplaysKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetDisplayModePropertiesKHR", name)) {
+    case VK_ENTRYPOINT_GetDisplayModePropertiesKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkGetDisplayModePropertiesKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkCreateDisplayModeKHR", name)) {
+    case VK_ENTRYPOINT_CreateDisplayModeKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkCreateDisplayModeKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkGetDisplayPlaneCapabilitiesKHR", name)) {
+    case VK_ENTRYPOINT_GetDisplayPlaneCapabilitiesKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkGetDisplayPlaneCapabilitiesKHR
                     : NULL;
         return true;
-    }
-    if (!strcmp("vkCreateDisplayPlaneSurfaceKHR", name)) {
+    case VK_ENTRYPOINT_CreateDisplayPlaneSurfaceKHR:
         *addr = ptr_instance->wsi_display_enabled
                     ? (void *)vkCreateDisplayPlaneSurfaceKHR
                     : NULL;
@@ -101,6 +101,30 @@ static const char bindStateFragShaderText[] =
     "   uFragColor = vec4(0,1,0,1);\n"
     "}\n";
 
+// Reads the uniform buffer at set 0, binding 0 (see UniformBufferDrawState)
+static const char uniformBufferFragShaderText[] =
+    "#version 450\n"
+    "\n"
+    "layout(location=0) out vec4 x;\n"
+    "layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;\n"
+    "void main(){\n"
+    "   x = vec4(bar.y);\n"
+    "}\n";
+
+// Objects for drawing with descriptor sets that hold uniform buffers: a pool
+// without FREE_DESCRIPTOR_SET_BIT, a set layout with one binding visible to
+// all stages, a pipeline layout using it as set 0, and a buffer bound to
+// memory. Created by VkLayerTest::InitUniformBufferDrawState and destroyed by
+// DestroyUniformBufferDrawState; a test that destroys one of the objects
+// itself sets its handle to VK_NULL_HANDLE.
+struct UniformBufferDrawState {
+    VkDescriptorPool pool;
+    VkDescriptorSetLayout set_layout;
+    VkPipelineLayout pipeline_layout;
+    VkBuffer buffer;
+    VkDeviceMemory memory;
+};
+
 static VKAPI_ATTR VkBool32 VKAPI_CALL
 myDbgFunc(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
           uint64_t srcObject, size_t location, int32_t msgCode,
@@ -271,6 +295,12 @@ class VkLayerTest : public VkRenderFramework {
     void BindIndexBuffer(VkIndexBufferObj *indexBuffer, VkDeviceSize offset) {
         m_commandBuffer->BindIndexBuffer(indexBuffer, offset);
     }
+    void InitUniformBufferDrawState(UniformBufferDrawState &state,
+                                    VkDescriptorType descriptor_type,
+                                    uint32_t descriptor_count,
+                                    uint32_t max_sets,
+                                    VkDeviceSize buffer_size);
+    void DestroyUniformBufferDrawState(UniformBufferDrawState &state);
 
   protected:
     ErrorMonitor *m_errorMonitor;
@@ -557,6 +587,81 @@ void VkLayerTest::GenericDrawPreparation(VkCommandBufferObj *commandBuffer,
     commandBuffer->BindDescriptorSet(descriptorSet);
 }
 
+// The pool has room for max_sets sets, each with descriptor_count descriptors
+// of descriptor_type in binding 0
+void VkLayerTest::InitUniformBufferDrawState(UniformBufferDrawState &state,
+                                             VkDescriptorType descriptor_type,
+                                             uint32_t descriptor_count,
+                                             uint32_t max_sets,
+                                             VkDeviceSize buffer_size) {
+    state = {};
+
+    VkDescriptorPoolSize ds_type_count = {};
+    ds_type_count.type = descriptor_type;
+    ds_type_count.descriptorCount = descriptor_count * max_sets;
+
+    VkDescriptorPoolCreateInfo ds_pool_ci = {};
+    ds_pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    ds_pool_ci.maxSets = max_sets;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+    VkResult err = vkCreateDescriptorPool(m_device->device(), &ds_pool_ci,
+                                          NULL, &state.pool);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorSetLayoutBinding dsl_binding = {};
+    dsl_binding.binding = 0;
+    dsl_binding.descriptorType = descriptor_type;
+    dsl_binding.descriptorCount = descriptor_count;
+    dsl_binding.stageFlags = VK_SHADER_STAGE_ALL;
+
+    VkDescriptorSetLayoutCreateInfo ds_layout_ci = {};
+    ds_layout_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    ds_layout_ci.bindingCount = 1;
+    ds_layout_ci.pBindings = &dsl_binding;
+    err = vkCreateDescriptorSetLayout(m_device->device(), &ds_layout_ci, NULL,
+                                      &state.set_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    VkPipelineLayoutCreateInfo pipeline_layout_ci = {};
+    pipeline_layout_ci.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &state.set_layout;
+    err = vkCreatePipelineLayout(m_device->device(), &pipeline_layout_ci, NULL,
+                                 &state.pipeline_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    VkBufferCreateInfo buff_ci = {};
+    buff_ci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buff_ci.size = buffer_size;
+    buff_ci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    err = vkCreateBuffer(m_device->device(), &buff_ci, NULL, &state.buffer);
+    ASSERT_VK_SUCCESS(err);
+
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements(m_device->device(), state.buffer, &mem_reqs);
+    VkMemoryAllocateInfo mem_alloc = {};
+    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mem_alloc.allocationSize = mem_reqs.size;
+    bool pass = m_device->phy().set_memory_type(mem_reqs.memoryTypeBits,
+                                                &mem_alloc, 0);
+    ASSERT_TRUE(pass);
+    err = vkAllocateMemory(m_device->device(), &mem_alloc, NULL,
+                           &state.memory);
+    ASSERT_VK_SUCCESS(err);
+    err = vkBindBufferMemory(m_device->device(), state.buffer, state.memory, 0);
+    ASSERT_VK_SUCCESS(err);
+}
+
+void VkLayerTest::DestroyUniformBufferDrawState(UniformBufferDrawState &state) {
+    vkDestroyBuffer(m_device->device(), state.buffer, NULL);
+    vkFreeMemory(m_device->device(), state.memory, NULL);
+    vkDestroyPipelineLayout(m_device->device(), state.pipeline_layout, NULL);
+    vkDestroyDescriptorSetLayout(m_device->device(), state.set_layout, NULL);
+    vkDestroyDescriptorPool(m_device->device(), state.pool, NULL);
+    state = {};
+}
+
 class VkWsiEnabledLayerTest : public VkLayerTest {
   public:
 protected:
@@ -6614,6 +6719,152 @@ TEST_F(VkLayerTest, WriteDescriptorSetIntegrityCheck) {
     vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
 }
 
+TEST_F(VkLayerTest, WriteDescriptorSetAfterEmptyBinding) {
+    TEST_DESCRIPTION("Empty bindings must not shift the descriptors of the "
+                     "bindings after them: update a set whose layout mixes "
+                     "empty bindings with sampler bindings, one of them "
+                     "immutable, and expect no errors.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkDescriptorPoolSize ds_type_count = {};
+    ds_type_count.type = VK_DESCRIPTOR_TYPE_SAMPLER;
+    ds_type_count.descriptorCount = 2;
+
+    VkDescriptorPoolCreateInfo ds_pool_ci = {};
+    ds_pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    ds_pool_ci.maxSets = 1;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+
+    VkDescriptorPool ds_pool;
+    VkResult err =
+        vkCreateDescriptorPool(m_device->device(), &ds_pool_ci, NULL, &ds_pool);
+    ASSERT_VK_SUCCESS(err);
+
+    VkSamplerCreateInfo sampler_ci = {};
+    sampler_ci.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    sampler_ci.magFilter = VK_FILTER_NEAREST;
+    sampler_ci.minFilter = VK_FILTER_NEAREST;
+    sampler_ci.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    sampler_ci.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_ci.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_ci.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_ci.maxAnisotropy = 1;
+    sampler_ci.compareOp = VK_COMPARE_OP_NEVER;
+    sampler_ci.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+    VkSampler sampler;
+    err = vkCreateSampler(m_device->device(), &sampler_ci, NULL, &sampler);
+    ASSERT_VK_SUCCESS(err);
+
+    // Two descriptors in all; bindings 0 and 2 are empty
+    VkDescriptorSetLayoutBinding layout_binding[4] = {};
+    layout_binding[0].binding = 0;
+    layout_binding[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    layout_binding[0].descriptorCount = 0;
+    layout_binding[0].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    layout_binding[1].binding = 1;
+    layout_binding[1].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    layout_binding[1].descriptorCount = 1;
+    layout_binding[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    layout_binding[2].binding = 2;
+    layout_binding[2].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    layout_binding[2].descriptorCount = 0;
+    layout_binding[2].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    layout_binding[3].binding = 3;
+    layout_binding[3].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    layout_binding[3].descriptorCount = 1;
+    layout_binding[3].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    layout_binding[3].pImmutableSamplers = &sampler;
+
+    VkDescriptorSetLayoutCreateInfo ds_layout_ci = {};
+    ds_layout_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    ds_layout_ci.bindingCount = 4;
+    ds_layout_ci.pBindings = layout_binding;
+    VkDescriptorSetLayout ds_layout;
+    err = vkCreateDescriptorSetLayout(m_device->device(), &ds_layout_ci, NULL,
+                                      &ds_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    m_errorMonitor->ExpectSuccess();
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.descriptorPool = ds_pool;
+    alloc_info.pSetLayouts = &ds_layout;
+    VkDescriptorSet descriptor_set;
+    err = vkAllocateDescriptorSets(m_device->device(), &alloc_info,
+                                   &descriptor_set);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorImageInfo image_info = {};
+    image_info.sampler = sampler;
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = descriptor_set;
+    descriptor_write.dstBinding = 1;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    descriptor_write.pImageInfo = &image_info;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    m_errorMonitor->VerifyNotFound();
+
+    vkDestroyDescriptorSetLayout(m_device->device(), ds_layout, NULL);
+    vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
+    vkDestroySampler(m_device->device(), sampler, NULL);
+}
+
+TEST_F(VkLayerTest, UpdateDescriptorSetsLargeBatch) {
+    TEST_DESCRIPTION("Apply 20480 buffer descriptor writes, spread over 64 "
+                     "sets, in a single vkUpdateDescriptorSets call. Expect "
+                     "no errors.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    const uint32_t set_count = 64;
+    const uint32_t descriptors_per_set = 320;
+
+    UniformBufferDrawState state;
+    ASSERT_NO_FATAL_FAILURE(InitUniformBufferDrawState(
+        state, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptors_per_set,
+        set_count, 256));
+
+    std::vector<VkDescriptorSetLayout> layouts(set_count, state.set_layout);
+    std::vector<VkDescriptorSet> descriptor_sets(set_count);
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = set_count;
+    alloc_info.descriptorPool = state.pool;
+    alloc_info.pSetLayouts = layouts.data();
+    VkResult err = vkAllocateDescriptorSets(m_device->device(), &alloc_info,
+                                            descriptor_sets.data());
+    ASSERT_VK_SUCCESS(err);
+
+    // One write per descriptor, so the layer sees every write separately
+    VkDescriptorBufferInfo buff_info = {};
+    buff_info.buffer = state.buffer;
+    buff_info.range = 256;
+    std::vector<VkWriteDescriptorSet> descriptor_writes(set_count *
+                                                        descriptors_per_set);
+    for (uint32_t i = 0; i < descriptor_writes.size(); ++i) {
+        VkWriteDescriptorSet &write = descriptor_writes[i];
+        write = {};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = descriptor_sets[i / descriptors_per_set];
+        write.dstBinding = 0;
+        write.dstArrayElement = i % descriptors_per_set;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo = &buff_info;
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    vkUpdateDescriptorSets(m_device->device(),
+                           static_cast<uint32_t>(descriptor_writes.size()),
+                           descriptor_writes.data(), 0, NULL);
+    m_errorMonitor->VerifyNotFound();
+
+    DestroyUniformBufferDrawState(state);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyed) {
     TEST_DESCRIPTION("Attempt to draw with a command buffer that is invalid "
                      "due to a buffer dependency being destroyed.");
@@ -6894,6 +7145,58 @@ TEST_F(VkLayerTest, BufferMemoryNotBound) {
     vkFreeMemory(m_device->handle(), mem, NULL);
 }
 
+TEST_F(VkLayerTest, FreeAndReallocateMemoryWhileRecording) {
+    TEST_DESCRIPTION("Free memory used by a command buffer that is still "
+                     "recording and allocate again before ending it. The new "
+                     "allocation, which may reuse the freed handle, must not "
+                     "be tied to the command buffer.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buf_info.size = 256;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer;
+    VkResult err = vkCreateBuffer(m_device->device(), &buf_info, NULL, &buffer);
+    ASSERT_VK_SUCCESS(err);
+
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements(m_device->device(), buffer, &mem_reqs);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_reqs.size;
+    bool pass = m_device->phy().set_memory_type(mem_reqs.memoryTypeBits,
+                                                &alloc_info, 0);
+    if (!pass) {
+        vkDestroyBuffer(m_device->device(), buffer, NULL);
+        return;
+    }
+    VkDeviceMemory mem;
+    err = vkAllocateMemory(m_device->device(), &alloc_info, NULL, &mem);
+    ASSERT_VK_SUCCESS(err);
+    err = vkBindBufferMemory(m_device->device(), buffer, mem, 0);
+    ASSERT_VK_SUCCESS(err);
+
+    m_errorMonitor->ExpectSuccess();
+    BeginCommandBuffer();
+    vkCmdFillBuffer(m_commandBuffer->GetBufferHandle(), buffer, 0, 4,
+                    0x11111111);
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+    vkFreeMemory(m_device->device(), mem, NULL);
+
+    VkDeviceMemory new_mem;
+    err = vkAllocateMemory(m_device->device(), &alloc_info, NULL, &new_mem);
+    ASSERT_VK_SUCCESS(err);
+    EndCommandBuffer();
+
+    // Had the freed handle stayed on the command buffer, the new allocation
+    // would now be reported as still referenced by it.
+    vkFreeMemory(m_device->device(), new_mem, NULL);
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferEventDestroyed) {
     TEST_DESCRIPTION("Attempt to draw with a command buffer that is invalid "
                      "due to an event dependency being destroyed.");
@@ -7096,6 +7399,149 @@ TEST_F(VkLayerTest, InvalidPipeline) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, DrawAfterDescriptorPoolReset) {
+    TEST_DESCRIPTION("Reset the pool of a descriptor set bound to a command "
+                     "buffer that is being recorded, allocate a new set from "
+                     "it and draw. The freed set must no longer count as "
+                     "bound.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // No FREE_DESCRIPTOR_SET_BIT, so the pool can only be reset as a whole
+    UniformBufferDrawState state;
+    ASSERT_NO_FATAL_FAILURE(InitUniformBufferDrawState(
+        state, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, 1, 256));
+
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.descriptorPool = state.pool;
+    alloc_info.pSetLayouts = &state.set_layout;
+    VkDescriptorSet descriptor_set;
+    VkResult err = vkAllocateDescriptorSets(m_device->device(), &alloc_info,
+                                            &descriptor_set);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorBufferInfo buff_info = {};
+    buff_info.buffer = state.buffer;
+    buff_info.range = 256;
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = descriptor_set;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptor_write.pBufferInfo = &buff_info;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    VkShaderObj vs(m_device, bindStateVertShaderText,
+                   VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, uniformBufferFragShaderText,
+                   VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddColorAttachment();
+    pipe.CreateVKPipeline(state.pipeline_layout, renderPass());
+
+    BeginCommandBuffer();
+    vkCmdBindPipeline(m_commandBuffer->GetBufferHandle(),
+                      VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(),
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            state.pipeline_layout, 0, 1, &descriptor_set, 0,
+                            NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         "but that set is not bound");
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // The set allocated after the reset may get the freed set's memory and
+    // even its handle, but the freed set stays unbound
+    vkResetDescriptorPool(m_device->device(), state.pool, 0);
+    VkDescriptorSet new_set;
+    err = vkAllocateDescriptorSets(m_device->device(), &alloc_info, &new_set);
+    ASSERT_VK_SUCCESS(err);
+    descriptor_write.dstSet = new_set;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         "uses set #0 but that set is not "
+                                         "bound");
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(),
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            state.pipeline_layout, 0, 1, &new_set, 0, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         "but that set is not bound");
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+    EndCommandBuffer();
+
+    DestroyUniformBufferDrawState(state);
+}
+
+TEST_F(VkLayerTest, InvalidCmdBufferDescriptorPoolDestroyed) {
+    TEST_DESCRIPTION("Submit a command buffer that is invalid because the "
+                     "pool of a descriptor set bound in it was destroyed.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    UniformBufferDrawState state;
+    ASSERT_NO_FATAL_FAILURE(InitUniformBufferDrawState(
+        state, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, 1, 256));
+
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.descriptorPool = state.pool;
+    alloc_info.pSetLayouts = &state.set_layout;
+    VkDescriptorSet descriptor_set;
+    VkResult err = vkAllocateDescriptorSets(m_device->device(), &alloc_info,
+                                            &descriptor_set);
+    ASSERT_VK_SUCCESS(err);
+
+    VkShaderObj vs(m_device, bindStateVertShaderText,
+                   VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, bindStateFragShaderText,
+                   VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddColorAttachment();
+    pipe.CreateVKPipeline(state.pipeline_layout, renderPass());
+
+    BeginCommandBuffer();
+    vkCmdBindPipeline(m_commandBuffer->GetBufferHandle(),
+                      VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(),
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            state.pipeline_layout, 0, 1, &descriptor_set, 0,
+                            NULL);
+    Draw(1, 0, 0, 0);
+    EndCommandBuffer();
+
+    m_errorMonitor->SetDesiredFailureMsg(
+        VK_DEBUG_REPORT_ERROR_BIT_EXT,
+        " that is invalid because bound descriptor set ");
+    // Destroying the pool frees the set along with it
+    vkDestroyDescriptorPool(m_device->device(), state.pool, NULL);
+    state.pool = VK_NULL_HANDLE;
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    DestroyUniformBufferDrawState(state);
+}
+
 TEST_F(VkLayerTest, DescriptorSetNotUpdated) {
     // Create and update CommandBuffer then call QueueSubmit w/o calling End on
     // CommandBuffer
@@ -7482,6 +7928,123 @@ TEST_F(VkLayerTest, InvalidDynamicOffsetCases) {
     vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
 }
 
+TEST_F(VkLayerTest, RepeatedDrawRevalidatesDescriptors) {
+    TEST_DESCRIPTION("Draw repeatedly with the same descriptor set bound. A "
+                     "descriptor write, a new dynamic offset or a destroyed "
+                     "buffer must bring back draw-time errors after a clean "
+                     "draw, and every draw with a problem must report it.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    UniformBufferDrawState state;
+    ASSERT_NO_FATAL_FAILURE(InitUniformBufferDrawState(
+        state, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1, 1, 1024));
+
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.descriptorPool = state.pool;
+    alloc_info.pSetLayouts = &state.set_layout;
+    VkDescriptorSet descriptor_set;
+    VkResult err = vkAllocateDescriptorSets(m_device->device(), &alloc_info,
+                                            &descriptor_set);
+    ASSERT_VK_SUCCESS(err);
+
+    // With a dynamic offset of 256, a range of 512 fits in the buffer
+    VkDescriptorBufferInfo buff_info = {};
+    buff_info.buffer = state.buffer;
+    buff_info.range = 512;
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = descriptor_set;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    descriptor_write.pBufferInfo = &buff_info;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    VkShaderObj vs(m_device, bindStateVertShaderText,
+                   VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, uniformBufferFragShaderText,
+                   VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddColorAttachment();
+    pipe.CreateVKPipeline(state.pipeline_layout, renderPass());
+
+    const char *overstep_message = " dynamic offset 256 combined with offset 0 "
+                                   "and range 1024 that oversteps the buffer "
+                                   "size of 1024";
+    uint32_t dynamic_offset = 256;
+    BeginCommandBuffer();
+    vkCmdBindPipeline(m_commandBuffer->GetBufferHandle(),
+                      VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(),
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            state.pipeline_layout, 0, 1, &descriptor_set, 1,
+                            &dynamic_offset);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         overstep_message);
+    Draw(1, 0, 0, 0);
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Widening the range makes the bound offset overstep the buffer
+    buff_info.range = 1024;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         overstep_message);
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         overstep_message);
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    buff_info.range = 512;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         overstep_message);
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Rebinding the unchanged set with a larger dynamic offset oversteps too
+    dynamic_offset = 768;
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(),
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            state.pipeline_layout, 0, 1, &descriptor_set, 1,
+                            &dynamic_offset);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         " dynamic offset 768 combined with "
+                                         "offset 0 and range 512 that "
+                                         "oversteps the buffer size of 1024");
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    dynamic_offset = 256;
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(),
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            state.pipeline_layout, 0, 1, &descriptor_set, 1,
+                            &dynamic_offset);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         " that oversteps the buffer size ");
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // The set is unchanged, but the buffer its descriptor refers to is gone
+    vkDestroyBuffer(m_device->device(), state.buffer, NULL);
+    state.buffer = VK_NULL_HANDLE;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         " references invalid buffer ");
+    Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+    EndCommandBuffer();
+
+    DestroyUniformBufferDrawState(state);
+}
+
 TEST_F(VkLayerTest, DescriptorBufferUpdateNoMemoryBound) {
     TEST_DESCRIPTION("Attempt to update a descriptor with a non-sparse buffer "
                      "that doesn't have memory bound");
@@ -11254,6 +11817,23 @@ TEST_F(VkLayerTest, CopyDescriptorUpdateErrors) {
 
     m_errorMonitor->VerifyFound();
 
+    // Now perform a copy update that fails because the source descriptor
+    // was never written
+    m_errorMonitor->SetDesiredFailureMsg(
+        VK_DEBUG_REPORT_ERROR_BIT_EXT,
+        " binding #0 but descriptor at array offset 0 has not been updated.");
+
+    memset(&copy_ds_update, 0, sizeof(VkCopyDescriptorSet));
+    copy_ds_update.sType = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+    copy_ds_update.srcSet = descriptorSet;
+    copy_ds_update.srcBinding = 0; // ERROR : UNIFORM binding never written
+    copy_ds_update.dstSet = descriptorSet;
+    copy_ds_update.dstBinding = 0;
+    copy_ds_update.descriptorCount = 1;
+    vkUpdateDescriptorSets(m_device->device(), 0, NULL, 1, &copy_ds_update);
+
+    m_errorMonitor->VerifyFound();
+
     vkDestroySampler(m_device->device(), sampler, NULL);
     vkDestroyDescriptorSetLayout(m_device->device(), ds_layout, NULL);
     vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
@@ -26,11 +26,17 @@
  */
 
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 #include <vulkan/vulkan.h>
 #include "test_common.h"
 
@@ -813,6 +819,121 @@ TEST(EnumerateDeviceExtensionProperties, DeviceExtensionEnumerated)
     vkDestroyInstance(instance, nullptr);
 }
 
+// Unknown entrypoints are looked up in the loader's device extension table.
+// Query more distinct names than there are trampolines, twice over. No driver
+// or layer provides these names, so every lookup must miss and return null.
+TEST(GetInstanceProcAddr, UnknownEntrypoints)
+{
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        for(int i = 0; i < 4096; ++i)
+        {
+            std::string const name = "vkNotPresent" + std::to_string(i);
+            ASSERT_EQ(vkGetInstanceProcAddr(instance, name.c_str()), nullptr);
+        }
+    }
+
+    vkDestroyInstance(instance, nullptr);
+}
+
+#if !defined(_WIN32)
+// Unknown entrypoints that a layer provides get a trampoline from the loader's
+// device extension table. A layer manifest listing more entrypoints than there
+// are trampolines (MAX_NUM_DEV_EXTS in loader.h) is written to a scratch
+// VK_LAYER_PATH. The first 1024 names must get distinct trampolines and the
+// rest null, and looking every name up again must give the same answers. The
+// layer is only scanned, never loaded, so its library doesn't need to exist.
+TEST(GetInstanceProcAddr, LayerEntrypointsFillTable)
+{
+    uint32_t const trampolineCount = 1024;
+    uint32_t const nameCount = trampolineCount + 64;
+
+    char directory[] = "/tmp/vk_loader_test_XXXXXX";
+    ASSERT_NE(mkdtemp(directory), nullptr);
+    std::string const manifest = std::string(directory) + "/VkLayer_many_entrypoints.json";
+
+    FILE *file = fopen(manifest.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fprintf(file,
+        "{\n"
+        "    \"file_format_version\" : \"1.0.0\",\n"
+        "    \"layer\" : {\n"
+        "        \"name\": \"VK_LAYER_LUNARG_many_entrypoints\",\n"
+        "        \"type\": \"GLOBAL\",\n"
+        "        \"library_path\": \"./libVkLayer_many_entrypoints.so\",\n"
+        "        \"api_version\": \"1.0.11\",\n"
+        "        \"implementation_version\": \"1\",\n"
+        "        \"description\": \"Loader test layer\",\n"
+        "        \"device_extensions\": [{\n"
+        "            \"name\": \"VK_LUNARG_many_entrypoints\",\n"
+        "            \"spec_version\": \"1\",\n"
+        "            \"entrypoints\": [");
+    for(uint32_t i = 0; i < nameCount; ++i)
+    {
+        fprintf(file, "%s\"vkTestEntrypoint%u\"", i ? ", " : "", i);
+    }
+    fprintf(file, "]\n        }]\n    }\n}\n");
+    fclose(file);
+
+    char const*const oldPath = getenv("VK_LAYER_PATH");
+    std::string const savedPath = oldPath ? oldPath : "";
+    setenv("VK_LAYER_PATH", directory, 1);
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+
+    if(oldPath)
+    {
+        setenv("VK_LAYER_PATH", savedPath.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("VK_LAYER_PATH");
+    }
+    remove(manifest.c_str());
+    rmdir(directory);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    std::vector<PFN_vkVoidFunction> first(nameCount);
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        for(uint32_t i = 0; i < nameCount; ++i)
+        {
+            std::string const name = "vkTestEntrypoint" + std::to_string(i);
+            PFN_vkVoidFunction const function = vkGetInstanceProcAddr(instance, name.c_str());
+            if(pass == 0)
+            {
+                first[i] = function;
+            }
+            else
+            {
+                ASSERT_EQ(function, first[i]) << name;
+            }
+        }
+    }
+
+    for(uint32_t i = 0; i < nameCount; ++i)
+    {
+        if(i < trampolineCount)
+        {
+            ASSERT_NE(first[i], nullptr) << i;
+        }
+        else
+        {
+            ASSERT_EQ(first[i], nullptr) << i;
+        }
+    }
+    std::sort(first.begin(), first.begin() + trampolineCount);
+    ASSERT_EQ(std::adjacent_find(first.begin(), first.begin() + trampolineCount), first.begin() + trampolineCount);
+
+    vkDestroyInstance(instance, nullptr);
+}
+#endif
+
 TEST(WrapObjects, Insert)
 {
     VkInstance instance = VK_NULL_HANDLE;
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times the entry point lookups an application and its layers make while
+// starting up. Each pass resolves every entry point the loader knows by name,
+// the way a layer or an application fills its dispatch tables:
+//
+// - name to id through the generated perfect hash, against a strcmp() scan of
+//   the same names (what the GetProcAddr functions did before the hash);
+// - vkGetInstanceProcAddr() through the installed loader and any layers
+//   enabled with VK_INSTANCE_LAYERS;
+// - vkGetDeviceProcAddr() on the first physical device, if one is present.
+//
+// Every figure is the fastest of a number of passes (the first argument,
+// default 200). The program exits non-zero if any name fails to map to its own
+// id, or an unknown name maps to one.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include "vk_entrypoint_hash.h"
+
+namespace {
+
+typedef std::chrono::steady_clock clock_type;
+
+// Fastest of passes runs of f, in microseconds
+template <typename F> double fastest_pass(int passes, F f) {
+    double best = 0.0;
+    for (int pass = 0; pass < passes; ++pass) {
+        auto const start = clock_type::now();
+        f();
+        std::chrono::duration<double, std::micro> const elapsed =
+            clock_type::now() - start;
+        if (pass == 0 || elapsed.count() < best) {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+int linear_entrypoint_id(const char *name) {
+    if (!name || name[0] != 'v' || name[1] != 'k') {
+        return VK_ENTRYPOINT_UNKNOWN;
+    }
+    for (int id = 0; id < VK_ENTRYPOINT_COUNT; ++id) {
+        if (!strcmp(vk_entrypoint_names[id], name + 2)) {
+            return id;
+        }
+    }
+    return VK_ENTRYPOINT_UNKNOWN;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    int const passes = argc > 1 ? std::max(1, atoi(argv[1])) : 200;
+
+    std::vector<std::string> names;
+    for (int id = 0; id < VK_ENTRYPOINT_COUNT; ++id) {
+        names.push_back(std::string("vk") + vk_entrypoint_names[id]);
+    }
+
+    int mismatches = 0;
+    for (int id = 0; id < VK_ENTRYPOINT_COUNT; ++id) {
+        if (vk_get_entrypoint_id(names[id].c_str()) != id) {
+            printf("%s does not map to its own id\n", names[id].c_str());
+            ++mismatches;
+        }
+    }
+    const char *const unknown_names[] = {"vkNotAnEntrypoint", "QueueSubmit",
+                                         "vkQueueSubmitX", "vk", ""};
+    for (auto name : unknown_names) {
+        if (vk_get_entrypoint_id(name) != VK_ENTRYPOINT_UNKNOWN) {
+            printf("unknown name \"%s\" maps to an id\n", name);
+            ++mismatches;
+        }
+    }
+
+    volatile int id_sink = 0;
+    double const hash_us = fastest_pass(passes, [&]() {
+        for (auto const &name : names) {
+            id_sink = vk_get_entrypoint_id(name.c_str());
+        }
+    });
+    double const scan_us = fastest_pass(passes, [&]() {
+        for (auto const &name : names) {
+            id_sink = linear_entrypoint_id(name.c_str());
+        }
+    });
+    printf("%d names, fastest of %d passes\n", VK_ENTRYPOINT_COUNT, passes);
+    printf("  name to id, perfect hash:  %8.1f us\n", hash_us);
+    printf("  name to id, strcmp scan:   %8.1f us\n", scan_us);
+
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    VkInstance instance = VK_NULL_HANDLE;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        printf("  vkCreateInstance failed; skipping the loader lookups\n");
+        return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    PFN_vkVoidFunction volatile proc_sink = nullptr;
+    double const instance_us = fastest_pass(passes, [&]() {
+        for (auto const &name : names) {
+            proc_sink = vkGetInstanceProcAddr(instance, name.c_str());
+        }
+    });
+    printf("  vkGetInstanceProcAddr:     %8.1f us\n", instance_us);
+
+    uint32_t gpu_count = 1;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkResult const result =
+        vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    VkDevice device = VK_NULL_HANDLE;
+    if ((result == VK_SUCCESS || result == VK_INCOMPLETE) && gpu_count > 0) {
+        float const priority = 1.0f;
+        VkDeviceQueueCreateInfo queue_info = {};
+        queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_info.queueFamilyIndex = 0;
+        queue_info.queueCount = 1;
+        queue_info.pQueuePriorities = &priority;
+        VkDeviceCreateInfo device_info = {};
+        device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        device_info.queueCreateInfoCount = 1;
+        device_info.pQueueCreateInfos = &queue_info;
+        if (vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+            device = VK_NULL_HANDLE;
+        }
+    }
+    if (device != VK_NULL_HANDLE) {
+        double const device_us = fastest_pass(passes, [&]() {
+            for (auto const &name : names) {
+                proc_sink = vkGetDeviceProcAddr(device, name.c_str());
+            }
+        });
+        printf("  vkGetDeviceProcAddr:       %8.1f us\n", device_us);
+        vkDestroyDevice(device, nullptr);
+    } else {
+        printf("  no device; skipping vkGetDeviceProcAddr\n");
+    }
+
+    vkDestroyInstance(instance, nullptr);
+    return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -100,10 +100,6 @@ def wsi_endif(ext_name):
     else:
         return "#endif  // VK_USE_PLATFORM_%s_KHR" % wsi_prefix
 
-def generate_get_proc_addr_check(name):
-    return "    if (!%s || %s[0] != 'v' || %s[1] != 'k')\n" \
-           "        return NULL;" % ((name,) * 3)
-
 def ucc_to_U_C_C(CamelCase):
     temp = re.sub('(.)([A-Z][a-z]+)',  r'\1_\2', CamelCase)
     return re.sub('([a-z0-9])([A-Z])', r'\1_\2', temp).upper()
@@ -457,10 +453,10 @@ class Subcommand(object):
         device_lookups = []
         for proto in intercepted:
             if proto_is_global(proto):
-                instance_lookups.append("if (!strcmp(name, \"%s\"))" % proto.name)
+                instance_lookups.append("case VK_ENTRYPOINT_%s:" % proto.name)
                 instance_lookups.append("    return (PFN_vkVoidFunction) %s;" % (proto.name))
             else:
-                device_lookups.append("if (!strcmp(name, \"%s\"))" % proto.name)
+                device_lookups.append("case VK_ENTRYPOINT_%s:" % proto.name)
                 device_lookups.append("    return (PFN_vkVoidFunction) %s;" % (proto.name))
 
         # add customized intercept_core_device_command
@@ -468,20 +464,18 @@ class Subcommand(object):
         body.append('%s' % self.lineinfo.get())
         body.append("static inline PFN_vkVoidFunction intercept_core_device_command(const char *name)")
         body.append("{")
-        body.append(generate_get_proc_addr_check("name"))
-        body.append("")
-        body.append("    name += 2;")
+        body.append("    switch (vk_get_entrypoint_id(name)) {")
         body.append("    %s" % "\n    ".join(device_lookups))
+        body.append("    }")
         body.append("")
         body.append("    return NULL;")
         body.append("}")
         # add intercept_core_instance_command
         body.append("static inline PFN_vkVoidFunction intercept_core_instance_command(const char *name)")
         body.append("{")
-        body.append(generate_get_proc_addr_check("name"))
-        body.append("")
-        body.append("    name += 2;")
+        body.append("    switch (vk_get_entrypoint_id(name)) {")
         body.append("    %s" % "\n    ".join(instance_lookups))
+        body.append("    }")
         body.append("")
         body.append("    return NULL;")
         body.append("}")
@@ -748,6 +742,7 @@ class UniqueObjectsSubcommand(Subcommand):
         header_txt = []
         header_txt.append('%s' % self.lineinfo.get())
         header_txt.append('#include "unique_objects.h"')
+        header_txt.append('#include "vk_entrypoint_hash.h"')
         return "\n".join(header_txt)
 
     # Generate UniqueObjects code for given struct_uses dict of objects that need to be unwrapped
@@ -907,12 +902,10 @@ class UniqueObjectsSubcommand(Subcommand):
             if len(local_decls) > 0:
                 pre_call_txt += '//LOCAL DECLS:%s\n' % sorted(local_decls)
             if destroy_func: # only one object
-                pre_call_txt += '%sstd::unique_lock<std::mutex> lock(global_lock);\n' % (indent)
                 for del_obj in sorted(struct_uses):
                     pre_call_txt += '%suint64_t local_%s = reinterpret_cast<uint64_t &>(%s);\n' % (indent, del_obj, del_obj)
                     pre_call_txt += '%s%s = (%s)my_map_data->unique_id_mapping[local_%s];\n' % (indent, del_obj, struct_uses[del_obj], del_obj)
                 pre_call_txt += '%smy_map_data->unique_id_mapping.erase(local_%s);\n' % (indent, proto.params[-2].name)
-                pre_call_txt += '%slock.unlock();\n' % (indent)
                 (pre_decl, pre_code, post_code) = ('', '', '')
             else:
                 (pre_decl, pre_code, post_code) = self._gen_obj_code(struct_uses, local_decls, '    ', '', 0, set(), True)
@@ -923,8 +916,6 @@ class UniqueObjectsSubcommand(Subcommand):
                     init_null_txt = '{}';
                 if local_decls[ld].strip('*') not in vulkan.object_non_dispatch_list:
                     pre_decl += '    safe_%s local_%s = %s;\n' % (local_decls[ld], ld, init_null_txt)
-            if pre_code != '': # lock around map uses
-                pre_code = '%s{\n%sstd::lock_guard<std::mutex> lock(global_lock);\n%s%s}\n' % (indent, indent, pre_code, indent)
             pre_call_txt += '%s%s' % (pre_decl, pre_code)
             post_call_txt += '%s' % (post_code)
         elif create_func:
@@ -946,21 +937,18 @@ class UniqueObjectsSubcommand(Subcommand):
                 local_name = "unique%s" % obj_type[2:]
                 post_call_txt += '%sif (VK_SUCCESS == result) {\n' % (indent)
                 indent += '    '
-                post_call_txt += '%sstd::lock_guard<std::mutex> lock(global_lock);\n' % (indent)
                 if obj_name in custom_create_dict:
                     post_call_txt += '%s\n' % (self.lineinfo.get())
                     local_name = '%ss' % (local_name) # add 's' to end for vector of many
                     post_call_txt += '%sfor (uint32_t i=0; i<%s; ++i) {\n' % (indent, custom_create_dict[obj_name])
                     indent += '    '
-                    post_call_txt += '%suint64_t unique_id = global_unique_id++;\n' % (indent)
-                    post_call_txt += '%smy_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(%s[i]);\n' % (indent, obj_name)
+                    post_call_txt += '%suint64_t unique_id = my_map_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(%s[i]));\n' % (indent, obj_name)
                     post_call_txt += '%s%s[i] = reinterpret_cast<%s&>(unique_id);\n' % (indent, obj_name, obj_type)
                     indent = indent[4:]
                     post_call_txt += '%s}\n' % (indent)
                 else:
                     post_call_txt += '%s\n' % (self.lineinfo.get())
-                    post_call_txt += '%suint64_t unique_id = global_unique_id++;\n' % (indent)
-                    post_call_txt += '%smy_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*%s);\n' % (indent, obj_name)
+                    post_call_txt += '%suint64_t unique_id = my_map_data->unique_id_mapping.insert(reinterpret_cast<uint64_t &>(*%s));\n' % (indent, obj_name)
                     post_call_txt += '%s*%s = reinterpret_cast<%s&>(unique_id);\n' % (indent, obj_name, obj_type)
                 indent = indent[4:]
                 post_call_txt += '%s}\n' % (indent)